@@ -1,6 +1,7 @@
 #include "Asset/Mesh.h"
 #include "Core/Asserts.h"
 #include "Core/Files.h"
+#include "String/AxFileStream.h"
 #include "String/AxStream.h"
 
 constexpr static uint32_t MAGIC = 0x58455041; // 'APEX'
@@ -39,13 +40,6 @@ namespace apex::asset {
 		return buffer;
 	}
 
-	static size_t WriteFileContents(const char* filename, char* buffer, size_t size)
-	{
-		File file = File::CreateOrOpen(filename);
-		const size_t sizeWritten = file.Write(buffer, size);
-		return sizeWritten;
-	}
-
 	u32 CalculateVertexStride(const MeshData* mesh)
 	{
 		uint32_t vertexStride = 0;
@@ -142,15 +136,8 @@ namespace apex::asset {
 
 		const uint32_t vertexStride = CalculateVertexStride(mesh);
 
-		const size_t size = sizeof(MAGIC) + sizeof(SIGNATURE_MESH) + sizeof(MeshData)
-						+ sizeof(MeshStream) * mesh->streamCount
-						+ sizeof(MeshAttribute) * mesh->attributeCount
-						+ sizeof(uint32_t) * mesh->indexCount
-						+ (size_t)vertexStride * mesh->vertexCount;
-
-		char* buffer = (char*)detail::memAlloc(sizeof(char) * size);
-
-		AxStreamWriter writer { buffer, size };
+		File file = File::CreateOrOpen(filename);
+		AxFileStreamWriter writer { file };
 
 		writer.WriteObject(&MAGIC);
 		writer.WriteObject(&SIGNATURE_MESH);
@@ -159,10 +146,9 @@ namespace apex::asset {
 		writer.WriteArray(mesh->pAttributes, mesh->attributeCount);
 		writer.WriteArray(mesh->pIndices, mesh->indexCount);
 		writer.WriteArray((char*)mesh->pVertices, (size_t)mesh->vertexCount * vertexStride);
+		writer.Flush();
 
-		size_t bytesWritten = WriteFileContents(filename, buffer, size);
-
-		detail::memFree(buffer);
+		const size_t bytesWritten = writer.HasFailed() ? 0 : writer.GetBytesWritten();
 
 		return bytesWritten;
 	}
@@ -7,8 +7,6 @@
 
 #include "View.h"
 
-static char STRBUF[512];
-
 namespace apex {
 	using core::TypeInfo, core::TypeIndex;
 
@@ -19,8 +17,6 @@ namespace ecs {
 		using base_pool_type = AxSparseSet<entity_id>;
 		template <typename Component> using pool_type = storage_for_type_t<Component>;
 
-		static constexpr auto kComponentPoolGrowthRate = 2u;
-
 		u32 m_entityCount{};
 		AxSparseMap<component_id, UniquePtr<base_pool_type>> m_pools{};
 		size_t minPoolSize = 8;
@@ -36,16 +32,6 @@ namespace ecs {
 		{
 			pool_type<Component>* pool = assurePool<Component>();
 
-			if (pool->capacity() <= entity)
-			{
-				size_t newCapacity = entity * kComponentPoolGrowthRate;
-
-				sprintf_s(STRBUF, "Component pool [%d] resized. New size: %llu", TypeIndex<Component>::value(), newCapacity);
-				axDebug(STRBUF);
-
-				pool->resize(newCapacity);
-			}
-
 			if constexpr (empty<Component>)
 			{
 				return pool->insert(entity);
@@ -61,7 +47,7 @@ namespace ecs {
 		{
 			pool_type<Component>* pool = assurePool<Component>();
 
-			if (pool->capacity() <= entity)
+			if (!pool->contains(entity))
 			{
 				return std::nullopt;
 			}
@@ -96,17 +82,6 @@ namespace ecs {
 		template <typename Component>
 		auto _AssurePool(component_id type_index) -> pool_type<Component>*
 		{
-			// TODO: Try to count the number of unique component types before hand to avoid resizing registry
-			if (m_pools.capacity() <= type_index)
-			{
-				const size_t newCapacity = max(type_index * 1.5, type_index + 1.0);
-
-				m_pools.resize(newCapacity);
-
-				sprintf_s(STRBUF, "Registry resized. New size: %llu", m_pools.capacity());
-				axDebug(STRBUF);
-			}
-
 			auto elemPair = m_pools.try_get(type_index);
 			if (elemPair)
 			{
@@ -1,6 +1,6 @@
 ﻿#pragma once
 #include "Api.h"
-#include "Containers/AxArray.h"
+#include "Containers/AxSmallArray.h"
 #include "Containers/AxRange.h"
 
 namespace apex {
@@ -17,7 +17,7 @@ namespace apex {
 	class APEX_API CommandLineArguments
 	{
 	public:
-		using options_array = AxArray<CommandLineOption>;
+		using options_array = AxSmallArray<CommandLineOption, 8>;
 
 		CommandLineArguments() = default;
 
@@ -0,0 +1,44 @@
+#pragma once
+#include "Containers/AxArray.h"
+#include "Core/Types.h"
+
+namespace apex {
+
+	/**
+	 * \brief Stable LSD radix sort over 8-bit digits.
+	 * \details The histograms of every digit are built in a single pass over the keys, and passes in which every key has
+	 * the same digit are skipped, so keys with a small range only pay for the digits they use.
+	 * Float keys are mapped to order preserving unsigned integers in place (vectorised) and mapped back after sorting.
+	 * When values are given they are permuted along with the keys, typically indices into the sorted objects.
+	 * Ranges of up to 64 elements use an insertion sort. Scratch memory comes from the MemoryManager.
+	 */
+	void radixSort(AxArrayRef<u32> keys);
+	void radixSort(AxArrayRef<u64> keys);
+	void radixSort(AxArrayRef<float> keys);
+
+	void radixSort(AxArrayRef<u32> keys, AxArrayRef<u32> values);
+	void radixSort(AxArrayRef<u64> keys, AxArrayRef<u32> values);
+	void radixSort(AxArrayRef<float> keys, AxArrayRef<u32> values);
+
+	/**
+	 * \brief Same as radixSort, but every pass builds its histograms and scatters the keys in parallel chunks.
+	 * Small inputs fall back to the single threaded sort.
+	 * \param num_threads 0 uses every hardware thread
+	 */
+	void parallelRadixSort(AxArrayRef<u32> keys, AxArrayRef<u32> values = {}, u32 num_threads = 0);
+	void parallelRadixSort(AxArrayRef<u64> keys, AxArrayRef<u32> values = {}, u32 num_threads = 0);
+	void parallelRadixSort(AxArrayRef<float> keys, AxArrayRef<u32> values = {}, u32 num_threads = 0);
+
+	template <typename Key, StorageType Storage>
+	void radixSort(AxArrayBase<Key, Storage>& keys)
+	{
+		radixSort(make_array_ref(keys));
+	}
+
+	template <typename Key, StorageType KeyStorage, StorageType ValueStorage>
+	void radixSort(AxArrayBase<Key, KeyStorage>& keys, AxArrayBase<u32, ValueStorage>& values)
+	{
+		radixSort(make_array_ref(keys), make_array_ref(values));
+	}
+
+}
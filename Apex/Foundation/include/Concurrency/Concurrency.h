@@ -2,6 +2,7 @@
 #include <mutex>
 
 #include "Core/Platform.h"
+#include "Core/Types.h"
 
 namespace apex {
 namespace concurrency {
@@ -185,6 +186,19 @@ namespace concurrency {
 	//	Lock1_t& m_lock1;
 	//};
 
+	using parallel_fn = void(*)(void* ctx, size_t begin, size_t end);
+
+	/**
+	 * \brief Splits [0, count) into contiguous batches and calls fn(ctx, begin, end) for each batch.
+	 * min_batch only limits how many batches are made (at most count / min_batch, rounded up), it does not guarantee
+	 * the size of every batch. Batches run on up to num_threads threads, including the calling thread (0 uses every
+	 * hardware thread).
+	 * Returns once every batch has finished.
+	 * \note There is no shared worker pool: every call that splits into more than one batch starts its own
+	 * std::threads and joins them before returning, so keep min_batch large enough to amortise the thread start-up.
+	 */
+	void parallelFor(size_t count, size_t min_batch, u32 num_threads, parallel_fn fn, void* ctx);
+
 }
 	namespace cncy = concurrency;
 }
@@ -0,0 +1,203 @@
+#pragma once
+#include <atomic>
+#include <memory>
+
+#include "Core/Types.h"
+#include "Memory/MemoryManager.h"
+
+namespace apex {
+namespace concurrency {
+
+	using reclaim_fn = void(*)(void*);
+
+	namespace detail
+	{
+		template <typename T>
+		void destroy_and_free(void* ptr)
+		{
+			if constexpr (!std::is_trivially_destructible_v<T>)
+				std::destroy_at(static_cast<T*>(ptr));
+			mem::MemoryManager::free(ptr);
+		}
+
+		struct RetiredPtr
+		{
+			void*      ptr;
+			reclaim_fn reclaim;
+			u64        epoch;
+		};
+	}
+
+	/**
+	 * \brief Epoch-based memory reclamation (EBR) for lock-free structures.
+	 *
+	 * Each participating thread owns a slot. A thread enters an epoch before touching
+	 * shared nodes and exits when done (once per job is typical). Nodes unlinked from a
+	 * structure are retired into the slot's limbo list and are freed in batches once
+	 * every active thread has observed an epoch at least two steps newer than the one
+	 * the node was retired in.
+	 *
+	 * Based on "Practical lock-freedom", Keir Fraser, 2004, Ch. 5.2.3
+	 */
+	class EpochManager
+	{
+	public:
+		static constexpr u32 kMaxThreads = 64;
+		static constexpr u32 kMaxRetiredPerThread = 256;
+		static constexpr u32 kCollectThreshold = 64;
+		static constexpr u32 kInvalidSlot = Constants::u32_MAX;
+
+		EpochManager() = default;
+		~EpochManager();
+
+		NON_COPYABLE(EpochManager);
+		NON_MOVABLE(EpochManager);
+
+		[[nodiscard]] u32 registerThread();
+		void unregisterThread(u32 slot);
+
+		void enter(u32 slot);
+		void exit(u32 slot);
+
+		/**
+		 * \brief Defers reclamation of ptr until no thread can hold a reference to it.
+		 * \param slot Slot of the calling thread.
+		 * \param ptr Pointer to an object already unlinked from all shared structures.
+		 * \param reclaim Function used to destroy and free ptr.
+		 */
+		void retire(u32 slot, void* ptr, reclaim_fn reclaim);
+
+		/**
+		 * \brief Retires an object allocated through mem::MemoryManager.
+		 * The destructor is run and the memory returned to the MemoryManager when safe.
+		 */
+		template <typename T>
+		void retire(u32 slot, T* ptr)
+		{
+			retire(slot, ptr, &detail::destroy_and_free<T>);
+		}
+
+		bool tryAdvance();
+		size_t collect(u32 slot);
+
+		/**
+		 * \brief Reclaims everything in every slot. Only valid when no thread is inside an epoch.
+		 */
+		void drain();
+
+		[[nodiscard]] u64 getGlobalEpoch() const { return m_globalEpoch.load(std::memory_order_relaxed); }
+		[[nodiscard]] u32 getRetiredCount(u32 slot) const { return m_records[slot].retiredCount; }
+
+	private:
+		static constexpr u64 kActiveBit = 1ull << 63;
+
+		struct alignas(64) ThreadRecord
+		{
+			std::atomic<u64>   localEpoch { 0 };
+			std::atomic<bool>  inUse { false };
+			u32                nesting { 0 };
+			u32                retiredCount { 0 };
+			detail::RetiredPtr retired[kMaxRetiredPerThread];
+		};
+
+		alignas(64) std::atomic<u64> m_globalEpoch { 1 };
+		alignas(64) std::atomic<u32> m_highWaterMark { 0 };
+		ThreadRecord m_records[kMaxThreads] {};
+	};
+
+	/**
+	 * \brief RAII guard that keeps the owning thread inside an epoch for its lifetime.
+	 */
+	struct EpochGuard
+	{
+		EpochGuard(EpochManager& manager, u32 slot) : m_manager(manager), m_slot(slot)
+		{
+			m_manager.enter(m_slot);
+		}
+
+		~EpochGuard()
+		{
+			m_manager.exit(m_slot);
+		}
+
+		NON_COPYABLE(EpochGuard);
+		NON_MOVABLE(EpochGuard);
+
+	private:
+		EpochManager& m_manager;
+		u32 m_slot;
+	};
+
+	/**
+	 * \brief Hazard pointers for references that are held for a long time (across jobs or frames),
+	 * where pinning a whole epoch would stall reclamation for every other thread.
+	 *
+	 * Based on "Hazard Pointers: Safe Memory Reclamation for Lock-Free Objects", Maged M. Michael, 2004
+	 */
+	class HazardPointerDomain
+	{
+	public:
+		static constexpr u32 kMaxThreads = EpochManager::kMaxThreads;
+		static constexpr u32 kHazardsPerThread = 4;
+		static constexpr u32 kMaxRetiredPerThread = 128;
+		static constexpr u32 kInvalidSlot = Constants::u32_MAX;
+
+		HazardPointerDomain() = default;
+		~HazardPointerDomain();
+
+		NON_COPYABLE(HazardPointerDomain);
+		NON_MOVABLE(HazardPointerDomain);
+
+		[[nodiscard]] u32 registerThread();
+		void unregisterThread(u32 slot);
+
+		/**
+		 * \brief Publishes a hazard on the value currently stored in src and returns it.
+		 * The returned pointer stays valid until clear() is called on the same hazard index.
+		 */
+		template <typename T>
+		T* protect(u32 slot, u32 index, std::atomic<T*> const& src)
+		{
+			T* ptr = src.load(std::memory_order_relaxed);
+			while (true)
+			{
+				SetHazard(slot, index, ptr);
+				T* reloaded = src.load(std::memory_order_acquire);
+				if (reloaded == ptr)
+					return ptr;
+				ptr = reloaded;
+			}
+		}
+
+		void clear(u32 slot, u32 index);
+
+		void retire(u32 slot, void* ptr, reclaim_fn reclaim);
+
+		template <typename T>
+		void retire(u32 slot, T* ptr)
+		{
+			retire(slot, ptr, &detail::destroy_and_free<T>);
+		}
+
+		size_t scan(u32 slot);
+
+		[[nodiscard]] u32 getRetiredCount(u32 slot) const { return m_records[slot].retiredCount; }
+
+	private:
+		void SetHazard(u32 slot, u32 index, void* ptr);
+		bool IsHazardous(void* ptr) const;
+
+		struct alignas(64) ThreadRecord
+		{
+			std::atomic<void*> hazards[kHazardsPerThread] {};
+			std::atomic<bool>  inUse { false };
+			u32                retiredCount { 0 };
+			detail::RetiredPtr retired[kMaxRetiredPerThread];
+		};
+
+		alignas(64) std::atomic<u32> m_highWaterMark { 0 };
+		ThreadRecord m_records[kMaxThreads] {};
+	};
+
+}
+}
@@ -1,16 +1,37 @@
 #pragma once
+#include <algorithm>
+
 #include "Core/Asserts.h"
+#include "Core/TypeTraits.h"
 #include "Core/Utility.h"
 #include "Memory/MemoryManager.h"
 
 namespace apex {
 
-	enum StorageType { Dynamic, Fixed, Static };
+	enum StorageType { Dynamic, Fixed, Static, Small };
+
+	namespace detail {
+
+		// Smallest capacity an empty container grows to, to skip the 1, 2, 3 ... reallocations on the first inserts
+		inline constexpr size_t kMinGrowCapacity = 4;
+
+		/**
+		 * \brief Geometric (1.5x) growth policy shared by the growable containers
+		 * \param capacity current capacity
+		 * \param min_capacity capacity that is required after growing
+		 */
+		[[nodiscard]] constexpr size_t CalculateGrowth(size_t capacity, size_t min_capacity)
+		{
+			const size_t geometric = capacity + capacity / 2 + 1;
+			return std::max({ geometric, min_capacity, kMinGrowCapacity });
+		}
+
+	}
 
 	 /// \brief Container of contiguous elements of the same type
-	 /// \details Defines common functionality across AxArray, AxDynamicArray, AxStaticArray
+	 /// \details Defines common functionality across AxArray, AxDynamicArray, AxStaticArray, AxSmallArray
 	 /// \tparam T Type of elements stored in the array
-	template <typename T, StorageType >
+	template <typename T, StorageType Storage>
 	class AxArrayBase
 	{
 		using ElemType = T;
@@ -77,20 +98,14 @@ namespace apex {
 			other.m_size = 0;
 		}
 
-		AxArrayBase(AxArrayBase const& other) noexcept
-		: m_capacity(other.m_capacity)
-		, m_size(other.m_size)
+		AxArrayBase(AxArrayBase const& other)
 		{
-			Allocate(m_capacity, m_size);
-			apex::memcpy_s<value_type>(m_data, m_size, other.m_data, other.m_size);
+			CopyConstructFrom(other.m_data, other.m_size);
 		}
 
 		AxArrayBase(std::initializer_list<value_type> init_list)
-		: m_capacity(init_list.size())
-		, m_size(init_list.size())
 		{
-			Allocate(m_capacity, m_size);
-			apex::memcpy_s<value_type>(m_data, m_size, init_list.begin(), init_list.size());
+			CopyConstructFrom(init_list.begin(), init_list.size());
 		}
 
 		~AxArrayBase()
@@ -103,6 +118,24 @@ namespace apex {
 		{
 			if (this != &other)
 			{
+				DestroyAll();
+
+				if constexpr (Storage == Small)
+				{
+					if (other.IsInline())
+					{
+						// Inline elements cannot be stolen, they are relocated into this array's storage instead
+						m_size = 0;
+						reserve(other.m_size);
+						RelocateFrom(other.m_data, other.m_size);
+						m_size = other.m_size;
+						other.m_size = 0;
+						return *this;
+					}
+				}
+
+				Deallocate();
+
 				m_capacity = std::move(other.m_capacity);
 				m_size = std::move(other.m_size);
 				m_data = std::move(other.m_data);
@@ -114,14 +147,18 @@ namespace apex {
 			return *this;
 		}
 
-		AxArrayBase& operator=(AxArrayBase const& other) noexcept
+		AxArrayBase& operator=(AxArrayBase const& other)
 		{
 			if (this != &other)
 			{
-				m_capacity = other.m_capacity;
-				m_size = other.m_size;
-				Allocate(m_capacity, m_size);
-				apex::memcpy_s<value_type>(m_data, m_size, other.m_data, other.m_size);
+				DestroyAll();
+				m_size = 0;
+				if (m_capacity < other.m_size)
+				{
+					Deallocate();
+					m_capacity = 0;
+				}
+				CopyConstructFrom(other.m_data, other.m_size);
 			}
 			return *this;
 		}
@@ -138,6 +175,10 @@ namespace apex {
 			{
 				Fill(m_data + oldSize, m_data + new_size, std::forward<Args>(args)...);
 			}
+			else
+			{
+				DestroyRange(m_data + new_size, oldSize - new_size);
+			}
 		}
 
 		void reserve(size_t capacity)
@@ -151,7 +192,10 @@ namespace apex {
 		template <typename... Args>
 		reference emplace_back(Args&&... args)
 		{
-			axAssertFmt(m_size < m_capacity, "Array size exceeds capacity!");
+			if (m_size == m_capacity)
+			{
+				return GrowAndEmplaceBack(std::forward<Args>(args)...);
+			}
 			ConstructInPlace(&m_data[m_size], std::forward<Args>(args)...);
 			return m_data[m_size++];
 		}
@@ -159,25 +203,41 @@ namespace apex {
 		template <typename... Args>
 		reference emplace(size_t index, Args&&... args)
 		{
-			axAssert(index < m_size + 1 && index < m_capacity);
-			axAssertFmt(m_size < m_capacity, "Array size exceeds capacity!");
+			axAssertFmt(index <= m_size, "Array insertion index in out of range!");
+			if (index == m_size)
+			{
+				return emplace_back(std::forward<Args>(args)...);
+			}
+
+			// args may alias an element of this array, so the new element is built before anything is moved
+			value_type elem(std::forward<Args>(args)...);
+			if (m_size == m_capacity)
+			{
+				Grow(m_size + 1);
+			}
 			// shift elements to the right from index upto size
 			ShiftElementsRight(index);
-			ConstructInPlace(&m_data[index], std::forward<Args>(args)...);
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				// the slot at index has been relocated away and holds no live object
+				ConstructInPlace(&m_data[index], std::move(elem));
+			}
+			else
+			{
+				m_data[index] = std::move(elem);
+			}
 			m_size++;
 			return m_data[index];
 		}
 
 		void append(const value_type& obj)
 		{
-			axAssertFmt(m_size < m_capacity, "Array size exceeds capacity!");
-			m_data[m_size++] = obj;
+			emplace_back(obj);
 		}
 
 		void append(value_type&& obj)
 		{
-			axAssertFmt(m_size < m_capacity, "Array size exceeds capacity!");
-			m_data[m_size++] = std::move(obj);
+			emplace_back(std::move(obj));
 		}
 
 		void pop_back()
@@ -189,23 +249,12 @@ namespace apex {
 
 		void insert(size_t index, const value_type& obj)
 		{
-			axAssertFmt(index < m_size + 1 && index < m_capacity, "Array insertion index in out of range!");
-			axAssertFmt(m_size < m_capacity, "Array size exceeds capacity!");
-			// shift elements to the right from index upto size
-			ShiftElementsRight(index);
-			m_data[index] = obj;
-			m_size++;
+			emplace(index, obj);
 		}
 
 		void insert(size_t index, value_type&& obj)
 		{
-			axAssertFmt(index < m_size + 1 && index < m_capacity, "Array insertion index in out of range!");
-			axAssertFmt(m_size < m_capacity, "Array size exceeds capacity!");
-			// shift elements to the right from index upto size
-			ShiftElementsRight(index);
-			// append(std::move(obj));
-			m_data[index] = std::move(obj);
-			m_size++;
+			emplace(index, std::move(obj));
 		}
 
 		// void emplace(size_t index, )
@@ -213,11 +262,20 @@ namespace apex {
 		void remove(size_t index)
 		{
 			axAssert(index < m_size);
-			// shift elements to left from index upto size
-			if (index < m_size - 1)
-				ShiftElementsLeft(index);
-			// pop last element
-			pop_back();
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				DestroyInPlace(&m_data[index]);
+				apex::memmove_s<ElemType>(&m_data[index], m_size - index - 1, &m_data[index + 1], m_size - index - 1);
+				m_size--;
+			}
+			else
+			{
+				// shift elements to left from index upto size
+				if (index < m_size - 1)
+					ShiftElementsLeft(index);
+				// pop last element
+				pop_back();
+			}
 		}
 
 		void reset()
@@ -230,8 +288,8 @@ namespace apex {
 
 		void clear()
 		{
-			m_size = 0;
 			DestroyAll();
+			m_size = 0;
 		}
 
 		[[nodiscard]] auto data() -> pointer              { return reinterpret_cast<ElemType*>(m_data); }
@@ -281,24 +339,80 @@ namespace apex {
 
 		void Deallocate()
 		{
-			mem::MemoryManager::free(m_data);
+			FreeData(m_data);
 			m_data = nullptr;
 		}
 
+		void FreeData(T* ptr)
+		{
+			if constexpr (Storage == Small)
+			{
+				if (ptr == InlineData())
+					return;
+			}
+			mem::MemoryManager::free(ptr);
+		}
+
+		/**
+		 * \brief Inline buffer of an AxSmallArray, which is laid out directly after this base object.
+		 * Computing it from `this` lets the code be shared by every inline capacity.
+		 */
+		[[nodiscard]] T* InlineData() const requires (Storage == Small)
+		{
+			constexpr size_t offset = (sizeof(AxArrayBase) + alignof(T) - 1) & ~(alignof(T) - 1);
+			return reinterpret_cast<T*>(const_cast<u8*>(reinterpret_cast<const u8*>(this)) + offset);
+		}
+
+		[[nodiscard]] bool IsInline() const requires (Storage == Small)
+		{
+			return m_data == InlineData();
+		}
+
 		void ReallocateAndMove(size_t new_capacity)
 		{
 			auto oldData = (T*)m_data;
 			auto oldSize = m_size;
-			auto oldCapacity = m_capacity;
 
 			Allocate(new_capacity, oldSize);
 
 			if (oldSize > 0) {
-				// MoveElementsFrom(oldData, oldSize);
-				MoveConstructFrom(oldData, oldSize);
+				RelocateFrom(oldData, oldSize);
 			}
 
-			mem::MemoryManager::free(oldData);
+			FreeData(oldData);
+		}
+
+		/**
+		 * \brief Geometric growth. The allocation is rounded up to the size of the pool block it lands in,
+		 * so the effective capacity is usually larger than the requested one
+		 */
+		[[nodiscard]] size_t CalculateGrowth(size_t min_capacity) const
+		{
+			return detail::CalculateGrowth(m_capacity, min_capacity);
+		}
+
+		void Grow(size_t min_capacity)
+		{
+			ReallocateAndMove(CalculateGrowth(min_capacity));
+		}
+
+		template <typename... Args>
+		reference GrowAndEmplaceBack(Args&&... args)
+		{
+			auto oldData = (T*)m_data;
+			auto oldSize = m_size;
+
+			Allocate(CalculateGrowth(oldSize + 1), oldSize);
+
+			// Construct the new element first since args may reference an element in the old buffer
+			ConstructInPlace(&m_data[oldSize], std::forward<Args>(args)...);
+
+			if (oldSize > 0) {
+				RelocateFrom(oldData, oldSize);
+			}
+
+			FreeData(oldData);
+			return m_data[m_size++];
 		}
 
 		void DestroyInPlace(T* ptr)
@@ -308,16 +422,27 @@ namespace apex {
 		}
 
 		void DestroyAll()
+		{
+			DestroyRange(m_data, m_size);
+		}
+
+		void DestroyRange(T* first, size_t count)
 		{
 			if constexpr (!std::is_trivially_destructible_v<T>)
-				for (size_t i = 0; i < m_size; ++i)
+				for (size_t i = 0; i < count; ++i)
 				{
-					DestroyInPlace(&m_data[m_size - i - 1]);
+					DestroyInPlace(&first[count - i - 1]);
 				}
 		}
 
 		void ShiftElementsRight(size_t start, size_t shift = 1)
 		{
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				apex::memmove_s<ElemType>(&m_data[start + shift], m_capacity - start - shift, &m_data[start], m_size - start);
+				return;
+			}
+
 			for (size_t i = 0; i < m_size - start; i++)
 			{
 				size_t dst = m_size + shift - i - 1;
@@ -331,7 +456,6 @@ namespace apex {
 					m_data[dst] = std::move(m_data[src]);
 				}
 			}
-			// apex::memmove_s<ElemType>(&m_data[index+1], m_capacity - index, &m_data[index], m_size - index);
 		}
 
 		void ShiftElementsLeft(size_t start, size_t shift = 1)
@@ -355,12 +479,53 @@ namespace apex {
 			}
 		}
 
+		/**
+		 * \brief Moves srcCount elements from src into the (uninitialized) start of this array and
+		 * ends the lifetime of the source elements
+		 */
+		void RelocateFrom(ElemType* src, size_t srcCount)
+		{
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				apex::memcpy_s<ElemType>(m_data, m_capacity, src, srcCount);
+			}
+			else
+			{
+				MoveConstructFrom(src, srcCount);
+				DestroyRange(src, srcCount);
+			}
+		}
+
+		void CopyConstructFrom(const ElemType* src, size_t srcCount)
+		{
+			if (srcCount == 0)
+				return;
+
+			if (m_capacity < srcCount)
+			{
+				Allocate(srcCount, 0);
+			}
+
+			if constexpr (std::is_trivially_copyable_v<T>)
+			{
+				apex::memcpy_s<ElemType>(m_data, m_capacity, src, srcCount);
+			}
+			else
+			{
+				for (size_t i = 0; i < srcCount; i++)
+				{
+					ConstructInPlace(&m_data[i], src[i]);
+				}
+			}
+			m_size = srcCount;
+		}
+
 		void MoveConstructFrom(ElemType* src, size_t srcCount)
 		{
 			const size_t count = std::min(srcCount, m_capacity);
 			for (size_t i = 0; i < count; i++)
 			{
-				ConstructInPlace(m_data[i], std::move(src[i]));
+				ConstructInPlace(&m_data[i], std::move(src[i]));
 			}
 		}
 
@@ -384,6 +549,9 @@ namespace apex {
 
 	template <typename T> using AxArray = AxArrayBase<T, Dynamic>;
 
+	template <typename T>
+	struct is_trivially_relocatable<AxArrayBase<T, Dynamic>> : std::true_type {};
+
 	// TODO: Implement AxArray<T, Static> and AxArray<T, Fixed>
 	// Static: statically or stack allocated storage
 
@@ -465,8 +633,8 @@ namespace apex {
 		return ref;
 	}
 
-	template <typename T>
-	auto make_array_ref(AxArray<T>& arr) -> AxArrayRef<T>
+	template <typename T, StorageType Storage>
+	auto make_array_ref(AxArrayBase<T, Storage>& arr) -> AxArrayRef<T>
 	{
 		AxArrayRef<T> ref;
 		ref._data = arr.data();
@@ -474,8 +642,8 @@ namespace apex {
 		return ref;
 	}
 
-	template <typename T>
-	auto make_array_ref(AxArray<T> const& arr) -> AxArrayRef<const T>
+	template <typename T, StorageType Storage>
+	auto make_array_ref(AxArrayBase<T, Storage> const& arr) -> AxArrayRef<const T>
 	{
 		AxArrayRef<const T> ref;
 		ref._data = arr.data();
@@ -483,69 +651,4 @@ namespace apex {
 		return ref;
 	}
 
-
-	/**
-	 * \brief Fixed size array
-	 * \tparam T type of elements stored in the array
-	 * \tparam Size number of elements in the array
-	 */
-	template <typename T, size_t Size>
-	struct AxStaticArray
-	{
-		T m_data[Size];
-		uint32_t m_size = Size;
-
-		[[nodiscard]] auto operator[](size_t index) -> T&
-		{
-			axAssert(index < Size);
-			return m_data[index];
-		}
-
-		[[nodiscard]] auto operator[](size_t index) const -> T const&
-		{
-			return const_cast<AxStaticArray* const>(this)->operator[](index);
-		}
-
-		[[nodiscard]] auto size() const -> size_t { return Size; }
-
-		[[nodiscard]] auto data() -> T* { return m_data; }
-		[[nodiscard]] auto data() const -> T const* { return m_data; }
-
-		[[nodiscard]] auto begin() -> T* { return m_data; }
-		[[nodiscard]] auto end() -> T* { return m_data + Size; }
-
-		[[nodiscard]] auto begin() const -> T const* { return m_data; }
-		[[nodiscard]] auto end() const -> T const* { return m_data + Size; }
-
-		[[nodiscard]] auto cbegin() const -> T const* { return m_data; }
-		[[nodiscard]] auto cend() const -> T const* { return m_data + Size; }
-
-		[[nodiscard]] auto getRef() -> AxArrayRef<T>
-		{
-			return make_array_ref(m_data, Size);
-		}
-
-		[[nodiscard]] auto getRef() const -> AxArrayRef<const T>
-		{
-			return make_array_ref(m_data, Size);
-		}
-	};
-
-	template <typename T, size_t Size>
-	auto make_array_ref(AxStaticArray<T, Size>& arr) -> AxArrayRef<T>
-	{
-		AxArrayRef<T> ref;
-		ref._data = arr.data();
-		ref.count = arr.size();
-		return ref;
-	}
-
-	template <typename T, size_t Size>
-	auto make_array_ref(AxStaticArray<T, Size> const& arr) -> AxArrayRef<const T>
-	{
-		AxArrayRef<const T> ref;
-		ref._data = arr.data();
-		ref.count = arr.size();
-		return ref;
-	}
 }
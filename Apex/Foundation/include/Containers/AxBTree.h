@@ -0,0 +1,889 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+#include "Containers/AxArray.h"
+#include "Containers/AxContainerPolicies.h"
+#include "Containers/AxRange.h"
+#include "Core/Asserts.h"
+#include "Core/TypeTraits.h"
+#include "Core/Types.h"
+#include "Memory/MemoryManager.h"
+
+namespace apex {
+namespace detail {
+
+	/**
+	 * \brief B+ tree with nodes of about four cache lines.
+	 * \details Elements live only in the leaves, which are linked in both directions, so iteration and range scans walk
+	 * contiguous arrays of slots. Inner nodes hold copies of separator keys: every key in children[i] is less than
+	 * keys[i], which is less than or equal to every key in children[i + 1].
+	 * Nodes hold one spare slot, so an insert into a full node is done in place before the node is split.
+	 * Erasing rebalances underfull nodes by borrowing from or merging with a sibling.
+	 * Any insertion or erasure invalidates iterators.
+	 */
+	template <typename Policy, typename Compare, typename Allocator>
+	class AxBTree
+	{
+	public:
+		using key_type = typename Policy::key_type;
+		using slot_type = typename Policy::slot_type;
+		using value_type = slot_type;
+		using key_compare = Compare;
+		using allocator_type = Allocator;
+		using size_type = size_t;
+
+		static constexpr size_t kTargetNodeSize = 256;
+
+	protected:
+		// Lookups accept any key type when the comparator is transparent
+		template <typename K>
+		using key_arg = typename KeyArg<transparent<Compare>>::template type<K, key_type>;
+
+		struct NodeBase
+		{
+			u16  count; // slots in a leaf, keys in an inner node
+			bool leaf;
+		};
+
+		static constexpr size_t kLeafCapacity = std::max<size_t>(3, (kTargetNodeSize - 3 * sizeof(void*)) / sizeof(slot_type) - 1);
+		static constexpr size_t kInnerCapacity = std::max<size_t>(3, (kTargetNodeSize - 2 * sizeof(void*)) / (sizeof(key_type) + sizeof(void*)) - 1);
+		static constexpr size_t kMinLeafCount = kLeafCapacity / 2;
+		static constexpr size_t kMinInnerCount = kInnerCapacity / 2;
+		static constexpr u32 kMaxHeight = 64;
+
+		struct LeafNode : NodeBase
+		{
+			LeafNode* prev;
+			LeafNode* next;
+			alignas(slot_type) u8 storage[(kLeafCapacity + 1) * sizeof(slot_type)];
+
+			slot_type* slots() { return reinterpret_cast<slot_type*>(storage); }
+		};
+
+		struct InnerNode : NodeBase
+		{
+			NodeBase* children[kInnerCapacity + 2];
+			alignas(key_type) u8 storage[(kInnerCapacity + 1) * sizeof(key_type)];
+
+			key_type* keys() { return reinterpret_cast<key_type*>(storage); }
+		};
+
+		using leaf_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<LeafNode>;
+		using inner_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<InnerNode>;
+
+		template <typename ValueType>
+		class Iterator
+		{
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = ValueType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			Iterator() = default;
+			Iterator(LeafNode* leaf, size_t index) : m_leaf(leaf), m_index(index) {}
+
+			// Allow conversion from non-const iterator to const iterator
+			template <typename OtherType> requires (std::is_const_v<ValueType> && !std::is_const_v<OtherType>)
+			Iterator(Iterator<OtherType> const& other) : m_leaf(other.m_leaf), m_index(other.m_index) {}
+
+			Iterator& operator++()
+			{
+				if (++m_index == m_leaf->count && m_leaf->next)
+				{
+					m_leaf = m_leaf->next;
+					m_index = 0;
+				}
+				return *this;
+			}
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			Iterator& operator--()
+			{
+				if (m_index == 0)
+				{
+					m_leaf = m_leaf->prev;
+					m_index = m_leaf->count;
+				}
+				--m_index;
+				return *this;
+			}
+			Iterator operator--(int) { Iterator tmp(*this); operator--(); return tmp; }
+
+			bool operator==(const Iterator& rhs) const { return m_leaf == rhs.m_leaf && m_index == rhs.m_index; }
+			bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+
+			reference operator*() const { return m_leaf->slots()[m_index]; }
+			pointer operator->() const { return m_leaf->slots() + m_index; }
+
+		private:
+			LeafNode* m_leaf {};
+			size_t m_index {};
+
+			template <typename> friend class Iterator;
+			friend class AxBTree;
+		};
+
+	public:
+		using iterator = Iterator<value_type>;
+		using const_iterator = Iterator<const value_type>;
+
+		AxBTree() = default;
+
+		explicit AxBTree(Compare const& comp, Allocator const& alloc = Allocator())
+		: m_comp(comp), m_alloc(alloc)
+		{}
+
+		explicit AxBTree(Allocator const& alloc) : m_alloc(alloc) {}
+
+		AxBTree(AxBTree const& other)
+		: m_comp(other.m_comp), m_alloc(other.m_alloc)
+		{
+			bulk_load(other.begin(), other.end());
+		}
+
+		AxBTree(AxBTree&& other) noexcept
+		: m_comp(std::move(other.m_comp)), m_alloc(std::move(other.m_alloc))
+		{
+			StealFrom(other);
+		}
+
+		~AxBTree()
+		{
+			clear();
+		}
+
+		AxBTree& operator=(AxBTree const& other)
+		{
+			if (this != &other)
+			{
+				m_comp = other.m_comp;
+				bulk_load(other.begin(), other.end());
+			}
+			return *this;
+		}
+
+		AxBTree& operator=(AxBTree&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clear();
+				m_comp = std::move(other.m_comp);
+				m_alloc = std::move(other.m_alloc);
+				StealFrom(other);
+			}
+			return *this;
+		}
+
+		/**
+		 * \brief Replaces the contents with the elements of [first, last), which must be sorted and unique.
+		 * Builds the tree bottom up with full nodes, which is much faster than inserting one by one
+		 * and gives the densest tree for read-mostly tables.
+		 */
+		template <typename ForwardIt>
+		void bulk_load(ForwardIt first, ForwardIt last)
+		{
+			clear();
+
+			const size_t count = static_cast<size_t>(std::distance(first, last));
+			if (count == 0)
+				return;
+
+			AxArray<NodeBase*> level;
+
+			// Spread the elements evenly so that no leaf is underfull
+			const size_t numLeaves = (count + kLeafCapacity - 1) / kLeafCapacity;
+			level.reserve(numLeaves);
+			for (size_t l = 0; l < numLeaves; l++)
+			{
+				LeafNode* leaf = NewLeaf();
+				const size_t leafCount = count / numLeaves + (l < count % numLeaves ? 1 : 0);
+				for (size_t i = 0; i < leafCount; ++i, ++first)
+				{
+					new (leaf->slots() + i) slot_type(*first);
+					leaf->count++;
+					axAssertFmt((i == 0 && !m_last) || m_comp(PrevKey(leaf, i), Policy::GetKey(leaf->slots()[i])), "bulk_load input must be sorted and unique");
+				}
+
+				leaf->prev = m_last;
+				if (m_last)
+					m_last->next = leaf;
+				else
+					m_first = leaf;
+				m_last = leaf;
+
+				level.append(leaf);
+			}
+			m_size = count;
+
+			// Build the inner levels until a single root remains
+			while (level.size() > 1)
+			{
+				const size_t numChildren = level.size();
+				const size_t numParents = (numChildren + kInnerCapacity) / (kInnerCapacity + 1);
+
+				size_t child = 0;
+				for (size_t p = 0; p < numParents; p++)
+				{
+					InnerNode* inner = NewInner();
+					const size_t childCount = numChildren / numParents + (p < numChildren % numParents ? 1 : 0);
+					for (size_t i = 0; i < childCount; i++, child++)
+					{
+						inner->children[i] = level[child];
+						if (i > 0)
+						{
+							new (inner->keys() + i - 1) key_type(MinKey(level[child]));
+						}
+					}
+					inner->count = static_cast<u16>(childCount - 1);
+					level[p] = inner;
+				}
+				level.resize(numParents);
+			}
+			m_root = level[0];
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] iterator find(key_arg<K> const& key)
+		{
+			iterator it = lower_bound(key);
+			return it != end() && !m_comp(key, Policy::GetKey(*it)) ? it : end();
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator find(key_arg<K> const& key) const
+		{
+			return const_cast<AxBTree*>(this)->find(key);
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] bool contains(key_arg<K> const& key) const
+		{
+			return find(key) != end();
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] size_t count(key_arg<K> const& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+
+		/**
+		 * \brief First element whose key is not less than key
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] iterator lower_bound(key_arg<K> const& key)
+		{
+			if (!m_root)
+				return end();
+
+			LeafNode* leaf = FindLeaf(key);
+			return MakeIterator(leaf, LowerBoundInLeaf(leaf, key));
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator lower_bound(key_arg<K> const& key) const
+		{
+			return const_cast<AxBTree*>(this)->lower_bound(key);
+		}
+
+		/**
+		 * \brief First element whose key is greater than key
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] iterator upper_bound(key_arg<K> const& key)
+		{
+			if (!m_root)
+				return end();
+
+			LeafNode* leaf = FindLeaf(key);
+			return MakeIterator(leaf, UpperBoundInLeaf(leaf, key));
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator upper_bound(key_arg<K> const& key) const
+		{
+			return const_cast<AxBTree*>(this)->upper_bound(key);
+		}
+
+		/**
+		 * \brief The elements with keys in [first, last)
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] auto range(key_arg<K> const& first, key_arg<K> const& last)
+		{
+			return ranges::AxRange<AxBTree, iterator>(lower_bound(first), lower_bound(last));
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] auto range(key_arg<K> const& first, key_arg<K> const& last) const
+		{
+			return ranges::AxRange<const AxBTree, const_iterator>(lower_bound(first), lower_bound(last));
+		}
+
+		template <typename K = key_type>
+		size_t erase(key_arg<K> const& key)
+		{
+			if (!m_root)
+				return 0;
+
+			PathEntry path[kMaxHeight];
+			u32 depth = 0;
+			LeafNode* leaf = FindLeaf(key, path, depth);
+
+			const size_t pos = LowerBoundInLeaf(leaf, key);
+			if (pos == leaf->count || m_comp(key, Policy::GetKey(leaf->slots()[pos])))
+				return 0;
+
+			std::destroy_at(leaf->slots() + pos);
+			ShiftLeft(leaf->slots(), leaf->count, pos);
+			leaf->count--;
+			m_size--;
+
+			RebalanceLeaf(path, depth, leaf);
+			return 1;
+		}
+
+		/**
+		 * \brief Erases the element at it
+		 * \return iterator to the next element
+		 */
+		iterator erase(const_iterator it)
+		{
+			axAssertFmt(it.m_leaf && it != cend(), "Cannot erase the end iterator");
+
+			const_iterator next = std::next(it);
+			if (next == cend())
+			{
+				erase(Policy::GetKey(*it));
+				return end();
+			}
+
+			// Rebalancing may move the next element, so find it again by key
+			key_type nextKey = Policy::GetKey(*next);
+			erase(Policy::GetKey(*it));
+			return lower_bound(nextKey);
+		}
+
+		// Exact match for non-const iterators, otherwise a transparent Compare makes the key overload win with K = iterator
+		iterator erase(iterator it)
+		{
+			return erase(const_iterator(it));
+		}
+
+		void clear()
+		{
+			if (m_root)
+			{
+				FreeSubtree(m_root);
+			}
+			m_root = nullptr;
+			m_first = m_last = nullptr;
+			m_size = 0;
+		}
+
+		[[nodiscard]] size_t size() const  { return m_size; }
+		[[nodiscard]] bool   empty() const { return m_size == 0; }
+
+		[[nodiscard]] key_compare key_comp() const { return m_comp; }
+		[[nodiscard]] allocator_type get_allocator() const { return allocator_type(m_alloc); }
+
+		[[nodiscard]] iterator begin() { return iterator(m_first, 0); }
+		[[nodiscard]] iterator end()   { return iterator(m_last, m_last ? m_last->count : 0); }
+
+		[[nodiscard]] const_iterator begin() const  { return const_cast<AxBTree*>(this)->begin(); }
+		[[nodiscard]] const_iterator end() const    { return const_cast<AxBTree*>(this)->end(); }
+		[[nodiscard]] const_iterator cbegin() const { return begin(); }
+		[[nodiscard]] const_iterator cend() const   { return end(); }
+
+	protected:
+		/**
+		 * \brief Finds key, or inserts a new element at its position by calling construct(slot_type*)
+		 * \return iterator to the element with key, and whether it was inserted
+		 */
+		template <typename K, typename Construct>
+		std::pair<iterator, bool> FindOrInsert(K const& key, Construct&& construct)
+		{
+			if (!m_root)
+			{
+				LeafNode* leaf = NewLeaf();
+				m_root = m_first = m_last = leaf;
+			}
+
+			PathEntry path[kMaxHeight];
+			u32 depth = 0;
+			LeafNode* leaf = FindLeaf(key, path, depth);
+
+			size_t pos = LowerBoundInLeaf(leaf, key);
+			if (pos < leaf->count && !m_comp(key, Policy::GetKey(leaf->slots()[pos])))
+				return { iterator(leaf, pos), false };
+
+			// Build the element before shifting, the arguments of construct may refer to elements of this leaf
+			alignas(slot_type) u8 storage[sizeof(slot_type)];
+			slot_type* element = reinterpret_cast<slot_type*>(storage);
+			construct(element);
+
+			ShiftRight(leaf->slots(), leaf->count, pos);
+			Relocate(leaf->slots() + pos, element);
+			leaf->count++;
+			m_size++;
+
+			if (leaf->count > kLeafCapacity)
+			{
+				LeafNode* right = SplitLeaf(leaf);
+				InsertIntoParent(path, depth, key_type(Policy::GetKey(right->slots()[0])), right);
+
+				if (pos >= leaf->count)
+				{
+					pos -= leaf->count;
+					leaf = right;
+				}
+			}
+			return { iterator(leaf, pos), true };
+		}
+
+	private:
+		struct PathEntry
+		{
+			InnerNode* node;
+			size_t child;
+		};
+
+		static LeafNode* AsLeaf(NodeBase* node)   { return static_cast<LeafNode*>(node); }
+		static InnerNode* AsInner(NodeBase* node) { return static_cast<InnerNode*>(node); }
+
+		iterator MakeIterator(LeafNode* leaf, size_t pos)
+		{
+			// Past the end of a leaf is the start of the next one
+			if (pos == leaf->count && leaf->next)
+				return iterator(leaf->next, 0);
+			return iterator(leaf, pos);
+		}
+
+		template <typename K>
+		size_t LowerBoundInLeaf(LeafNode* leaf, K const& key) const
+		{
+			size_t lo = 0, hi = leaf->count;
+			while (lo < hi)
+			{
+				const size_t mid = (lo + hi) / 2;
+				if (m_comp(Policy::GetKey(leaf->slots()[mid]), key))
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+			return lo;
+		}
+
+		template <typename K>
+		size_t UpperBoundInLeaf(LeafNode* leaf, K const& key) const
+		{
+			size_t lo = 0, hi = leaf->count;
+			while (lo < hi)
+			{
+				const size_t mid = (lo + hi) / 2;
+				if (m_comp(key, Policy::GetKey(leaf->slots()[mid])))
+					hi = mid;
+				else
+					lo = mid + 1;
+			}
+			return lo;
+		}
+
+		// Index of the child of an inner node whose subtree holds key: the number of separators not greater than key
+		template <typename K>
+		size_t ChildIndex(InnerNode* node, K const& key) const
+		{
+			size_t lo = 0, hi = node->count;
+			while (lo < hi)
+			{
+				const size_t mid = (lo + hi) / 2;
+				if (m_comp(key, node->keys()[mid]))
+					hi = mid;
+				else
+					lo = mid + 1;
+			}
+			return lo;
+		}
+
+		template <typename K>
+		LeafNode* FindLeaf(K const& key) const
+		{
+			NodeBase* node = m_root;
+			while (!node->leaf)
+			{
+				InnerNode* inner = AsInner(node);
+				node = inner->children[ChildIndex(inner, key)];
+			}
+			return AsLeaf(node);
+		}
+
+		// Same as FindLeaf, recording the inner nodes and child indices on the way down
+		template <typename K>
+		LeafNode* FindLeaf(K const& key, PathEntry* path, u32& depth) const
+		{
+			NodeBase* node = m_root;
+			while (!node->leaf)
+			{
+				axAssert(depth < kMaxHeight);
+				InnerNode* inner = AsInner(node);
+				const size_t child = ChildIndex(inner, key);
+				path[depth++] = { inner, child };
+				node = inner->children[child];
+			}
+			return AsLeaf(node);
+		}
+
+		static key_type const& MinKey(NodeBase* node)
+		{
+			while (!node->leaf)
+			{
+				node = AsInner(node)->children[0];
+			}
+			return Policy::GetKey(AsLeaf(node)->slots()[0]);
+		}
+
+		// Key of the element before slot i of leaf, which may be the last element of the previous leaf
+		key_type const& PrevKey(LeafNode* leaf, size_t i) const
+		{
+			return i > 0 ? Policy::GetKey(leaf->slots()[i - 1]) : Policy::GetKey(m_last->slots()[m_last->count - 1]);
+		}
+
+		// Moves the upper half of an overfull leaf to a new leaf on its right
+		LeafNode* SplitLeaf(LeafNode* leaf)
+		{
+			LeafNode* right = NewLeaf();
+			const size_t leftCount = leaf->count / 2;
+			MoveRange(right->slots(), leaf->slots() + leftCount, leaf->count - leftCount);
+			right->count = static_cast<u16>(leaf->count - leftCount);
+			leaf->count = static_cast<u16>(leftCount);
+
+			right->prev = leaf;
+			right->next = leaf->next;
+			if (leaf->next)
+				leaf->next->prev = right;
+			else
+				m_last = right;
+			leaf->next = right;
+			return right;
+		}
+
+		// Adds the separator and new right sibling of the node at path[depth] to its parent, splitting up the tree as needed
+		void InsertIntoParent(PathEntry* path, u32 depth, key_type separator, NodeBase* right)
+		{
+			while (depth > 0)
+			{
+				auto [parent, child] = path[--depth];
+
+				ShiftRight(parent->keys(), parent->count, child);
+				new (parent->keys() + child) key_type(std::move(separator));
+				ShiftRight(parent->children, parent->count + 1, child + 1);
+				parent->children[child + 1] = right;
+				parent->count++;
+
+				if (parent->count <= kInnerCapacity)
+					return;
+
+				// The middle key moves up, the keys and children after it go to a new right sibling
+				const size_t mid = parent->count / 2;
+				InnerNode* sibling = NewInner();
+				separator = std::move(parent->keys()[mid]);
+				std::destroy_at(parent->keys() + mid);
+				MoveRange(sibling->keys(), parent->keys() + mid + 1, parent->count - mid - 1);
+				MoveRange(sibling->children, parent->children + mid + 1, parent->count - mid);
+				sibling->count = static_cast<u16>(parent->count - mid - 1);
+				parent->count = static_cast<u16>(mid);
+				right = sibling;
+			}
+
+			// The root was split, grow the tree by one level
+			InnerNode* root = NewInner();
+			root->children[0] = m_root;
+			root->children[1] = right;
+			new (root->keys()) key_type(std::move(separator));
+			root->count = 1;
+			m_root = root;
+		}
+
+		void RebalanceLeaf(PathEntry* path, u32 depth, LeafNode* leaf)
+		{
+			if (depth == 0)
+			{
+				// The root leaf may hold any number of elements, free it once it is empty
+				if (leaf->count == 0)
+				{
+					FreeNode(leaf);
+					m_root = m_first = m_last = nullptr;
+				}
+				return;
+			}
+
+			if (leaf->count >= kMinLeafCount)
+				return;
+
+			auto [parent, child] = path[depth - 1];
+			LeafNode* left = child > 0 ? AsLeaf(parent->children[child - 1]) : nullptr;
+			LeafNode* right = child < parent->count ? AsLeaf(parent->children[child + 1]) : nullptr;
+
+			if (left && left->count > kMinLeafCount)
+			{
+				ShiftRight(leaf->slots(), leaf->count, 0);
+				MoveRange(leaf->slots(), left->slots() + left->count - 1, 1);
+				left->count--;
+				leaf->count++;
+				parent->keys()[child - 1] = Policy::GetKey(leaf->slots()[0]);
+				return;
+			}
+
+			if (right && right->count > kMinLeafCount)
+			{
+				MoveRange(leaf->slots() + leaf->count, right->slots(), 1);
+				ShiftLeft(right->slots(), right->count, 0);
+				right->count--;
+				leaf->count++;
+				parent->keys()[child] = Policy::GetKey(right->slots()[0]);
+				return;
+			}
+
+			if (left)
+			{
+				MergeLeaves(left, leaf);
+				RemoveFromInner(parent, child - 1);
+			}
+			else
+			{
+				MergeLeaves(leaf, right);
+				RemoveFromInner(parent, child);
+			}
+			RebalanceInner(path, depth - 1);
+		}
+
+		void RebalanceInner(PathEntry* path, u32 depth)
+		{
+			InnerNode* node = path[depth].node;
+			if (depth == 0)
+			{
+				// A root with a single child is replaced by the child
+				if (node->count == 0)
+				{
+					m_root = node->children[0];
+					FreeNode(node);
+				}
+				return;
+			}
+
+			if (node->count >= kMinInnerCount)
+				return;
+
+			auto [parent, child] = path[depth - 1];
+			InnerNode* left = child > 0 ? AsInner(parent->children[child - 1]) : nullptr;
+			InnerNode* right = child < parent->count ? AsInner(parent->children[child + 1]) : nullptr;
+
+			if (left && left->count > kMinInnerCount)
+			{
+				// Rotate the last child of the left sibling through the parent
+				ShiftRight(node->keys(), node->count, 0);
+				new (node->keys()) key_type(std::move(parent->keys()[child - 1]));
+				ShiftRight(node->children, node->count + 1, 0);
+				node->children[0] = left->children[left->count];
+				node->count++;
+
+				parent->keys()[child - 1] = std::move(left->keys()[left->count - 1]);
+				std::destroy_at(left->keys() + left->count - 1);
+				left->count--;
+				return;
+			}
+
+			if (right && right->count > kMinInnerCount)
+			{
+				// Rotate the first child of the right sibling through the parent
+				new (node->keys() + node->count) key_type(std::move(parent->keys()[child]));
+				node->children[node->count + 1] = right->children[0];
+				node->count++;
+
+				parent->keys()[child] = std::move(right->keys()[0]);
+				std::destroy_at(right->keys());
+				ShiftLeft(right->keys(), right->count, 0);
+				ShiftLeft(right->children, right->count + 1, 0);
+				right->count--;
+				return;
+			}
+
+			if (left)
+			{
+				MergeInner(left, node, parent, child - 1);
+			}
+			else
+			{
+				MergeInner(node, right, parent, child);
+			}
+			RebalanceInner(path, depth - 1);
+		}
+
+		void MergeLeaves(LeafNode* left, LeafNode* right)
+		{
+			MoveRange(left->slots() + left->count, right->slots(), right->count);
+			left->count += right->count;
+			right->count = 0;
+
+			left->next = right->next;
+			if (right->next)
+				right->next->prev = left;
+			else
+				m_last = left;
+			FreeNode(right);
+		}
+
+		// Pulls the separator down from the parent and appends the right node, then drops the right node from the parent
+		void MergeInner(InnerNode* left, InnerNode* right, InnerNode* parent, size_t separator)
+		{
+			new (left->keys() + left->count) key_type(std::move(parent->keys()[separator]));
+			MoveRange(left->keys() + left->count + 1, right->keys(), right->count);
+			MoveRange(left->children + left->count + 1, right->children, right->count + 1);
+			left->count += right->count + 1;
+			right->count = 0;
+			FreeNode(right);
+
+			RemoveFromInner(parent, separator);
+		}
+
+		// Removes keys[index] and children[index + 1]
+		static void RemoveFromInner(InnerNode* node, size_t index)
+		{
+			std::destroy_at(node->keys() + index);
+			ShiftLeft(node->keys(), node->count, index);
+			ShiftLeft(node->children, node->count + 1, index + 1);
+			node->count--;
+		}
+
+		// Moves count elements into uninitialized memory, leaving the source destroyed
+		template <typename T>
+		static void MoveRange(T* dst, T* src, size_t count)
+		{
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				std::memcpy(static_cast<void*>(dst), src, count * sizeof(T));
+			}
+			else
+			{
+				std::uninitialized_move_n(src, count, dst);
+				std::destroy_n(src, count);
+			}
+		}
+
+		// Moves [pos, count) one to the right, leaving an uninitialized hole at pos
+		template <typename T>
+		static void ShiftRight(T* base, size_t count, size_t pos)
+		{
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				std::memmove(static_cast<void*>(base + pos + 1), base + pos, (count - pos) * sizeof(T));
+			}
+			else
+			{
+				for (size_t i = count; i > pos; i--)
+				{
+					new (base + i) T(std::move(base[i - 1]));
+					std::destroy_at(base + i - 1);
+				}
+			}
+		}
+
+		// Moves the element at src into the uninitialized dst, leaving src uninitialized
+		template <typename T>
+		static void Relocate(T* dst, T* src)
+		{
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				std::memcpy(static_cast<void*>(dst), src, sizeof(T));
+			}
+			else
+			{
+				new (dst) T(std::move(*src));
+				std::destroy_at(src);
+			}
+		}
+
+		// Moves [pos + 1, count) one to the left, filling the uninitialized hole at pos
+		template <typename T>
+		static void ShiftLeft(T* base, size_t count, size_t pos)
+		{
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				std::memmove(static_cast<void*>(base + pos), base + pos + 1, (count - pos - 1) * sizeof(T));
+			}
+			else
+			{
+				for (size_t i = pos; i + 1 < count; i++)
+				{
+					new (base + i) T(std::move(base[i + 1]));
+					std::destroy_at(base + i + 1);
+				}
+			}
+		}
+
+		LeafNode* NewLeaf()
+		{
+			LeafNode* leaf = leaf_allocator(m_alloc).allocate(1);
+			leaf->count = 0;
+			leaf->leaf = true;
+			leaf->prev = leaf->next = nullptr;
+			return leaf;
+		}
+
+		InnerNode* NewInner()
+		{
+			InnerNode* inner = inner_allocator(m_alloc).allocate(1);
+			inner->count = 0;
+			inner->leaf = false;
+			return inner;
+		}
+
+		void FreeNode(LeafNode* leaf)   { leaf_allocator(m_alloc).deallocate(leaf, 1); }
+		void FreeNode(InnerNode* inner) { inner_allocator(m_alloc).deallocate(inner, 1); }
+
+		void FreeSubtree(NodeBase* node)
+		{
+			if (node->leaf)
+			{
+				LeafNode* leaf = AsLeaf(node);
+				std::destroy_n(leaf->slots(), leaf->count);
+				FreeNode(leaf);
+				return;
+			}
+
+			InnerNode* inner = AsInner(node);
+			for (size_t i = 0; i <= inner->count; i++)
+			{
+				FreeSubtree(inner->children[i]);
+			}
+			std::destroy_n(inner->keys(), inner->count);
+			FreeNode(inner);
+		}
+
+		void StealFrom(AxBTree& other)
+		{
+			m_root = std::exchange(other.m_root, nullptr);
+			m_first = std::exchange(other.m_first, nullptr);
+			m_last = std::exchange(other.m_last, nullptr);
+			m_size = std::exchange(other.m_size, 0);
+		}
+
+	protected:
+		key_compare m_comp {};
+
+	private:
+		Allocator  m_alloc {};
+		NodeBase*  m_root {};
+		LeafNode*  m_first {};
+		LeafNode*  m_last {};
+		size_t     m_size {};
+	};
+
+}
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include "Containers/AxBTree.h"
+
+namespace apex {
+
+	/**
+	 * \brief Ordered map stored in a B+ tree with cache line sized nodes.
+	 * \details Elements are stored as std::pair<KeyType, ValueType> in sorted arrays in the leaves, so in-order iteration
+	 * and range queries touch far fewer cache lines than a node based std::map. Lookups cost O(log n) with a binary
+	 * search per node. Iterators and pointers to elements are invalidated by any insertion or erasure.
+	 * Use bulk_load to build a read-mostly table from sorted data in O(n).
+	 * The key of an element must not be modified through an iterator.
+	 * \tparam KeyType type of the keys
+	 * \tparam ValueType type of the mapped values
+	 * \tparam Compare strict weak ordering of the keys. Transparent comparators (std::less<>) allow heterogeneous lookups
+	 * \tparam Allocator allocator for the tree nodes, e.g. mem::ArenaStdAllocator for per-frame maps
+	 */
+	template <
+		typename KeyType,
+		typename ValueType,
+		typename Compare = std::less<KeyType>,
+		typename Allocator = mem::StdAllocator<std::pair<KeyType, ValueType>>>
+	class AxBTreeMap : public detail::AxBTree<detail::MapPolicy<KeyType, ValueType>, Compare, Allocator>
+	{
+		using base_type = detail::AxBTree<detail::MapPolicy<KeyType, ValueType>, Compare, Allocator>;
+		using policy_type = detail::MapPolicy<KeyType, ValueType>;
+
+	public:
+		using typename base_type::key_type;
+		using typename base_type::value_type;
+		using typename base_type::iterator;
+		using typename base_type::const_iterator;
+		using mapped_type = ValueType;
+
+		using base_type::base_type;
+
+		/**
+		 * \brief Constructs the value from args if key is not present
+		 * \return iterator to the element with key, and whether it was inserted
+		 */
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+		{
+			return this->FindOrInsert(key, [&](value_type* slot)
+			{
+				policy_type::Construct(slot, std::forward<K>(key), std::forward<Args>(args)...);
+			});
+		}
+
+		std::pair<iterator, bool> insert(value_type const& value)
+		{
+			return try_emplace(value.first, value.second);
+		}
+
+		std::pair<iterator, bool> insert(value_type&& value)
+		{
+			return try_emplace(std::move(value.first), std::move(value.second));
+		}
+
+		template <typename K, typename M>
+		std::pair<iterator, bool> insert_or_assign(K&& key, M&& value)
+		{
+			auto result = try_emplace(std::forward<K>(key), std::forward<M>(value));
+			if (!result.second)
+			{
+				result.first->second = std::forward<M>(value);
+			}
+			return result;
+		}
+
+		template <typename K>
+		mapped_type& operator[](K&& key) requires std::is_default_constructible_v<mapped_type>
+		{
+			return try_emplace(std::forward<K>(key)).first->second;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] auto at(typename base_type::template key_arg<K> const& key) -> mapped_type&
+		{
+			auto it = this->find(key);
+			axAssertFmt(it != this->end(), "Key not found in btree map!");
+			return it->second;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] auto at(typename base_type::template key_arg<K> const& key) const -> const mapped_type&
+		{
+			return const_cast<AxBTreeMap*>(this)->at(key);
+		}
+
+		/**
+		 * \brief Returns a pointer to the value for key, or nullptr if it is not present
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] auto try_get(typename base_type::template key_arg<K> const& key) -> mapped_type*
+		{
+			auto it = this->find(key);
+			return it != this->end() ? &it->second : nullptr;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] auto try_get(typename base_type::template key_arg<K> const& key) const -> const mapped_type*
+		{
+			return const_cast<AxBTreeMap*>(this)->try_get(key);
+		}
+	};
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "Containers/AxBTree.h"
+
+namespace apex {
+
+	/**
+	 * \brief Ordered set stored in a B+ tree with cache line sized nodes. See AxBTreeMap for details.
+	 * Elements are immutable through iterators, since changing one would break the ordering.
+	 */
+	template <
+		typename KeyType,
+		typename Compare = std::less<KeyType>,
+		typename Allocator = mem::StdAllocator<KeyType>>
+	class AxBTreeSet : public detail::AxBTree<detail::SetPolicy<KeyType>, Compare, Allocator>
+	{
+		using base_type = detail::AxBTree<detail::SetPolicy<KeyType>, Compare, Allocator>;
+		using policy_type = detail::SetPolicy<KeyType>;
+
+		template <typename K>
+		using key_arg = typename base_type::template key_arg<K>;
+
+	public:
+		using typename base_type::key_type;
+		using typename base_type::value_type;
+		using iterator = typename base_type::const_iterator;
+		using const_iterator = typename base_type::const_iterator;
+
+		using base_type::base_type;
+
+		/**
+		 * \brief Inserts key if it is not present
+		 * \return iterator to the element equal to key, and whether it was inserted
+		 */
+		template <typename K>
+		std::pair<iterator, bool> insert(K&& key)
+		{
+			auto [it, inserted] = this->FindOrInsert(key, [&key](value_type* slot)
+			{
+				policy_type::Construct(slot, std::forward<K>(key));
+			});
+			return { it, inserted };
+		}
+
+		template <typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args)
+		{
+			return insert(key_type(std::forward<Args>(args)...));
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator find(key_arg<K> const& key) const { return base_type::find(key); }
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator lower_bound(key_arg<K> const& key) const { return base_type::lower_bound(key); }
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator upper_bound(key_arg<K> const& key) const { return base_type::upper_bound(key); }
+
+		template <typename K = key_type>
+		[[nodiscard]] auto range(key_arg<K> const& first, key_arg<K> const& last) const { return base_type::range(first, last); }
+
+		[[nodiscard]] const_iterator begin() const  { return base_type::cbegin(); }
+		[[nodiscard]] const_iterator end() const    { return base_type::cend(); }
+	};
+
+}
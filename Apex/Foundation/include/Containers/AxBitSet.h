@@ -0,0 +1,186 @@
+#pragma once
+#include <bit>
+
+#include "Containers/AxArray.h"
+#include "Core/Asserts.h"
+#include "Core/Types.h"
+
+namespace apex {
+
+	/**
+	 * \brief Dynamically sized two level bit set.
+	 * \details Bits are stored in 64-bit words. A summary level keeps one bit per word that is set when the word is non-zero,
+	 * so a summary word covers a block of 64 words (4096 bits).
+	 * Iteration and the bulk operations skip empty blocks and empty words through the summary, so sparse sets over large
+	 * key ranges stay cheap. Blocks that are populated on both sides are combined with SIMD.
+	 * Bits past size() are always zero.
+	 */
+	class AxBitSet
+	{
+	public:
+		static constexpr size_t kBitsPerWord = 64;
+		static constexpr size_t kWordsPerBlock = 64;
+		static constexpr size_t kNpos = Constants::u64_MAX;
+
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = size_t;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const size_t*;
+			using reference = size_t;
+
+			Iterator() = default;
+			Iterator(AxBitSet const* set, size_t bit) : m_set(set), m_bit(bit) {}
+
+			Iterator& operator++() { m_bit = m_set->findNext(m_bit + 1); return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			bool operator==(const Iterator& rhs) const { return m_bit == rhs.m_bit; }
+			bool operator!=(const Iterator& rhs) const { return m_bit != rhs.m_bit; }
+
+			reference operator*() const { return m_bit; }
+
+		private:
+			AxBitSet const* m_set {};
+			size_t m_bit { kNpos };
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+
+		AxBitSet() = default;
+
+		explicit AxBitSet(size_t num_bits)
+		{
+			resize(num_bits);
+		}
+
+		/**
+		 * \brief Changes the number of bits. New bits are cleared, bits past the new size are dropped
+		 */
+		void resize(size_t num_bits);
+
+		void set(size_t bit)
+		{
+			axAssert(bit < m_size);
+			const size_t wordIdx = bit / kBitsPerWord;
+			m_words[wordIdx] |= WordMask(bit);
+			m_summary[wordIdx / kWordsPerBlock] |= WordMask(wordIdx);
+		}
+
+		void set(size_t bit, bool value)
+		{
+			value ? set(bit) : reset(bit);
+		}
+
+		void reset(size_t bit)
+		{
+			axAssert(bit < m_size);
+			const size_t wordIdx = bit / kBitsPerWord;
+			u64& word = m_words[wordIdx];
+			word &= ~WordMask(bit);
+			if (word == 0)
+			{
+				m_summary[wordIdx / kWordsPerBlock] &= ~WordMask(wordIdx);
+			}
+		}
+
+		[[nodiscard]] bool test(size_t bit) const
+		{
+			return bit < m_size && (m_words[bit / kBitsPerWord] & WordMask(bit)) != 0;
+		}
+
+		[[nodiscard]] bool operator[](size_t bit) const { return test(bit); }
+
+		/**
+		 * \brief Clears every bit without changing the size. Only touches non-zero words
+		 */
+		void clear();
+
+		/**
+		 * \brief Sets every bit in [0, size())
+		 */
+		void setAll();
+
+		[[nodiscard]] size_t count() const;
+		[[nodiscard]] bool any() const;
+		[[nodiscard]] bool none() const { return !any(); }
+
+		/**
+		 * \brief Number of bits set in both this and other, without building the intersection
+		 */
+		[[nodiscard]] size_t countIntersection(AxBitSet const& other) const;
+		[[nodiscard]] bool intersects(AxBitSet const& other) const;
+
+		/**
+		 * \brief this = this & other. Bits past other.size() are cleared
+		 */
+		AxBitSet& operator&=(AxBitSet const& other);
+
+		/**
+		 * \brief this = this | other. Grows to other.size() if it is larger
+		 */
+		AxBitSet& operator|=(AxBitSet const& other);
+
+		/**
+		 * \brief this = this & ~other
+		 */
+		AxBitSet& andNot(AxBitSet const& other);
+
+		/**
+		 * \brief Returns the index of the first set bit at or after bit, or kNpos if there is none
+		 */
+		[[nodiscard]] size_t findNext(size_t bit) const;
+		[[nodiscard]] size_t findFirst() const { return findNext(0); }
+
+		/**
+		 * \brief Calls func(bit) for every set bit in ascending order.
+		 * Faster than the iterators since the word and summary scans stay in registers.
+		 */
+		template <typename Func>
+		void forEach(Func&& func) const
+		{
+			for (size_t blockIdx = 0; blockIdx < m_summary.size(); blockIdx++)
+			{
+				for (u64 summary = m_summary[blockIdx]; summary != 0; summary &= summary - 1)
+				{
+					const size_t wordIdx = blockIdx * kWordsPerBlock + std::countr_zero(summary);
+					for (u64 word = m_words[wordIdx]; word != 0; word &= word - 1)
+					{
+						func(wordIdx * kBitsPerWord + std::countr_zero(word));
+					}
+				}
+			}
+		}
+
+		[[nodiscard]] size_t size() const { return m_size; }
+		[[nodiscard]] bool   empty() const { return m_size == 0; }
+
+		[[nodiscard]] auto words() const -> AxArrayRef<const u64> { return make_array_ref(m_words); }
+
+		[[nodiscard]] iterator begin() const { return { this, findFirst() }; }
+		[[nodiscard]] iterator end() const { return { this, kNpos }; }
+
+		bool operator==(AxBitSet const& other) const;
+
+	private:
+		static constexpr u64 WordMask(size_t bit) { return u64(1) << (bit % kBitsPerWord); }
+
+		size_t NumBlocks() const { return m_summary.size(); }
+		size_t BlockWordCount(size_t block_idx) const { return std::min(kWordsPerBlock, m_words.size() - block_idx * kWordsPerBlock); }
+
+		// Recomputes the summary word of a block from its words
+		void RebuildSummary(size_t block_idx);
+
+		// Clears any bits past the size in the last word and rebuilds the summary of the last block
+		void TrimTail();
+
+	private:
+		AxArray<u64> m_words;   // bit i lives in m_words[i / 64]
+		AxArray<u64> m_summary; // bit j is set when m_words[j] != 0
+		size_t m_size {};
+	};
+
+}
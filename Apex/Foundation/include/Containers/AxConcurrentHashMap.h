@@ -0,0 +1,388 @@
+#pragma once
+#include <atomic>
+
+#include "Concurrency/Concurrency.h"
+#include "Concurrency/EpochReclamation.h"
+#include "Containers/AxHashTable.h"
+#include "Core/Asserts.h"
+#include "Memory/MemoryManager.h"
+
+namespace apex {
+
+	/**
+	 * \brief Hash map for caches that are shared between worker threads (assets, pipelines, shaders, interned strings).
+	 * \details Buckets are singly linked chains of nodes. Writers lock one of kNumStripes spin locks, picked by hash,
+	 * so inserts and erases of unrelated keys rarely contend. Readers take no locks: they walk the chains with acquire
+	 * loads and only retry a miss if a resize moved nodes while they were looking. A resize locks every stripe.
+	 *
+	 * find_or_insert constructs the value under the stripe lock after checking for the key again, so the value for a key
+	 * is constructed exactly once even when several threads race for it. Nodes never move in memory; erased nodes and
+	 * replaced bucket arrays are retired to an EpochManager, so a returned pointer stays valid as long as the calling thread
+	 * stays inside an epoch (or, for caches that never erase, for the lifetime of the map).
+	 *
+	 * Every operation takes the caller's EpochManager slot. The map only synchronises its own structure; concurrent access
+	 * to the values themselves is up to the caller.
+	 */
+	template <
+		typename KeyType,
+		typename ValueType,
+		typename Hash = AxHasher<KeyType>,
+		typename KeyEqual = AxKeyEqual<KeyType>>
+	class AxConcurrentHashMap
+	{
+	public:
+		using key_type = KeyType;
+		using mapped_type = ValueType;
+		using hasher = Hash;
+		using key_equal = KeyEqual;
+
+		static constexpr size_t kNumStripes = 64;
+		static constexpr size_t kMinBuckets = kNumStripes; // A bucket always maps to the same stripe as long as there are at least as many buckets
+
+	private:
+		template <typename K>
+		using key_arg = typename detail::KeyArg<detail::transparent<Hash> && detail::transparent<KeyEqual>>::template type<K, key_type>;
+
+		struct FactoryTag {};
+
+		struct Node
+		{
+			template <typename K, typename... Args>
+			Node(u64 hash, K&& key, Args&&... args)
+			: m_hash(hash), m_key(std::forward<K>(key)), m_value(std::forward<Args>(args)...)
+			{}
+
+			template <typename K, typename Factory>
+			Node(u64 hash, K&& key, FactoryTag, Factory&& factory)
+			: m_hash(hash), m_key(std::forward<K>(key)), m_value(factory())
+			{}
+
+			std::atomic<Node*> m_next {};
+			u64                m_hash;
+			key_type           m_key;
+			mapped_type        m_value;
+		};
+
+		// Header of the bucket array, the buckets follow in the same allocation
+		struct Table
+		{
+			size_t m_mask;
+
+			std::atomic<Node*>* buckets() { return reinterpret_cast<std::atomic<Node*>*>(this + 1); }
+			size_t bucketCount() const { return m_mask + 1; }
+		};
+
+		struct alignas(64) Stripe
+		{
+			concurrency::SpinLock m_lock;
+		};
+
+	public:
+		explicit AxConcurrentHashMap(concurrency::EpochManager& epochs, size_t bucket_count = kMinBuckets, Hash const& hash = Hash(), KeyEqual const& eq = KeyEqual())
+		: m_epochs(epochs), m_hash(hash), m_eq(eq)
+		{
+			m_table.store(AllocateTable(std::bit_ceil(std::max(bucket_count, kMinBuckets))), std::memory_order_relaxed);
+		}
+
+		/**
+		 * \brief Destroys every element. No other thread may access the map anymore
+		 */
+		~AxConcurrentHashMap()
+		{
+			clear();
+			mem::MemoryManager::free(m_table.load(std::memory_order_relaxed));
+		}
+
+		NON_COPYABLE(AxConcurrentHashMap);
+		NON_MOVABLE(AxConcurrentHashMap);
+
+		/**
+		 * \brief Lock-free lookup
+		 * \return pointer to the value for key, or nullptr if it is not present
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] mapped_type* find(u32 slot, key_arg<K> const& key) const
+		{
+			return find(slot, key, m_hash(key));
+		}
+
+		/**
+		 * \brief find with a hash that was computed earlier with hash_function()
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] mapped_type* find(u32 slot, key_arg<K> const& key, u64 hash) const
+		{
+			concurrency::EpochGuard guard(m_epochs, slot);
+			Node* node = FindNode(key, detail::MixHash(hash));
+			return node ? &node->m_value : nullptr;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] bool contains(u32 slot, key_arg<K> const& key) const
+		{
+			return find(slot, key) != nullptr;
+		}
+
+		/**
+		 * \brief Returns the value for key, constructing it with factory() if the key is not present.
+		 * factory is invoked at most once per key across all threads, while holding the key's stripe lock,
+		 * so it must not access this map.
+		 * \return pointer to the value for key, and whether this call inserted it
+		 */
+		template <typename K, typename Factory>
+		std::pair<mapped_type*, bool> find_or_insert(u32 slot, K&& key, Factory&& factory)
+		{
+			return FindOrInsert(slot, m_hash(key), std::forward<K>(key), FactoryTag{}, std::forward<Factory>(factory));
+		}
+
+		/**
+		 * \brief Returns the value for key, constructing it from args if the key is not present
+		 */
+		template <typename K, typename... Args>
+		std::pair<mapped_type*, bool> find_or_emplace(u32 slot, K&& key, Args&&... args)
+		{
+			return FindOrInsert(slot, m_hash(key), std::forward<K>(key), std::forward<Args>(args)...);
+		}
+
+		/**
+		 * \brief Unlinks key and retires its node. Readers that already found it keep a valid pointer until they leave their epoch
+		 * \return whether key was present
+		 */
+		template <typename K = key_type>
+		bool erase(u32 slot, key_arg<K> const& key)
+		{
+			const u64 hash = detail::MixHash(m_hash(key));
+
+			Node* erased = nullptr;
+			{
+				concurrency::LockGuard lock(StripeFor(hash));
+				Table* table = m_table.load(std::memory_order_relaxed);
+
+				std::atomic<Node*>* link = &table->buckets()[hash & table->m_mask];
+				for (Node* node = link->load(std::memory_order_relaxed); node; node = link->load(std::memory_order_relaxed))
+				{
+					if (node->m_hash == hash && m_eq(node->m_key, key))
+					{
+						// Readers standing on node still see its next pointer, so unlinking is a single store
+						link->store(node->m_next.load(std::memory_order_relaxed), std::memory_order_release);
+						erased = node;
+						break;
+					}
+					link = &node->m_next;
+				}
+			}
+
+			if (!erased)
+				return false;
+
+			m_size.fetch_sub(1, std::memory_order_relaxed);
+			m_epochs.retire(slot, erased);
+			return true;
+		}
+
+		/**
+		 * \brief Calls func(key, value) for every element. Blocks writers for the duration of the call
+		 */
+		template <typename Func>
+		void forEach(Func&& func)
+		{
+			LockAllStripes();
+			Table* table = m_table.load(std::memory_order_relaxed);
+			for (size_t i = 0; i < table->bucketCount(); i++)
+			{
+				for (Node* node = table->buckets()[i].load(std::memory_order_relaxed); node; node = node->m_next.load(std::memory_order_relaxed))
+				{
+					func(static_cast<key_type const&>(node->m_key), node->m_value);
+				}
+			}
+			UnlockAllStripes();
+		}
+
+		/**
+		 * \brief Destroys every element immediately. Not thread safe, no other thread may access the map during the call
+		 */
+		void clear()
+		{
+			Table* table = m_table.load(std::memory_order_relaxed);
+			for (size_t i = 0; i < table->bucketCount(); i++)
+			{
+				Node* node = table->buckets()[i].exchange(nullptr, std::memory_order_relaxed);
+				while (node)
+				{
+					Node* next = node->m_next.load(std::memory_order_relaxed);
+					DeleteNode(node);
+					node = next;
+				}
+			}
+			m_size.store(0, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] size_t size() const { return m_size.load(std::memory_order_relaxed); }
+		[[nodiscard]] bool   empty() const { return size() == 0; }
+		[[nodiscard]] size_t bucketCount() const { return m_table.load(std::memory_order_acquire)->bucketCount(); }
+
+		[[nodiscard]] hasher hash_function() const { return m_hash; }
+		[[nodiscard]] key_equal key_eq() const { return m_eq; }
+
+	private:
+		template <typename K>
+		Node* FindNode(K const& key, u64 hash) const
+		{
+			while (true)
+			{
+				// Resizes bump the sequence to odd while they relink nodes and back to even when done
+				const u64 seq = m_resizeSeq.load(std::memory_order_acquire);
+				if (seq & 1)
+				{
+					_THREAD_PAUSE();
+					continue;
+				}
+
+				Table* table = m_table.load(std::memory_order_acquire);
+				for (Node* node = table->buckets()[hash & table->m_mask].load(std::memory_order_acquire); node; node = node->m_next.load(std::memory_order_acquire))
+				{
+					if (node->m_hash == hash && m_eq(node->m_key, key))
+						return node;
+				}
+
+				// A hit is always genuine, but a miss is only trusted if no resize moved nodes under us
+				std::atomic_thread_fence(std::memory_order_acquire);
+				if (m_resizeSeq.load(std::memory_order_relaxed) == seq)
+					return nullptr;
+			}
+		}
+
+		template <typename K, typename... Args>
+		std::pair<mapped_type*, bool> FindOrInsert(u32 slot, u64 rawHash, K&& key, Args&&... args)
+		{
+			const u64 hash = detail::MixHash(rawHash);
+
+			size_t growFrom = 0;
+			Node* inserted;
+			{
+				concurrency::EpochGuard guard(m_epochs, slot);
+				if (Node* node = FindNode(key, hash))
+					return { &node->m_value, false };
+
+				concurrency::LockGuard lock(StripeFor(hash));
+				Table* table = m_table.load(std::memory_order_relaxed);
+				std::atomic<Node*>& bucket = table->buckets()[hash & table->m_mask];
+
+				// Another thread may have inserted the key between the lookup and taking the lock
+				Node* head = bucket.load(std::memory_order_relaxed);
+				for (Node* node = head; node; node = node->m_next.load(std::memory_order_relaxed))
+				{
+					if (node->m_hash == hash && m_eq(node->m_key, key))
+						return { &node->m_value, false };
+				}
+
+				inserted = NewNode(hash, std::forward<K>(key), std::forward<Args>(args)...);
+				inserted->m_next.store(head, std::memory_order_relaxed);
+				bucket.store(inserted, std::memory_order_release);
+
+				if (m_size.fetch_add(1, std::memory_order_relaxed) + 1 > table->bucketCount())
+				{
+					growFrom = table->bucketCount();
+				}
+			}
+
+			if (growFrom)
+			{
+				Grow(slot, growFrom);
+			}
+			return { &inserted->m_value, true };
+		}
+
+		void Grow(u32 slot, size_t old_bucket_count)
+		{
+			LockAllStripes();
+
+			Table* oldTable = m_table.load(std::memory_order_relaxed);
+			if (oldTable->bucketCount() != old_bucket_count)
+			{
+				// Another thread grew the table first
+				UnlockAllStripes();
+				return;
+			}
+
+			Table* newTable = AllocateTable(old_bucket_count * 2);
+
+			const u64 seq = m_resizeSeq.load(std::memory_order_relaxed);
+			m_resizeSeq.store(seq + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+
+			// Nodes are relinked, not copied, so pointers handed out earlier stay valid
+			for (size_t i = 0; i < oldTable->bucketCount(); i++)
+			{
+				Node* node = oldTable->buckets()[i].load(std::memory_order_relaxed);
+				while (node)
+				{
+					Node* next = node->m_next.load(std::memory_order_relaxed);
+					std::atomic<Node*>& bucket = newTable->buckets()[node->m_hash & newTable->m_mask];
+					node->m_next.store(bucket.load(std::memory_order_relaxed), std::memory_order_release);
+					bucket.store(node, std::memory_order_release);
+					node = next;
+				}
+			}
+
+			m_table.store(newTable, std::memory_order_release);
+			m_resizeSeq.store(seq + 2, std::memory_order_release);
+
+			UnlockAllStripes();
+
+			// Readers may still be walking the old bucket array
+			m_epochs.retire(slot, oldTable);
+		}
+
+		static Table* AllocateTable(size_t bucket_count)
+		{
+			axAssert(std::has_single_bit(bucket_count) && bucket_count >= kMinBuckets);
+
+			void* mem = mem::MemoryManager::allocate(sizeof(Table) + bucket_count * sizeof(std::atomic<Node*>));
+			Table* table = new (mem) Table { bucket_count - 1 };
+			for (size_t i = 0; i < bucket_count; i++)
+			{
+				new (table->buckets() + i) std::atomic<Node*>(nullptr);
+			}
+			return table;
+		}
+
+		template <typename... Args>
+		static Node* NewNode(Args&&... args)
+		{
+			void* mem = mem::MemoryManager::allocate(sizeof(Node));
+			return new (mem) Node(std::forward<Args>(args)...);
+		}
+
+		static void DeleteNode(Node* node)
+		{
+			node->~Node();
+			mem::MemoryManager::free(node);
+		}
+
+		concurrency::SpinLock& StripeFor(u64 hash) const { return m_stripes[hash & (kNumStripes - 1)].m_lock; }
+
+		void LockAllStripes() const
+		{
+			for (Stripe& stripe : m_stripes)
+				stripe.m_lock.lock();
+		}
+
+		void UnlockAllStripes() const
+		{
+			for (Stripe& stripe : m_stripes)
+				stripe.m_lock.unlock();
+		}
+
+	private:
+		concurrency::EpochManager& m_epochs;
+		hasher    m_hash;
+		key_equal m_eq;
+
+		alignas(64) std::atomic<Table*> m_table {};
+		std::atomic<u64>                m_resizeSeq {};
+		alignas(64) std::atomic<size_t> m_size {};
+		mutable Stripe                  m_stripes[kNumStripes];
+	};
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <new>
+#include <tuple>
+#include <utility>
+
+namespace apex {
+namespace detail {
+
+	// Slot policies shared by the associative containers. A policy defines the stored slot type, how to get the key
+	// of a slot and how to construct a slot from a key and arguments.
+
+	template <typename Key, typename Value>
+	struct MapPolicy
+	{
+		using key_type = Key;
+		using slot_type = std::pair<Key, Value>;
+
+		static const Key& GetKey(slot_type const& slot) { return slot.first; }
+
+		template <typename K, typename... Args>
+		static void Construct(slot_type* slot, K&& key, Args&&... args)
+		{
+			new (slot) slot_type(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+	};
+
+	template <typename Key>
+	struct SetPolicy
+	{
+		using key_type = Key;
+		using slot_type = Key;
+
+		static const Key& GetKey(slot_type const& slot) { return slot; }
+
+		template <typename K>
+		static void Construct(slot_type* slot, K&& key)
+		{
+			new (slot) slot_type(std::forward<K>(key));
+		}
+	};
+
+	template <typename T>
+	concept transparent = requires { typename T::is_transparent; };
+
+	template <bool Transparent>
+	struct KeyArg
+	{
+		template <typename K, typename Key>
+		using type = Key;
+	};
+
+	template <>
+	struct KeyArg<true>
+	{
+		template <typename K, typename Key>
+		using type = K;
+	};
+
+}
+}
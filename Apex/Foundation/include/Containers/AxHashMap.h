@@ -2,6 +2,9 @@
 #include <optional>
 #include <unordered_dense.h>
 
+#include "Containers/AxHashTable.h"
+#include "Memory/MemoryManager.h"
+
 namespace apex {
 
 	template <
@@ -11,4 +14,120 @@ namespace apex {
 		typename KeyEqual = std::equal_to<KeyType>>
 	using AxDenseHashMap = ankerl::unordered_dense::map<KeyType, ValueType, Hasher, KeyEqual, mem::StdAllocator<std::pair<KeyType, ValueType>>>;
 
+	/**
+	 * \brief Open addressing hash map with SIMD group probing (SwissTable layout).
+	 * \details Elements are stored as std::pair<KeyType, ValueType> directly in the table, so pointers and iterators
+	 * are invalidated by any insertion that rehashes. The key of an element must not be modified through an iterator.
+	 * With a transparent hasher and comparator (the default for string keys) lookups take any compatible key type,
+	 * e.g. an AxStringView for an AxHashString key, without constructing a key.
+	 * Hashes computed with hash_function() can be passed back to find, contains and try_emplace_hashed.
+	 * \tparam KeyType type of the keys
+	 * \tparam ValueType type of the mapped values
+	 * \tparam Hash hash function, see AxHasher
+	 * \tparam KeyEqual key comparator, see AxKeyEqual
+	 * \tparam Allocator allocator for the table memory, e.g. mem::ArenaStdAllocator for per-frame maps
+	 */
+	template <
+		typename KeyType,
+		typename ValueType,
+		typename Hash = AxHasher<KeyType>,
+		typename KeyEqual = AxKeyEqual<KeyType>,
+		typename Allocator = mem::StdAllocator<std::pair<KeyType, ValueType>>>
+	class AxHashMap : public detail::AxHashTable<detail::MapPolicy<KeyType, ValueType>, Hash, KeyEqual, Allocator>
+	{
+		using base_type = detail::AxHashTable<detail::MapPolicy<KeyType, ValueType>, Hash, KeyEqual, Allocator>;
+		using policy_type = detail::MapPolicy<KeyType, ValueType>;
+
+	public:
+		using typename base_type::key_type;
+		using typename base_type::value_type;
+		using typename base_type::iterator;
+		using typename base_type::const_iterator;
+		using mapped_type = ValueType;
+
+		using base_type::base_type;
+
+		/**
+		 * \brief Constructs the value from args if key is not present
+		 * \return iterator to the element with key, and whether it was inserted
+		 */
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+		{
+			const u64 hash = this->m_hash(key);
+			return try_emplace_hashed(hash, std::forward<K>(key), std::forward<Args>(args)...);
+		}
+
+		/**
+		 * \brief try_emplace with a hash that was computed earlier with hash_function()
+		 */
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> try_emplace_hashed(u64 hash, K&& key, Args&&... args)
+		{
+			auto [index, inserted] = this->FindOrPrepareInsert(key, hash);
+			if (inserted)
+			{
+				policy_type::Construct(this->SlotAt(index), std::forward<K>(key), std::forward<Args>(args)...);
+			}
+			return { this->IteratorAt(index), inserted };
+		}
+
+		std::pair<iterator, bool> insert(value_type const& value)
+		{
+			return try_emplace(value.first, value.second);
+		}
+
+		std::pair<iterator, bool> insert(value_type&& value)
+		{
+			return try_emplace(std::move(value.first), std::move(value.second));
+		}
+
+		template <typename K, typename M>
+		std::pair<iterator, bool> insert_or_assign(K&& key, M&& value)
+		{
+			auto result = try_emplace(std::forward<K>(key), std::forward<M>(value));
+			if (!result.second)
+			{
+				result.first->second = std::forward<M>(value);
+			}
+			return result;
+		}
+
+		template <typename K>
+		mapped_type& operator[](K&& key) requires std::is_default_constructible_v<mapped_type>
+		{
+			return try_emplace(std::forward<K>(key)).first->second;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] auto at(typename base_type::template key_arg<K> const& key) -> mapped_type&
+		{
+			auto it = this->find(key);
+			axAssertFmt(it != this->end(), "Key not found in hash map!");
+			return it->second;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] auto at(typename base_type::template key_arg<K> const& key) const -> const mapped_type&
+		{
+			return const_cast<AxHashMap*>(this)->at(key);
+		}
+
+		/**
+		 * \brief Returns a pointer to the value for key, or nullptr if it is not present
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] auto try_get(typename base_type::template key_arg<K> const& key) -> mapped_type*
+		{
+			auto it = this->find(key);
+			return it != this->end() ? &it->second : nullptr;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] auto try_get(typename base_type::template key_arg<K> const& key) const -> const mapped_type*
+		{
+			return const_cast<AxHashMap*>(this)->try_get(key);
+		}
+	};
+
 }
@@ -0,0 +1,72 @@
+#pragma once
+#include "Containers/AxHashTable.h"
+
+namespace apex {
+
+	/**
+	 * \brief Open addressing hash set with SIMD group probing (SwissTable layout). See AxHashMap for details.
+	 * Elements are immutable through iterators, since changing one would change its hash.
+	 */
+	template <
+		typename KeyType,
+		typename Hash = AxHasher<KeyType>,
+		typename KeyEqual = AxKeyEqual<KeyType>,
+		typename Allocator = mem::StdAllocator<KeyType>>
+	class AxHashSet : public detail::AxHashTable<detail::SetPolicy<KeyType>, Hash, KeyEqual, Allocator>
+	{
+		using base_type = detail::AxHashTable<detail::SetPolicy<KeyType>, Hash, KeyEqual, Allocator>;
+		using policy_type = detail::SetPolicy<KeyType>;
+
+		template <typename K>
+		using key_arg = typename base_type::template key_arg<K>;
+
+	public:
+		using typename base_type::key_type;
+		using typename base_type::value_type;
+		using iterator = typename base_type::const_iterator;
+		using const_iterator = typename base_type::const_iterator;
+
+		using base_type::base_type;
+
+		/**
+		 * \brief Inserts key if it is not present
+		 * \return iterator to the element equal to key, and whether it was inserted
+		 */
+		template <typename K>
+		std::pair<iterator, bool> insert(K&& key)
+		{
+			const u64 hash = this->m_hash(key);
+			return insert_hashed(hash, std::forward<K>(key));
+		}
+
+		/**
+		 * \brief insert with a hash that was computed earlier with hash_function()
+		 */
+		template <typename K>
+		std::pair<iterator, bool> insert_hashed(u64 hash, K&& key)
+		{
+			auto [index, inserted] = this->FindOrPrepareInsert(key, hash);
+			if (inserted)
+			{
+				policy_type::Construct(this->SlotAt(index), std::forward<K>(key));
+			}
+			return { this->IteratorAt(index), inserted };
+		}
+
+		template <typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args)
+		{
+			return insert(key_type(std::forward<Args>(args)...));
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator find(key_arg<K> const& key) const { return base_type::find(key); }
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator find(key_arg<K> const& key, u64 hash) const { return base_type::find(key, hash); }
+
+		[[nodiscard]] const_iterator begin() const  { return base_type::cbegin(); }
+		[[nodiscard]] const_iterator end() const    { return base_type::cend(); }
+	};
+
+}
@@ -0,0 +1,728 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <tuple>
+
+#include "Containers/AxContainerPolicies.h"
+#include "Core/Asserts.h"
+#include "Core/Platform.h"
+#include "Core/TypeTraits.h"
+#include "Core/Types.h"
+#include "Memory/MemoryManager.h"
+#include "String/AxHashString.h"
+#include "String/AxStringView.h"
+
+namespace apex {
+
+	class AxString;
+
+	/**
+	 * \brief Default hash function for AxHashMap and AxHashSet.
+	 * Hashers only have to be cheap and deterministic; the table runs every hash through a finalizer before use,
+	 * so the identity hash for integers is fine.
+	 */
+	template <typename T>
+	struct AxHasher
+	{
+		[[nodiscard]] constexpr u64 operator()(T const& value) const noexcept requires (std::is_integral_v<T> || std::is_enum_v<T>)
+		{
+			return static_cast<u64>(value);
+		}
+
+		[[nodiscard]] u64 operator()(T const& value) const noexcept requires std::is_pointer_v<T>
+		{
+			return reinterpret_cast<uintptr_t>(value);
+		}
+	};
+
+	/**
+	 * \brief Transparent string hasher. Hashes every string type with the AxHashString hasher, so a lookup by AxStringView
+	 * finds an AxHashString key, and AxHashString keys reuse the hash they already carry.
+	 */
+	struct AxStringHasher
+	{
+		using is_transparent = void;
+
+		[[nodiscard]] constexpr u64 operator()(AxStringView str) const noexcept { return AxHashString::HasherType::Hash(str); }
+		[[nodiscard]] constexpr u64 operator()(AxHashString const& str) const noexcept { return str.GetHash(); }
+	};
+
+	struct AxStringEqual
+	{
+		using is_transparent = void;
+
+		[[nodiscard]] constexpr bool operator()(AxStringView l, AxStringView r) const noexcept { return l == r; }
+		[[nodiscard]] constexpr bool operator()(AxHashString const& l, AxHashString const& r) const noexcept { return l == r; }
+		[[nodiscard]] constexpr bool operator()(AxHashString const& l, AxStringView r) const noexcept { return l.GetStr() == r; }
+		[[nodiscard]] constexpr bool operator()(AxStringView l, AxHashString const& r) const noexcept { return l == r.GetStr(); }
+	};
+
+	template <> struct AxHasher<AxString> : AxStringHasher {};
+	template <> struct AxHasher<AxStringView> : AxStringHasher {};
+	template <> struct AxHasher<AxHashString> : AxStringHasher {};
+
+	template <> struct AxHasher<AxHash>
+	{
+		[[nodiscard]] constexpr u64 operator()(AxHash const& hash) const noexcept { return hash.GetHash(); }
+	};
+
+	template <typename T>
+	struct AxKeyEqual : std::equal_to<T> {};
+
+	template <> struct AxKeyEqual<AxString> : AxStringEqual {};
+	template <> struct AxKeyEqual<AxStringView> : AxStringEqual {};
+	template <> struct AxKeyEqual<AxHashString> : AxStringEqual {};
+
+namespace detail {
+
+	/**
+	 * Control bytes, one per slot:
+	 *   0b0hhhhhhh full, h is the low 7 bits of the hash
+	 *   0b10000000 empty
+	 *   0b11111110 deleted
+	 * Full bytes are the only non-negative values, which is what the SIMD matches rely on.
+	 */
+	using ctrl_t = s8;
+	static constexpr ctrl_t kCtrlEmpty   = static_cast<ctrl_t>(0b10000000);
+	static constexpr ctrl_t kCtrlDeleted = static_cast<ctrl_t>(0b11111110);
+
+	constexpr bool IsFull(ctrl_t ctrl) { return ctrl >= 0; }
+
+	// Iterable set of slot offsets within a group
+	template <typename MaskType, u32 Shift>
+	class GroupMask
+	{
+	public:
+		constexpr explicit GroupMask(MaskType mask) : m_mask(mask) {}
+
+		constexpr explicit operator bool() const { return m_mask != 0; }
+		constexpr u32 lowest() const { return static_cast<u32>(std::countr_zero(m_mask)) >> Shift; }
+
+		constexpr GroupMask& operator++() { m_mask &= m_mask - 1; return *this; }
+		constexpr u32 operator*() const { return lowest(); }
+		constexpr bool operator!=(GroupMask const& other) const { return m_mask != other.m_mask; }
+
+		constexpr GroupMask begin() const { return *this; }
+		constexpr GroupMask end() const { return GroupMask(0); }
+
+	private:
+		MaskType m_mask;
+	};
+
+#if defined(APEX_ARCH_X86)
+	// 16 control bytes compared at once with SSE2
+	struct Group
+	{
+		static constexpr size_t kWidth = 16;
+		using mask_type = GroupMask<u32, 0>;
+
+		explicit Group(const ctrl_t* pos) : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+		mask_type match(u8 h2) const
+		{
+			return mask_type(static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), m_ctrl))));
+		}
+
+		mask_type matchEmpty() const
+		{
+			return mask_type(static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kCtrlEmpty), m_ctrl))));
+		}
+
+		// empty and deleted are the only values below -1
+		mask_type matchEmptyOrDeleted() const
+		{
+			return mask_type(static_cast<u32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), m_ctrl))));
+		}
+
+		mask_type matchFull() const
+		{
+			return mask_type(static_cast<u32>(_mm_movemask_epi8(m_ctrl)) ^ 0xffff);
+		}
+
+		__m128i m_ctrl;
+	};
+#else
+	// 8 control bytes compared at once with 64-bit integer arithmetic. Each match sets the high bit of the matching bytes.
+	// match() may report a false positive on the byte after a real match, which the key comparison filters out.
+	struct Group
+	{
+		static constexpr size_t kWidth = 8;
+		using mask_type = GroupMask<u64, 3>;
+
+		static constexpr u64 kLsbs = 0x0101010101010101ull;
+		static constexpr u64 kMsbs = 0x8080808080808080ull;
+
+		explicit Group(const ctrl_t* pos) { std::memcpy(&m_ctrl, pos, sizeof(m_ctrl)); }
+
+		mask_type match(u8 h2) const
+		{
+			const u64 x = m_ctrl ^ (kLsbs * h2);
+			return mask_type((x - kLsbs) & ~x & kMsbs);
+		}
+
+		mask_type matchEmpty() const          { return mask_type(m_ctrl & ~(m_ctrl << 6) & kMsbs); }
+		mask_type matchEmptyOrDeleted() const { return mask_type(m_ctrl & ~(m_ctrl << 7) & kMsbs); }
+		mask_type matchFull() const           { return mask_type(~m_ctrl & kMsbs); }
+
+		u64 m_ctrl;
+	};
+#endif
+
+	// Bits of the finalized hash: low 7 bits go into the control byte, the rest pick the probe start
+	constexpr u64 MixHash(u64 hash)
+	{
+		// MurmurHash3 fmix64
+		hash ^= hash >> 33;
+		hash *= 0xff51afd7ed558ccdull;
+		hash ^= hash >> 33;
+		hash *= 0xc4ceb9fe1a85ec53ull;
+		hash ^= hash >> 33;
+		return hash;
+	}
+
+	constexpr u8  H2(u64 hash) { return static_cast<u8>(hash & 0x7f); }
+	constexpr u64 H1(u64 hash) { return hash >> 7; }
+
+	// Triangular probing over groups. Visits every group exactly once when the capacity is a power of two
+	struct ProbeSeq
+	{
+		ProbeSeq(u64 h1, size_t mask) : m_mask(mask), m_offset(h1 & mask) {}
+
+		size_t offset(size_t i) const { return (m_offset + i) & m_mask; }
+		size_t offset() const { return m_offset; }
+
+		void next()
+		{
+			m_index += Group::kWidth;
+			m_offset = (m_offset + m_index) & m_mask;
+		}
+
+		size_t m_mask;
+		size_t m_offset;
+		size_t m_index {};
+	};
+
+	/**
+	 * \brief Open addressing hash table with SIMD probing over groups of control bytes, following the design of
+	 * Abseil's SwissTable. Slots and control bytes share one allocation: [slots x capacity][control bytes x capacity + group width].
+	 * The first group width - 1 control bytes are mirrored past the end, so a group can be loaded at any slot.
+	 * The table is kept at most 7/8 full. Erased slots become tombstones that are reclaimed on the next rehash.
+	 */
+	template <typename Policy, typename Hash, typename KeyEqual, typename Allocator>
+	class AxHashTable
+	{
+	public:
+		using key_type = typename Policy::key_type;
+		using slot_type = typename Policy::slot_type;
+		using value_type = slot_type;
+		using hasher = Hash;
+		using key_equal = KeyEqual;
+		using allocator_type = Allocator;
+		using size_type = size_t;
+
+		static_assert(alignof(slot_type) <= 16, "Over aligned slots are not supported");
+
+	protected:
+		// The table memory is allocated in 16 byte blocks so slots stay aligned with allocators that honour alignof
+		struct alignas(16) AllocBlock { u8 bytes[16]; };
+		using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<AllocBlock>;
+
+		// Lookups accept any key type when both the hasher and the comparator are transparent.
+		// An alias template, unlike std::conditional_t, keeps K deducible.
+		template <typename K>
+		using key_arg = typename KeyArg<transparent<Hash> && transparent<KeyEqual>>::template type<K, key_type>;
+
+		template <typename ValueType>
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = ValueType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			Iterator() = default;
+			Iterator(const ctrl_t* ctrl, const ctrl_t* ctrl_end, pointer slot) : m_ctrl(ctrl), m_ctrlEnd(ctrl_end), m_slot(slot) { SkipEmpty(); }
+
+			// Allow conversion from non-const iterator to const iterator
+			template <typename OtherType> requires (std::is_const_v<ValueType> && !std::is_const_v<OtherType>)
+			Iterator(Iterator<OtherType> const& other) : m_ctrl(other.m_ctrl), m_ctrlEnd(other.m_ctrlEnd), m_slot(other.m_slot) {}
+
+			Iterator& operator++() { ++m_ctrl; ++m_slot; SkipEmpty(); return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			bool operator==(const Iterator& rhs) const { return m_slot == rhs.m_slot; }
+			bool operator!=(const Iterator& rhs) const { return m_slot != rhs.m_slot; }
+
+			reference operator*() const { return *m_slot; }
+			pointer operator->() const { return m_slot; }
+
+		private:
+			void SkipEmpty()
+			{
+				while (m_ctrl < m_ctrlEnd && !IsFull(*m_ctrl))
+				{
+					// Skip whole groups of empty or deleted slots
+					const auto full = Group(m_ctrl).matchFull();
+					const size_t skip = full ? full.lowest() : Group::kWidth;
+					const size_t remaining = static_cast<size_t>(m_ctrlEnd - m_ctrl);
+					const size_t step = skip < remaining ? skip : remaining;
+					m_ctrl += step;
+					m_slot += step;
+				}
+			}
+
+			const ctrl_t* m_ctrl {};
+			const ctrl_t* m_ctrlEnd {};
+			pointer m_slot {};
+
+			template <typename> friend class Iterator;
+			friend class AxHashTable;
+		};
+
+	public:
+		using iterator = Iterator<value_type>;
+		using const_iterator = Iterator<const value_type>;
+
+		AxHashTable() = default;
+
+		explicit AxHashTable(size_t capacity, Hash const& hash = Hash(), KeyEqual const& eq = KeyEqual(), Allocator const& alloc = Allocator())
+		: m_hash(hash), m_eq(eq), m_alloc(alloc)
+		{
+			reserve(capacity);
+		}
+
+		explicit AxHashTable(Allocator const& alloc) : m_alloc(alloc) {}
+
+		AxHashTable(AxHashTable const& other)
+		: m_hash(other.m_hash), m_eq(other.m_eq), m_alloc(other.m_alloc)
+		{
+			CopyFrom(other);
+		}
+
+		AxHashTable(AxHashTable&& other) noexcept
+		: m_hash(std::move(other.m_hash)), m_eq(std::move(other.m_eq)), m_alloc(std::move(other.m_alloc))
+		{
+			StealFrom(other);
+		}
+
+		~AxHashTable()
+		{
+			DestroyAndFree();
+		}
+
+		AxHashTable& operator=(AxHashTable const& other)
+		{
+			if (this != &other)
+			{
+				DestroyAndFree();
+				m_hash = other.m_hash;
+				m_eq = other.m_eq;
+				CopyFrom(other);
+			}
+			return *this;
+		}
+
+		AxHashTable& operator=(AxHashTable&& other) noexcept
+		{
+			if (this != &other)
+			{
+				DestroyAndFree();
+				m_hash = std::move(other.m_hash);
+				m_eq = std::move(other.m_eq);
+				m_alloc = std::move(other.m_alloc);
+				StealFrom(other);
+			}
+			return *this;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] iterator find(key_arg<K> const& key)
+		{
+			return find(key, m_hash(key));
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator find(key_arg<K> const& key) const
+		{
+			return const_cast<AxHashTable*>(this)->find(key, m_hash(key));
+		}
+
+		/**
+		 * \brief Looks up key with a hash that was computed earlier with hash_function()
+		 */
+		template <typename K = key_type>
+		[[nodiscard]] iterator find(key_arg<K> const& key, u64 hash)
+		{
+			const size_t index = FindIndex(key, MixHash(hash));
+			return index == kNotFound ? end() : IteratorAt(index);
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] const_iterator find(key_arg<K> const& key, u64 hash) const
+		{
+			return const_cast<AxHashTable*>(this)->find(key, hash);
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] bool contains(key_arg<K> const& key) const
+		{
+			return FindIndex(key, MixHash(m_hash(key))) != kNotFound;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] bool contains(key_arg<K> const& key, u64 hash) const
+		{
+			return FindIndex(key, MixHash(hash)) != kNotFound;
+		}
+
+		template <typename K = key_type>
+		[[nodiscard]] size_t count(key_arg<K> const& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+
+		template <typename K = key_type>
+		size_t erase(key_arg<K> const& key)
+		{
+			const size_t index = FindIndex(key, MixHash(m_hash(key)));
+			if (index == kNotFound)
+				return 0;
+
+			EraseAt(index);
+			return 1;
+		}
+
+		/**
+		 * \brief Erases the element at it
+		 * \return iterator to the next element
+		 */
+		iterator erase(const_iterator it)
+		{
+			axAssertFmt(it.m_slot && it != cend(), "Cannot erase the end iterator");
+			const size_t index = static_cast<size_t>(it.m_slot - m_slots);
+			EraseAt(index);
+			return IteratorAt(index + 1);
+		}
+
+		// Exact match for non-const iterators, otherwise a transparent hasher makes the key overload win with K = iterator
+		iterator erase(iterator it)
+		{
+			return erase(const_iterator(it));
+		}
+
+		/**
+		 * \brief Destroys all elements and keeps the allocation
+		 */
+		void clear()
+		{
+			if (m_capacity == 0)
+				return;
+
+			DestroySlots();
+			ResetCtrl();
+			m_size = 0;
+			m_growthLeft = CapacityToGrowth(m_capacity);
+		}
+
+		/**
+		 * \brief Makes room for count elements without any further rehashing
+		 */
+		void reserve(size_t count)
+		{
+			if (count > m_size + m_growthLeft)
+			{
+				Resize(GrowthToCapacity(count));
+			}
+		}
+
+		/**
+		 * \brief Rehashes into the smallest table that holds the current elements.
+		 * Meant for read-mostly tables: fill the table, then shrink it once so lookups touch as little memory as possible.
+		 */
+		void shrink_to_fit()
+		{
+			if (m_size == 0)
+			{
+				DestroyAndFree();
+				return;
+			}
+
+			const size_t capacity = GrowthToCapacity(m_size);
+			if (capacity < m_capacity)
+			{
+				Resize(capacity);
+			}
+		}
+
+		/**
+		 * \brief Rehashes the table, dropping all tombstones
+		 */
+		void rehash()
+		{
+			if (m_capacity != 0)
+				Resize(m_capacity);
+		}
+
+		[[nodiscard]] size_t size() const     { return m_size; }
+		[[nodiscard]] size_t capacity() const { return m_capacity; }
+		[[nodiscard]] bool   empty() const    { return m_size == 0; }
+		[[nodiscard]] float  load_factor() const { return m_capacity ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.f; }
+
+		[[nodiscard]] hasher hash_function() const { return m_hash; }
+		[[nodiscard]] key_equal key_eq() const { return m_eq; }
+		[[nodiscard]] allocator_type get_allocator() const { return allocator_type(m_alloc); }
+
+		[[nodiscard]] iterator begin() { return IteratorAt(0); }
+		[[nodiscard]] iterator end()   { return iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity); }
+
+		[[nodiscard]] const_iterator begin() const  { return const_cast<AxHashTable*>(this)->begin(); }
+		[[nodiscard]] const_iterator end() const    { return const_cast<AxHashTable*>(this)->end(); }
+		[[nodiscard]] const_iterator cbegin() const { return begin(); }
+		[[nodiscard]] const_iterator cend() const   { return end(); }
+
+	protected:
+		static constexpr size_t kNotFound = Constants::u64_MAX;
+
+		// Finds key, or claims a slot for it. The caller must construct the element when inserted is true
+		template <typename K>
+		std::pair<size_t, bool> FindOrPrepareInsert(K const& key, u64 hash)
+		{
+			hash = MixHash(hash);
+			const size_t index = FindIndex(key, hash);
+			if (index != kNotFound)
+				return { index, false };
+
+			return { PrepareInsert(hash), true };
+		}
+
+		iterator IteratorAt(size_t index)
+		{
+			return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+		}
+
+		slot_type* SlotAt(size_t index) { return m_slots + index; }
+
+		hasher    m_hash {};
+		key_equal m_eq {};
+
+	private:
+		static constexpr size_t CapacityToGrowth(size_t capacity) { return capacity - capacity / 8; }
+
+		static constexpr size_t GrowthToCapacity(size_t growth)
+		{
+			// Smallest power of two capacity that stays within the 7/8 load factor
+			const size_t minCapacity = growth + (growth + 6) / 7;
+			return std::bit_ceil(std::max(minCapacity, Group::kWidth));
+		}
+
+		template <typename K>
+		size_t FindIndex(K const& key, u64 hash) const
+		{
+			if (m_capacity == 0)
+				return kNotFound;
+
+			ProbeSeq seq(H1(hash), m_capacity - 1);
+			while (true)
+			{
+				const Group group(m_ctrl + seq.offset());
+				for (u32 i : group.match(H2(hash)))
+				{
+					const size_t index = seq.offset(i);
+					if (m_eq(Policy::GetKey(m_slots[index]), key))
+						return index;
+				}
+				if (group.matchEmpty())
+					return kNotFound;
+				seq.next();
+			}
+		}
+
+		size_t FindFirstNonFull(u64 hash) const
+		{
+			ProbeSeq seq(H1(hash), m_capacity - 1);
+			while (true)
+			{
+				const auto mask = Group(m_ctrl + seq.offset()).matchEmptyOrDeleted();
+				if (mask)
+					return seq.offset(mask.lowest());
+				seq.next();
+			}
+		}
+
+		size_t PrepareInsert(u64 hash)
+		{
+			if (m_capacity == 0)
+			{
+				Resize(Group::kWidth);
+			}
+
+			size_t index = FindFirstNonFull(hash);
+			if (m_growthLeft == 0 && m_ctrl[index] != kCtrlDeleted)
+			{
+				// Rehash in place when tombstones make up a large part of the table, otherwise grow
+				const bool grow = m_size * 32 > m_capacity * 25;
+				Resize(grow ? m_capacity * 2 : m_capacity);
+				index = FindFirstNonFull(hash);
+			}
+
+			m_growthLeft -= (m_ctrl[index] == kCtrlEmpty);
+			SetCtrl(index, static_cast<ctrl_t>(H2(hash)));
+			++m_size;
+			return index;
+		}
+
+		void EraseAt(size_t index)
+		{
+			std::destroy_at(m_slots + index);
+			SetCtrl(index, kCtrlDeleted);
+			--m_size;
+		}
+
+		void SetCtrl(size_t index, ctrl_t ctrl)
+		{
+			m_ctrl[index] = ctrl;
+			if (index < Group::kWidth - 1)
+			{
+				m_ctrl[m_capacity + index] = ctrl;
+			}
+		}
+
+		void ResetCtrl()
+		{
+			std::memset(m_ctrl, kCtrlEmpty, CtrlBytes(m_capacity));
+		}
+
+		static constexpr size_t CtrlBytes(size_t capacity) { return capacity + Group::kWidth; }
+		static constexpr size_t AllocBlocks(size_t capacity) { return (capacity * sizeof(slot_type) + CtrlBytes(capacity) + sizeof(AllocBlock) - 1) / sizeof(AllocBlock); }
+
+		void Allocate(size_t capacity)
+		{
+			u8* mem = reinterpret_cast<u8*>(m_alloc.allocate(AllocBlocks(capacity)));
+			m_slots = reinterpret_cast<slot_type*>(mem);
+			m_ctrl = reinterpret_cast<ctrl_t*>(mem + capacity * sizeof(slot_type));
+			m_capacity = capacity;
+			m_size = 0;
+			m_growthLeft = CapacityToGrowth(capacity);
+			ResetCtrl();
+		}
+
+		void Resize(size_t new_capacity)
+		{
+			axAssert(std::has_single_bit(new_capacity) && new_capacity >= Group::kWidth);
+
+			ctrl_t* oldCtrl = m_ctrl;
+			slot_type* oldSlots = m_slots;
+			const size_t oldCapacity = m_capacity;
+
+			Allocate(new_capacity);
+
+			for (size_t i = 0; i < oldCapacity; i++)
+			{
+				if (!IsFull(oldCtrl[i]))
+					continue;
+
+				const u64 hash = MixHash(m_hash(Policy::GetKey(oldSlots[i])));
+				const size_t index = FindFirstNonFull(hash);
+				SetCtrl(index, static_cast<ctrl_t>(H2(hash)));
+				RelocateSlot(m_slots + index, oldSlots + i);
+				++m_size;
+			}
+			m_growthLeft -= m_size;
+
+			if (oldCapacity)
+			{
+				m_alloc.deallocate(reinterpret_cast<AllocBlock*>(oldSlots), AllocBlocks(oldCapacity));
+			}
+		}
+
+		static void RelocateSlot(slot_type* dst, slot_type* src)
+		{
+			if constexpr (is_trivially_relocatable_v<slot_type>)
+			{
+				std::memcpy(static_cast<void*>(dst), src, sizeof(slot_type));
+			}
+			else
+			{
+				new (dst) slot_type(std::move(*src));
+				std::destroy_at(src);
+			}
+		}
+
+		void DestroySlots()
+		{
+			if constexpr (!std::is_trivially_destructible_v<slot_type>)
+			{
+				for (size_t i = 0; i < m_capacity; i++)
+				{
+					if (IsFull(m_ctrl[i]))
+						std::destroy_at(m_slots + i);
+				}
+			}
+		}
+
+		void DestroyAndFree()
+		{
+			if (m_capacity == 0)
+				return;
+
+			DestroySlots();
+			m_alloc.deallocate(reinterpret_cast<AllocBlock*>(m_slots), AllocBlocks(m_capacity));
+			m_ctrl = EmptyGroup();
+			m_slots = nullptr;
+			m_capacity = m_size = m_growthLeft = 0;
+		}
+
+		// Same capacity and hash function, so every element keeps its slot
+		void CopyFrom(AxHashTable const& other)
+		{
+			if (other.m_capacity == 0)
+				return;
+
+			Allocate(other.m_capacity);
+			std::memcpy(m_ctrl, other.m_ctrl, CtrlBytes(m_capacity));
+			for (size_t i = 0; i < m_capacity; i++)
+			{
+				if (IsFull(m_ctrl[i]))
+					new (m_slots + i) slot_type(other.m_slots[i]);
+			}
+			m_size = other.m_size;
+			m_growthLeft = other.m_growthLeft;
+		}
+
+		void StealFrom(AxHashTable& other)
+		{
+			m_ctrl = std::exchange(other.m_ctrl, EmptyGroup());
+			m_slots = std::exchange(other.m_slots, nullptr);
+			m_capacity = std::exchange(other.m_capacity, 0);
+			m_size = std::exchange(other.m_size, 0);
+			m_growthLeft = std::exchange(other.m_growthLeft, 0);
+		}
+
+		// Empty tables point at a static group of empty control bytes, so begin() and lookups need no null checks
+		static ctrl_t* EmptyGroup()
+		{
+			alignas(16) static constexpr ctrl_t kEmptyGroup[Group::kWidth] = {
+				kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+			#if defined(APEX_ARCH_X86)
+				kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty, kCtrlEmpty,
+			#endif
+			};
+			return const_cast<ctrl_t*>(kEmptyGroup);
+		}
+
+	private:
+		ctrl_t*    m_ctrl { EmptyGroup() };
+		slot_type* m_slots {};
+		size_t     m_capacity {};
+		size_t     m_size {};
+		size_t     m_growthLeft {};
+		block_allocator m_alloc {};
+	};
+
+}
+
+}
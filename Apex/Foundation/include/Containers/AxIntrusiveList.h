@@ -0,0 +1,300 @@
+#pragma once
+#include <iterator>
+
+#include "Core/Asserts.h"
+#include "Core/Types.h"
+
+namespace apex {
+
+	/**
+	 * \brief Link embedded in elements of an AxIntrusiveList.
+	 * An element joins a list by deriving from the hook. Deriving from hooks with different tags
+	 * lets the same element sit in several lists at once.
+	 * Copying an element never copies its links; the copy starts out unlinked.
+	 * \tparam Tag distinguishes multiple hooks in the same element
+	 */
+	template <typename Tag = void>
+	struct AxListHook
+	{
+		AxListHook() = default;
+		AxListHook(AxListHook const&) {}
+		AxListHook& operator=(AxListHook const&) { return *this; }
+
+		~AxListHook()
+		{
+			axAssertFmt(!isLinked(), "Element destroyed while still linked into an intrusive list!");
+		}
+
+		[[nodiscard]] bool isLinked() const { return m_next != nullptr; }
+
+		AxListHook* m_prev {};
+		AxListHook* m_next {};
+	};
+
+	/**
+	 * \brief Non-owning doubly linked list threaded through hooks embedded in the elements.
+	 * \details Never allocates. Linking, unlinking and splicing are O(1) and only touch the neighbouring hooks,
+	 * which makes it a good fit for LRU caches, free lists and pending-deletion queues.
+	 * The list is circular around a sentinel hook, so there are no null checks on the hot paths.
+	 * Elements must outlive their membership; the list never destroys them.
+	 * \tparam T element type, must derive from AxListHook<Tag>
+	 * \tparam Tag selects which hook of T this list uses
+	 */
+	template <typename T, typename Tag = void>
+	class AxIntrusiveList
+	{
+	public:
+		using hook_type = AxListHook<Tag>;
+		using value_type = T;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+
+		template <typename ValueType, bool Reverse>
+		class Iterator
+		{
+		public:
+			using hook_ptr = std::conditional_t<std::is_const_v<ValueType>, const hook_type*, hook_type*>;
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = ValueType;
+			using difference_type = std::ptrdiff_t;
+			using pointer = value_type*;
+			using reference = value_type&;
+
+			Iterator() = default;
+			explicit Iterator(hook_ptr hook) : m_hook(hook) {}
+
+			// Allow conversion from non-const iterator to const iterator
+			template <typename OtherType> requires (std::is_const_v<ValueType> && !std::is_const_v<OtherType>)
+			Iterator(Iterator<OtherType, Reverse> const& other) : m_hook(other.m_hook) {}
+
+			Iterator& operator++() { m_hook = Reverse ? m_hook->m_prev : m_hook->m_next; return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+			Iterator& operator--() { m_hook = Reverse ? m_hook->m_next : m_hook->m_prev; return *this; }
+			Iterator operator--(int) { Iterator tmp(*this); operator--(); return tmp; }
+
+			bool operator==(const Iterator& rhs) const { return m_hook == rhs.m_hook; }
+			bool operator!=(const Iterator& rhs) const { return m_hook != rhs.m_hook; }
+
+			reference operator*() const { return static_cast<reference>(*m_hook); }
+			pointer operator->() const { return static_cast<pointer>(m_hook); }
+
+			Iterator next() const { Iterator tmp(*this); return ++tmp; }
+			Iterator prev() const { Iterator tmp(*this); return --tmp; }
+
+			[[nodiscard]] hook_ptr hook() const { return m_hook; }
+
+		private:
+			hook_ptr m_hook {};
+
+			template <typename, bool> friend class Iterator;
+			friend class AxIntrusiveList;
+		};
+
+		using iterator = Iterator<value_type, false>;
+		using const_iterator = Iterator<const value_type, false>;
+		using reverse_iterator = Iterator<value_type, true>;
+		using const_reverse_iterator = Iterator<const value_type, true>;
+
+		AxIntrusiveList()
+		{
+			ResetRoot();
+		}
+
+		~AxIntrusiveList()
+		{
+			clear();
+			m_root.m_prev = m_root.m_next = nullptr;
+		}
+
+		NON_COPYABLE(AxIntrusiveList);
+
+		AxIntrusiveList(AxIntrusiveList&& other) noexcept : AxIntrusiveList()
+		{
+			splice(end(), other);
+		}
+
+		AxIntrusiveList& operator=(AxIntrusiveList&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clear();
+				splice(end(), other);
+			}
+			return *this;
+		}
+
+		void push_back(reference elem) { LinkBefore(&m_root, ToHook(elem)); }
+		void push_front(reference elem) { LinkBefore(m_root.m_next, ToHook(elem)); }
+
+		/**
+		 * \brief Links elem before pos
+		 * \return iterator to elem
+		 */
+		iterator insert(const_iterator pos, reference elem)
+		{
+			hook_type* hook = ToHook(elem);
+			LinkBefore(const_cast<hook_type*>(pos.m_hook), hook);
+			return iterator(hook);
+		}
+
+		/**
+		 * \brief Unlinks elem from this list. elem must be linked into this list
+		 */
+		void remove(reference elem)
+		{
+			Unlink(ToHook(elem));
+		}
+
+		/**
+		 * \brief Unlinks the element at pos
+		 * \return iterator to the element following pos
+		 */
+		iterator erase(const_iterator pos)
+		{
+			axAssertFmt(pos.m_hook != &m_root, "Cannot erase the end iterator");
+			hook_type* hook = const_cast<hook_type*>(pos.m_hook);
+			hook_type* next = hook->m_next;
+			Unlink(hook);
+			return iterator(next);
+		}
+
+		pointer pop_front()
+		{
+			if (empty())
+				return nullptr;
+			hook_type* hook = m_root.m_next;
+			Unlink(hook);
+			return static_cast<pointer>(hook);
+		}
+
+		pointer pop_back()
+		{
+			if (empty())
+				return nullptr;
+			hook_type* hook = m_root.m_prev;
+			Unlink(hook);
+			return static_cast<pointer>(hook);
+		}
+
+		/**
+		 * \brief Unlinks every element. Iterative, so arbitrarily long lists are fine
+		 */
+		void clear()
+		{
+			hook_type* hook = m_root.m_next;
+			while (hook != &m_root)
+			{
+				hook_type* next = hook->m_next;
+				hook->m_prev = hook->m_next = nullptr;
+				hook = next;
+			}
+			ResetRoot();
+			m_size = 0;
+		}
+
+		/**
+		 * \brief Moves every element of other before pos in O(1). other is left empty
+		 */
+		void splice(const_iterator pos, AxIntrusiveList& other)
+		{
+			if (&other == this || other.empty())
+				return;
+
+			hook_type* next = const_cast<hook_type*>(pos.m_hook);
+			hook_type* first = other.m_root.m_next;
+			hook_type* last = other.m_root.m_prev;
+
+			first->m_prev = next->m_prev;
+			next->m_prev->m_next = first;
+			last->m_next = next;
+			next->m_prev = last;
+
+			m_size += other.m_size;
+			other.ResetRoot();
+			other.m_size = 0;
+		}
+
+		/**
+		 * \brief Moves elem from other to before pos in O(1). other may be this list
+		 */
+		void splice(const_iterator pos, AxIntrusiveList& other, reference elem)
+		{
+			hook_type* hook = ToHook(elem);
+			hook_type* next = const_cast<hook_type*>(pos.m_hook);
+			if (hook == next || hook->m_next == next)
+				return;
+
+			other.Unlink(hook);
+			LinkBefore(next, hook);
+		}
+
+		/**
+		 * \brief Returns an iterator to elem, which must be linked into this list
+		 */
+		[[nodiscard]] iterator iterator_to(reference elem) { return iterator(ToHook(elem)); }
+		[[nodiscard]] const_iterator iterator_to(const_reference elem) const { return const_iterator(static_cast<const hook_type*>(&elem)); }
+
+		[[nodiscard]] auto front() -> reference { axAssert(!empty()); return static_cast<reference>(*m_root.m_next); }
+		[[nodiscard]] auto front() const -> const_reference { axAssert(!empty()); return static_cast<const_reference>(*m_root.m_next); }
+
+		[[nodiscard]] auto back() -> reference { axAssert(!empty()); return static_cast<reference>(*m_root.m_prev); }
+		[[nodiscard]] auto back() const -> const_reference { axAssert(!empty()); return static_cast<const_reference>(*m_root.m_prev); }
+
+		[[nodiscard]] size_t size() const { return m_size; }
+		[[nodiscard]] bool   empty() const { return m_size == 0; }
+
+		#pragma region Iterator functions
+		[[nodiscard]] iterator begin() { return iterator(m_root.m_next); }
+		[[nodiscard]] iterator end() { return iterator(&m_root); }
+
+		[[nodiscard]] const_iterator cbegin() const { return const_iterator(m_root.m_next); }
+		[[nodiscard]] const_iterator cend() const { return const_iterator(&m_root); }
+
+		[[nodiscard]] const_iterator begin() const { return cbegin(); }
+		[[nodiscard]] const_iterator end() const { return cend(); }
+
+		[[nodiscard]] reverse_iterator rbegin() { return reverse_iterator(m_root.m_prev); }
+		[[nodiscard]] reverse_iterator rend() { return reverse_iterator(&m_root); }
+
+		[[nodiscard]] const_reverse_iterator crbegin() const { return const_reverse_iterator(m_root.m_prev); }
+		[[nodiscard]] const_reverse_iterator crend() const { return const_reverse_iterator(&m_root); }
+
+		[[nodiscard]] const_reverse_iterator rbegin() const { return crbegin(); }
+		[[nodiscard]] const_reverse_iterator rend() const { return crend(); }
+		#pragma endregion
+
+	private:
+		static hook_type* ToHook(reference elem) { return static_cast<hook_type*>(&elem); }
+
+		void ResetRoot()
+		{
+			m_root.m_prev = m_root.m_next = &m_root;
+		}
+
+		void LinkBefore(hook_type* next, hook_type* hook)
+		{
+			axAssertFmt(!hook->isLinked(), "Element is already linked into a list!");
+			hook->m_prev = next->m_prev;
+			hook->m_next = next;
+			next->m_prev->m_next = hook;
+			next->m_prev = hook;
+			++m_size;
+		}
+
+		void Unlink(hook_type* hook)
+		{
+			axAssertFmt(hook->isLinked() && hook != &m_root, "Element is not linked into a list!");
+			hook->m_prev->m_next = hook->m_next;
+			hook->m_next->m_prev = hook->m_prev;
+			hook->m_prev = hook->m_next = nullptr;
+			--m_size;
+		}
+
+	private:
+		hook_type m_root; // Sentinel. m_root.m_next is the head, m_root.m_prev is the tail
+		size_t m_size {};
+	};
+
+}
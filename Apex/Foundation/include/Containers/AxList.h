@@ -1,11 +1,15 @@
 #pragma once
-#include "Memory/UniquePtr.h"
+#include "Containers/AxIntrusiveList.h"
 #include "Core/Asserts.h"
+#include "Memory/MemoryManager.h"
 
 namespace apex {
 
 	/**
 	 * \brief Doubly linked list
+	 * \details Nodes are plain structs allocated from the MemoryManager pools and linked through an
+	 * AxIntrusiveList, so there is no virtual dispatch and no ownership chain between nodes.
+	 * Destruction is iterative and splicing is O(1).
 	 * \tparam T Type of the elements stored in the list
 	 */
 	template <typename T>
@@ -15,240 +19,241 @@ namespace apex {
 		using underlying_type = T;
 
 	private:
-
-		class IListNode
+		struct ListNode : public AxListHook<>
 		{
-		public:
-			virtual ~IListNode() = default;
-
-			virtual underlying_type& data() = 0;
-			virtual UniquePtr<IListNode>& next() = 0;
-			virtual IListNode* prev() = 0;
-			virtual void prev(IListNode* node) = 0;
-		};
-
-		struct ListNode : public IListNode
-		{
-		public:
-			ListNode() requires std::is_default_constructible_v<underlying_type> = default;
-			~ListNode() = default;
-
 			template <typename... Args>
 			ListNode(Args&&... args) : m_data(std::forward<Args>(args)...) {}
 
-			underlying_type& data() override { return m_data; }
-			UniquePtr<IListNode>& next() override { return m_next; }
-			IListNode* prev() override { return m_prev; }
-			void prev(IListNode* node) override { m_prev = static_cast<ListNode*>(node); }
-
-		private:
-			underlying_type      m_data;
-			UniquePtr<IListNode> m_next{}; // Next node in the list (strong reference)
-			ListNode*            m_prev{}; // Previous node in the list (weak reference)
-
-			friend struct StaticAsserts;
+			underlying_type m_data;
 		};
 
-		struct StaticAsserts
-		{
-			static_assert(offsetof(ListNode, m_data) == 0);
-		};
-		static_assert(apex::convertible_to<ListNode, IListNode>);
+		using node_list = AxIntrusiveList<ListNode>;
+		using hook_type = typename node_list::hook_type;
 
 	public:
-		using node_t = IListNode;
-		using node_ptr_t = UniquePtr<IListNode>;
-
 		// Iterator class for AxList
-		template <typename IterType, bool reverse = false>
+		template <typename ValueType, bool reverse = false>
 		class Iterator
 		{
+			using hook_ptr = std::conditional_t<std::is_const_v<ValueType>, const hook_type*, hook_type*>;
+			using node_ptr = std::conditional_t<std::is_const_v<ValueType>, const ListNode*, ListNode*>;
+			using list_ptr = std::conditional_t<std::is_const_v<ValueType>, const AxList*, AxList*>;
+
 		public:
 			using iterator_category = std::bidirectional_iterator_tag;
-			using value_type = underlying_type;
+			using value_type = ValueType;
 			using difference_type = std::ptrdiff_t;
 			using pointer = value_type*;
 			using reference = value_type&;
 
 			Iterator() : m_ptr(), m_list() {}
-			Iterator(IterType* node, AxList* list) : m_ptr(node), m_list(list) {}
+			Iterator(hook_ptr node, list_ptr list) : m_ptr(node), m_list(list) {}
+
+			// Allow conversion from non-const iterator to const iterator
+			template <typename OtherType> requires (std::is_const_v<ValueType> && !std::is_const_v<OtherType>)
+			Iterator(Iterator<OtherType, reverse> const& other) : m_ptr(other.m_ptr), m_list(other.m_list) {}
+
 			Iterator& operator++() { m_ptr = _Next(); return *this; } // pre-increment
 			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; } // post-increment
 			Iterator& operator--() { m_ptr = _Prev(); return *this; } // pre-decrement
 			Iterator operator--(int) { Iterator tmp(*this); operator--(); return tmp; } // post-decrement
 			bool operator==(const Iterator& rhs) const { return m_ptr == rhs.m_ptr; }
 			bool operator!=(const Iterator& rhs) const { return m_ptr != rhs.m_ptr; }
-			reference operator*() const { return m_ptr->data(); }
-			pointer operator->() const { return &m_ptr->data(); }
+			reference operator*() const { return static_cast<node_ptr>(m_ptr)->m_data; }
+			pointer operator->() const { return &static_cast<node_ptr>(m_ptr)->m_data; }
 
-			Iterator next() { return Iterator(_Next(), m_list); }
-			Iterator prev() { return Iterator(_Prev(), m_list); }
+			Iterator next() const { return Iterator(_Next(), m_list); }
+			Iterator prev() const { return Iterator(_Prev(), m_list); }
 
 		protected:
-			IterType* _Next() const
-			{
-				if constexpr (reverse)
-					return m_ptr->prev();
-				else
-					return m_ptr->next().get();
-			}
-
-			IterType* _Prev() const
-			{
-				if constexpr (reverse)
-					return m_ptr->next().get();
-				else
-					return m_ptr->prev();
-			}
+			hook_ptr _Next() const { return reverse ? m_ptr->m_prev : m_ptr->m_next; }
+			hook_ptr _Prev() const { return reverse ? m_ptr->m_next : m_ptr->m_prev; }
 
 		private:
-			IterType* m_ptr;
-			AxList* m_list;
+			hook_ptr m_ptr;
+			list_ptr m_list;
 
+			template <typename, bool> friend class Iterator;
 			friend class AxList;
 		};
 
 	public:
-		//using stored_type = std::conditional_t<apex::managed_class<T>, underlying_type, AxManagedClassAdapter<T>>;
 		using value_type = underlying_type;
 		using pointer = value_type*;
 		using const_pointer = const value_type*;
 		using reference = value_type&;
 		using const_reference = const value_type&;
-		using iterator = Iterator<node_t>;
-		using const_iterator = Iterator<const node_t>;
-		using reverse_iterator = Iterator<node_t, true>;
-		using const_reverse_iterator = Iterator<const node_t, true>;
+		using iterator = Iterator<value_type>;
+		using const_iterator = Iterator<const value_type>;
+		using reverse_iterator = Iterator<value_type, true>;
+		using const_reverse_iterator = Iterator<const value_type, true>;
 
 		AxList() = default;
 
-		void append(const value_type& value)
+		~AxList()
+		{
+			clear();
+		}
+
+		NON_COPYABLE(AxList);
+
+		AxList(AxList&& other) noexcept = default;
+
+		AxList& operator=(AxList&& other) noexcept
 		{
-			node_ptr_t node = std::move(apex::make_unique<ListNode>(value));
-			AppendNode(std::move(node));
+			if (this != &other)
+			{
+				clear();
+				m_nodes = std::move(other.m_nodes);
+			}
+			return *this;
 		}
 
-		void append(value_type&& value)
+		void append(const value_type& value) { emplace_back(value); }
+		void append(value_type&& value) { emplace_back(std::move(value)); }
+
+		void prepend(const value_type& value) { emplace_front(value); }
+		void prepend(value_type&& value) { emplace_front(std::move(value)); }
+
+		template <typename... Args>
+		reference emplace_back(Args&&... args) requires std::is_constructible_v<underlying_type, Args...>
 		{
-			node_ptr_t node = std::move(apex::make_unique<ListNode>(std::forward<value_type>(value)));
-			AppendNode(std::move(node));
+			ListNode* node = NewNode(std::forward<Args>(args)...);
+			m_nodes.push_back(*node);
+			return node->m_data;
 		}
 
 		template <typename... Args>
-		void emplace_back(Args&&... args) requires std::is_constructible_v<underlying_type, Args...>
+		reference emplace_front(Args&&... args) requires std::is_constructible_v<underlying_type, Args...>
 		{
-			node_ptr_t node = apex::make_unique<ListNode>(std::forward<Args>(args)...);
-			AppendNode(std::move(node));
+			ListNode* node = NewNode(std::forward<Args>(args)...);
+			m_nodes.push_front(*node);
+			return node->m_data;
 		}
 
-		iterator insert(iterator const& it, const value_type& value)
+		/**
+		 * \brief Constructs a new element before it
+		 * \return iterator to the new element
+		 */
+		template <typename... Args>
+		iterator emplace(const_iterator const& it, Args&&... args) requires std::is_constructible_v<underlying_type, Args...>
 		{
 			axAssertFmt(it.m_ptr, "Invalid iterator");
 			axAssertFmt(this == it.m_list, "Iterator does not belong to this list");
 
-			TODO("Not implemented yet!");
-
-			return {};
+			ListNode* node = NewNode(std::forward<Args>(args)...);
+			m_nodes.insert(ToNodeIterator(it), *node);
+			return iterator(node, this);
 		}
 
-		iterator remove(iterator const& it)
+		iterator insert(const_iterator const& it, const value_type& value) { return emplace(it, value); }
+		iterator insert(const_iterator const& it, value_type&& value) { return emplace(it, std::move(value)); }
+
+		iterator remove(const_iterator const& it)
 		{
 			axAssertFmt(it.m_ptr, "Invalid iterator");
 			axAssertFmt(this == it.m_list, "Iterator does not belong to this list");
 
-			iterator next = it;
-			++next;
-			RemoveNode(it.m_ptr);
-			return next;
+			auto next = m_nodes.erase(ToNodeIterator(it));
+			DeleteNode(static_cast<ListNode*>(const_cast<hook_type*>(it.m_ptr)));
+			return iterator(next.hook(), this);
 		}
 
-		[[nodiscard]] auto back() -> reference { return m_tail->data(); }
-		[[nodiscard]] auto back() const -> const_reference { return m_tail->data(); }
+		void pop_front()
+		{
+			axAssertFmt(!empty(), "Cannot pop from empty list!");
+			DeleteNode(m_nodes.pop_front());
+		}
+
+		void pop_back()
+		{
+			axAssertFmt(!empty(), "Cannot pop from empty list!");
+			DeleteNode(m_nodes.pop_back());
+		}
+
+		/**
+		 * \brief Destroys every element. Nodes are released one at a time, so long lists cannot overflow the stack
+		 */
+		void clear()
+		{
+			while (ListNode* node = m_nodes.pop_front())
+			{
+				DeleteNode(node);
+			}
+		}
+
+		/**
+		 * \brief Moves every element of other before it in O(1). No nodes are allocated or copied
+		 */
+		void splice(const_iterator const& it, AxList& other)
+		{
+			axAssertFmt(this == it.m_list, "Iterator does not belong to this list");
+			m_nodes.splice(ToNodeIterator(it), other.m_nodes);
+		}
+
+		/**
+		 * \brief Moves the element at other_it from other to before it in O(1). other may be this list
+		 */
+		void splice(const_iterator const& it, AxList& other, const_iterator const& other_it)
+		{
+			axAssertFmt(this == it.m_list, "Iterator does not belong to this list");
+			axAssertFmt(&other == other_it.m_list, "Iterator does not belong to the source list");
+			m_nodes.splice(ToNodeIterator(it), other.m_nodes, *static_cast<ListNode*>(const_cast<hook_type*>(other_it.m_ptr)));
+		}
+
+		[[nodiscard]] auto back() -> reference { return m_nodes.back().m_data; }
+		[[nodiscard]] auto back() const -> const_reference { return m_nodes.back().m_data; }
 
-		[[nodiscard]] auto front() -> reference { return m_head->data(); }
-		[[nodiscard]] auto front() const -> const_reference { return m_head->data(); }
+		[[nodiscard]] auto front() -> reference { return m_nodes.front().m_data; }
+		[[nodiscard]] auto front() const -> const_reference { return m_nodes.front().m_data; }
 
-		[[nodiscard]] size_t size() const { return m_size; }
-		[[nodiscard]] bool   empty() const { return m_size == 0; }
+		[[nodiscard]] size_t size() const { return m_nodes.size(); }
+		[[nodiscard]] bool   empty() const { return m_nodes.empty(); }
 
 		#pragma region Iterator functions
-		[[nodiscard]] iterator begin() { return iterator(m_head.get(), this); }
-		[[nodiscard]] iterator end() { return iterator(nullptr, this); }
+		[[nodiscard]] iterator begin() { return iterator(m_nodes.begin().hook(), this); }
+		[[nodiscard]] iterator end() { return iterator(EndNode(), this); }
 
-		[[nodiscard]] const_iterator cbegin() const { return const_iterator(m_head.get(), this); }
-		[[nodiscard]] const_iterator cend() const { return const_iterator(m_tail, this); }
+		[[nodiscard]] const_iterator cbegin() const { return const_iterator(m_nodes.cbegin().hook(), this); }
+		[[nodiscard]] const_iterator cend() const { return const_iterator(EndNode(), this); }
 
 		[[nodiscard]] const_iterator begin() const { return cbegin(); }
 		[[nodiscard]] const_iterator end() const { return cend(); }
 
-		[[nodiscard]] reverse_iterator rbegin() { return reverse_iterator(m_tail, this); }
-		[[nodiscard]] reverse_iterator rend() { return reverse_iterator(nullptr, this); }
+		[[nodiscard]] reverse_iterator rbegin() { return reverse_iterator(m_nodes.rbegin().hook(), this); }
+		[[nodiscard]] reverse_iterator rend() { return reverse_iterator(EndNode(), this); }
 
-		[[nodiscard]] const_reverse_iterator crbegin() const { return const_reverse_iterator(m_tail, this); }
-		[[nodiscard]] const_reverse_iterator crend() const { return const_reverse_iterator(nullptr, this); }
+		[[nodiscard]] const_reverse_iterator crbegin() const { return const_reverse_iterator(m_nodes.crbegin().hook(), this); }
+		[[nodiscard]] const_reverse_iterator crend() const { return const_reverse_iterator(EndNode(), this); }
 
 		[[nodiscard]] const_reverse_iterator rbegin() const { return crbegin(); }
 		[[nodiscard]] const_reverse_iterator rend() const { return crend(); }
 	#pragma endregion
 
 	private:
-		void AppendNode(node_ptr_t&& node)
+		template <typename... Args>
+		static ListNode* NewNode(Args&&... args)
 		{
-			if (!m_head)
-			{
-				m_head = std::move(node);
-				m_tail = m_head.get();
-				++m_size;
-			}
-			else
-			{
-				InsertNode(std::move(node), m_tail);
-				m_tail = m_tail->next().get();
-			}
+			void* mem = mem::MemoryManager::allocate(sizeof(ListNode));
+			return new (mem) ListNode(std::forward<Args>(args)...);
 		}
 
-		void InsertNode(node_ptr_t&& node, node_t* prev)
+		static void DeleteNode(ListNode* node)
 		{
-			node->prev(prev);
-			if (prev->next())
-			{
-				prev->next()->prev(node.get());
-				node->next().swap(prev->next());
-			}
-			prev->next() = std::move(node);
-			++m_size;
+			node->~ListNode();
+			mem::MemoryManager::free(node);
 		}
 
-		void RemoveNode(node_t* node)
-		{
-			if (node->next())
-			{
-				node->next()->prev(node->prev());
-			}
-			if (node == m_tail)
-			{
-				m_tail = node->prev();
-			}
+		hook_type* EndNode() { return m_nodes.end().hook(); }
+		const hook_type* EndNode() const { return m_nodes.cend().hook(); }
 
-			if (node == m_head.get())
-			{
-				node_ptr_t tmp = std::move(m_head);
-				m_head = std::move(tmp->next());
-				m_head->prev(nullptr);
-			}
-			else if (node->prev())
-			{
-				node_t* prev = node->prev();
-				node_ptr_t tmp = std::move(prev->next());
-				prev->next() = std::move(node->next());
-			}
-			--m_size;
+		static typename node_list::const_iterator ToNodeIterator(const_iterator const& it)
+		{
+			return typename node_list::const_iterator(it.m_ptr);
 		}
 
 	private:
-		node_ptr_t m_head{}; // Head node of the list (strong reference)
-		node_t*    m_tail{}; // Tail node of the list (weak reference)
-		size_t m_size{};
+		node_list m_nodes;
 	};
 
 }
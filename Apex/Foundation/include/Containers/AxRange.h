@@ -1,4 +1,13 @@
 ﻿#pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+
+#include "Concurrency/Concurrency.h"
+#include "Core/Asserts.h"
+#include "Core/Types.h"
 
 namespace apex {
 namespace ranges {
@@ -55,11 +64,127 @@ namespace ranges {
 		typename T::is_view;
 	};
 
+	template <typename View>
+	using view_iterator_t = decltype(std::declval<View const&>().begin());
+
+	template <typename Iterator>
+	using iter_reference_t = decltype(*std::declval<Iterator const&>());
+
+	namespace detail
+	{
+		template <typename Iterator>
+		concept random_access_iterator = requires (Iterator it, Iterator other, std::ptrdiff_t n)
+		{
+			{ it + n } -> std::convertible_to<Iterator>;
+			{ other - it } -> std::convertible_to<std::ptrdiff_t>;
+		};
+
+		template <typename Iterator>
+		Iterator Advance(Iterator it, std::ptrdiff_t n)
+		{
+			if constexpr (random_access_iterator<Iterator>)
+			{
+				return it + n;
+			}
+			else
+			{
+				for (; n > 0; n--)
+					++it;
+				return it;
+			}
+		}
+
+		// Advances it by up to n steps without passing end
+		template <typename Iterator>
+		void AdvanceBounded(Iterator& it, std::ptrdiff_t n, Iterator const& end)
+		{
+			if constexpr (random_access_iterator<Iterator>)
+			{
+				it = it + std::min<std::ptrdiff_t>(n, end - it);
+			}
+			else
+			{
+				for (; n > 0 && it != end; n--)
+					++it;
+			}
+		}
+
+		template <typename Iterator>
+		using iterator_category_t = std::conditional_t<random_access_iterator<Iterator>, std::random_access_iterator_tag, std::forward_iterator_tag>;
+	}
+
+	template <typename Base, typename Fn> class TransformView;
+	template <typename... Bases> class ZipView;
+	template <typename Base> class EnumerateView;
+	template <typename Base> class ChunkView;
+	template <typename Base> class StrideView;
+	template <typename View> class ParallelView;
+
+	/**
+	 * \brief Adaptor chaining shared by every range and view.
+	 * Views are lazy and cheap to copy: they hold iterators or other views, never elements, so a chain like
+	 * range.transform(f).stride(2) materialises nothing. Adaptors keep random access when their inputs have it.
+	 * Iterators point back into their view, so a view must outlive the iterators taken from it.
+	 */
+	template <typename Derived>
+	class AxViewBase
+	{
+	public:
+		/**
+		 * \brief View of fn(x) for every element x
+		 */
+		template <typename Fn>
+		[[nodiscard]] auto transform(Fn&& fn) const { return TransformView<Derived, std::decay_t<Fn>>(Self(), std::forward<Fn>(fn)); }
+
+		/**
+		 * \brief View of (index, element) pairs
+		 */
+		[[nodiscard]] auto enumerate() const { return EnumerateView<Derived>(Self()); }
+
+		/**
+		 * \brief View of consecutive sub-ranges of size elements. The last one may be shorter
+		 */
+		[[nodiscard]] auto chunk(size_t size) const { return ChunkView<Derived>(Self(), size); }
+
+		/**
+		 * \brief View of every step-th element, starting with the first
+		 */
+		[[nodiscard]] auto stride(size_t step) const { return StrideView<Derived>(Self(), step); }
+
+		/**
+		 * \brief View of tuples of elements of this and others, as long as the shortest of them
+		 */
+		template <typename... Others>
+		[[nodiscard]] auto zip(Others&&... others) const;
+
+		/**
+		 * \brief Parallel execution policy. Splits a random access view across worker threads
+		 * \param num_threads upper bound on the threads used, 0 uses every hardware thread
+		 * \param min_batch smallest number of elements worth handing to a thread
+		 */
+		[[nodiscard]] auto par(u32 num_threads = 0, size_t min_batch = 1024) const { return ParallelView<Derived>(Self(), num_threads, min_batch); }
+
+		[[nodiscard]] size_t size() const requires detail::random_access_iterator<view_iterator_t<Derived>>
+		{
+			return static_cast<size_t>(Self().end() - Self().begin());
+		}
+
+		[[nodiscard]] bool empty() const { return !(Self().begin() != Self().end()); }
+
+	private:
+		Derived const& Self() const { return static_cast<Derived const&>(*this); }
+	};
+
+	// Ranges and views built on AxViewBase, as opposed to containers
+	template <typename T>
+	concept is_ax_view = std::is_base_of_v<AxViewBase<std::remove_cv_t<T>>, std::remove_cv_t<T>>;
+
 	template <is_range Range, typename Iterator = typename Range::iterator>
-	class AxRange
+	class AxRange : public AxViewBase<AxRange<Range, Iterator>>
 	{
 	public:
 		using iterator = Iterator;
+		using const_iterator = Iterator;
 
 		AxRange(iterator begin, iterator end) : m_begin(begin), m_end(end) {}
 
@@ -86,7 +211,7 @@ namespace ranges {
 	}
 
 	template <is_range Range, typename ViewFn, typename RangeIterator = typename AxRange<Range>::iterator>
-	class AxView
+	class AxView : public AxViewBase<AxView<Range, ViewFn, RangeIterator>>
 	{
 	public:
 		using base_iterator = RangeIterator;
@@ -146,6 +271,7 @@ namespace ranges {
 		struct is_view { };
 
 		using iterator = Iterator;
+		using const_iterator = Iterator;
 
 		AxView(AxRange<Range> const& range, ViewFn const& view_fn)
 		: m_range(range)
@@ -171,8 +297,8 @@ namespace ranges {
 		{
 		}
 
-		AxView(Range& range, ViewFn&& view_fn) : AxView(std::forward<AxRange<Range>>(AxRange(range)), std::forward<ViewFn>(view_fn)) {}
-		AxView(Range& range, ViewFn const& view_fn) : AxView(std::forward<AxRange<Range>>(AxRange(range)), view_fn) {}
+		AxView(Range& range, ViewFn&& view_fn) requires (!is_ax_view<Range>) : AxView(std::forward<AxRange<Range>>(AxRange(range)), std::forward<ViewFn>(view_fn)) {}
+		AxView(Range& range, ViewFn const& view_fn) requires (!is_ax_view<Range>) : AxView(std::forward<AxRange<Range>>(AxRange(range)), view_fn) {}
 
 		//AxView(AxView const& inner, ViewFn&& view_fn) : AxView(inner.m_range, )
 
@@ -216,5 +342,433 @@ namespace ranges {
 		return AxView(std::forward<Range>(range), filter_and(std::forward<ViewFn1>(view_fn1), std::forward<ViewFn2>(view_fn2)));
 	}
 
+	/**
+	 * \brief Wraps a container in an AxRange, or returns a view unchanged
+	 */
+	template <typename Rng>
+	auto all(Rng&& rng)
+	{
+		using range_type = std::remove_reference_t<Rng>;
+		if constexpr (is_ax_view<range_type>)
+		{
+			return std::remove_cv_t<range_type>(rng);
+		}
+		else
+		{
+			static_assert(std::is_lvalue_reference_v<Rng>, "Views of temporary containers would dangle");
+			using iterator = decltype(rng.begin());
+			return AxRange<std::remove_cv_t<range_type>, iterator>(rng.begin(), rng.end());
+		}
+	}
+
+	template <typename Rng>
+	using all_t = decltype(all(std::declval<Rng>()));
+
+	template <typename Base, typename Fn>
+	class TransformView : public AxViewBase<TransformView<Base, Fn>>
+	{
+		using base_iterator = view_iterator_t<Base>;
+
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = detail::iterator_category_t<base_iterator>;
+			using reference = std::invoke_result_t<Fn const&, iter_reference_t<base_iterator>>;
+			using value_type = std::remove_cvref_t<reference>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+
+			Iterator() = default;
+			Iterator(base_iterator it, Fn const* fn) : m_it(it), m_fn(fn) {}
+
+			Iterator& operator++() { ++m_it; return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			bool operator==(Iterator const& rhs) const { return m_it == rhs.m_it; }
+			bool operator!=(Iterator const& rhs) const { return !(m_it == rhs.m_it); }
+
+			reference operator*() const { return std::invoke(*m_fn, *m_it); }
+
+			Iterator operator+(difference_type n) const requires detail::random_access_iterator<base_iterator> { return { detail::Advance(m_it, n), m_fn }; }
+			difference_type operator-(Iterator const& rhs) const requires detail::random_access_iterator<base_iterator> { return m_it - rhs.m_it; }
+
+		private:
+			base_iterator m_it;
+			Fn const* m_fn {};
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+
+		TransformView(Base base, Fn fn) : m_base(std::move(base)), m_fn(std::move(fn)) {}
+
+		[[nodiscard]] iterator begin() const { return { m_base.begin(), &m_fn }; }
+		[[nodiscard]] iterator end() const { return { m_base.end(), &m_fn }; }
+
+	private:
+		Base m_base;
+		Fn m_fn;
+	};
+
+	template <typename... Bases>
+	class ZipView : public AxViewBase<ZipView<Bases...>>
+	{
+		using base_iterators = std::tuple<view_iterator_t<Bases>...>;
+		static constexpr bool kRandomAccess = (detail::random_access_iterator<view_iterator_t<Bases>> && ...);
+
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = std::conditional_t<kRandomAccess, std::random_access_iterator_tag, std::forward_iterator_tag>;
+			using reference = std::tuple<iter_reference_t<view_iterator_t<Bases>>...>;
+			using value_type = reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+
+			Iterator() = default;
+			explicit Iterator(base_iterators its) : m_its(std::move(its)) {}
+
+			Iterator& operator++()
+			{
+				std::apply([](auto&... its) { (++its, ...); }, m_its);
+				return *this;
+			}
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			// The zipped range ends with its shortest input, so iterators are equal as soon as any input is
+			bool operator==(Iterator const& rhs) const { return AnyEqual(rhs, std::index_sequence_for<Bases...>{}); }
+			bool operator!=(Iterator const& rhs) const { return !operator==(rhs); }
+
+			reference operator*() const
+			{
+				return std::apply([](auto const&... its) { return reference(*its...); }, m_its);
+			}
+
+			Iterator operator+(difference_type n) const requires kRandomAccess
+			{
+				return Iterator(std::apply([n](auto const&... its) { return base_iterators(detail::Advance(its, n)...); }, m_its));
+			}
+
+			difference_type operator-(Iterator const& rhs) const requires kRandomAccess
+			{
+				return MinDistance(rhs, std::index_sequence_for<Bases...>{});
+			}
+
+		private:
+			template <size_t... I>
+			bool AnyEqual(Iterator const& rhs, std::index_sequence<I...>) const
+			{
+				return ((std::get<I>(m_its) == std::get<I>(rhs.m_its)) || ...);
+			}
+
+			template <size_t... I>
+			difference_type MinDistance(Iterator const& rhs, std::index_sequence<I...>) const
+			{
+				return std::min({ static_cast<difference_type>(std::get<I>(m_its) - std::get<I>(rhs.m_its))... });
+			}
+
+			base_iterators m_its;
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+
+		explicit ZipView(Bases... bases) : m_bases(std::move(bases)...) {}
+
+		[[nodiscard]] iterator begin() const { return Iterator(std::apply([](auto const&... bases) { return base_iterators(bases.begin()...); }, m_bases)); }
+		[[nodiscard]] iterator end() const { return Iterator(std::apply([](auto const&... bases) { return base_iterators(bases.end()...); }, m_bases)); }
+
+	private:
+		std::tuple<Bases...> m_bases;
+	};
+
+	template <typename Base>
+	class EnumerateView : public AxViewBase<EnumerateView<Base>>
+	{
+		using base_iterator = view_iterator_t<Base>;
+
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = detail::iterator_category_t<base_iterator>;
+			using reference = std::pair<size_t, iter_reference_t<base_iterator>>;
+			using value_type = reference;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+
+			Iterator() = default;
+			Iterator(base_iterator it, size_t index) : m_it(it), m_index(index) {}
+
+			Iterator& operator++() { ++m_it; ++m_index; return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			bool operator==(Iterator const& rhs) const { return m_it == rhs.m_it; }
+			bool operator!=(Iterator const& rhs) const { return !(m_it == rhs.m_it); }
+
+			reference operator*() const { return reference(m_index, *m_it); }
+
+			Iterator operator+(difference_type n) const requires detail::random_access_iterator<base_iterator> { return { detail::Advance(m_it, n), m_index + n }; }
+			difference_type operator-(Iterator const& rhs) const requires detail::random_access_iterator<base_iterator> { return m_it - rhs.m_it; }
+
+		private:
+			base_iterator m_it;
+			size_t m_index {};
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+
+		explicit EnumerateView(Base base) : m_base(std::move(base)) {}
+
+		[[nodiscard]] iterator begin() const { return { m_base.begin(), 0 }; }
+		[[nodiscard]] iterator end() const { return { m_base.end(), 0 }; }
+
+	private:
+		Base m_base;
+	};
+
+	namespace detail
+	{
+		// Iterator over the positions first, first + step, first + 2 * step, ... clamped to the end of the underlying range.
+		// Shared by chunk and stride, which only differ in what they yield at each position.
+		template <typename BaseIterator>
+		class StepIterator
+		{
+		public:
+			using difference_type = std::ptrdiff_t;
+
+			StepIterator() = default;
+			StepIterator(BaseIterator it, BaseIterator end, std::ptrdiff_t step) : m_it(it), m_end(end), m_step(step) {}
+
+			StepIterator& operator++() { AdvanceBounded(m_it, m_step, m_end); return *this; }
+
+			bool operator==(StepIterator const& rhs) const { return m_it == rhs.m_it; }
+
+			StepIterator operator+(difference_type n) const requires random_access_iterator<BaseIterator>
+			{
+				StepIterator tmp(*this);
+				AdvanceBounded(tmp.m_it, n * m_step, m_end);
+				return tmp;
+			}
+
+			difference_type operator-(StepIterator const& rhs) const requires random_access_iterator<BaseIterator>
+			{
+				return (m_it - rhs.m_it + m_step - 1) / m_step;
+			}
+
+			BaseIterator current() const { return m_it; }
+
+			BaseIterator next() const
+			{
+				BaseIterator it = m_it;
+				AdvanceBounded(it, m_step, m_end);
+				return it;
+			}
+
+		private:
+			BaseIterator m_it;
+			BaseIterator m_end;
+			std::ptrdiff_t m_step {};
+		};
+	}
+
+	template <typename Base>
+	class ChunkView : public AxViewBase<ChunkView<Base>>
+	{
+		using base_iterator = view_iterator_t<Base>;
+		using step_iterator = detail::StepIterator<base_iterator>;
+
+	public:
+		using chunk_type = AxRange<Base, base_iterator>;
+
+		class Iterator
+		{
+		public:
+			using iterator_category = detail::iterator_category_t<base_iterator>;
+			using reference = chunk_type;
+			using value_type = chunk_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+
+			Iterator() = default;
+			explicit Iterator(step_iterator it) : m_it(it) {}
+
+			Iterator& operator++() { ++m_it; return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			bool operator==(Iterator const& rhs) const { return m_it == rhs.m_it; }
+			bool operator!=(Iterator const& rhs) const { return !(m_it == rhs.m_it); }
+
+			reference operator*() const { return chunk_type(m_it.current(), m_it.next()); }
+
+			Iterator operator+(difference_type n) const requires detail::random_access_iterator<base_iterator> { return Iterator(m_it + n); }
+			difference_type operator-(Iterator const& rhs) const requires detail::random_access_iterator<base_iterator> { return m_it - rhs.m_it; }
+
+		private:
+			step_iterator m_it;
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+
+		ChunkView(Base base, size_t size) : m_base(std::move(base)), m_size(static_cast<std::ptrdiff_t>(size))
+		{
+			axAssertFmt(size > 0, "Chunk size must be positive");
+		}
+
+		[[nodiscard]] iterator begin() const { return Iterator(step_iterator(m_base.begin(), m_base.end(), m_size)); }
+		[[nodiscard]] iterator end() const { return Iterator(step_iterator(m_base.end(), m_base.end(), m_size)); }
+
+	private:
+		Base m_base;
+		std::ptrdiff_t m_size;
+	};
+
+	template <typename Base>
+	class StrideView : public AxViewBase<StrideView<Base>>
+	{
+		using base_iterator = view_iterator_t<Base>;
+		using step_iterator = detail::StepIterator<base_iterator>;
+
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = detail::iterator_category_t<base_iterator>;
+			using reference = iter_reference_t<base_iterator>;
+			using value_type = std::remove_cvref_t<reference>;
+			using difference_type = std::ptrdiff_t;
+			using pointer = void;
+
+			Iterator() = default;
+			explicit Iterator(step_iterator it) : m_it(it) {}
+
+			Iterator& operator++() { ++m_it; return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+
+			bool operator==(Iterator const& rhs) const { return m_it == rhs.m_it; }
+			bool operator!=(Iterator const& rhs) const { return !(m_it == rhs.m_it); }
+
+			reference operator*() const { return *m_it.current(); }
+
+			Iterator operator+(difference_type n) const requires detail::random_access_iterator<base_iterator> { return Iterator(m_it + n); }
+			difference_type operator-(Iterator const& rhs) const requires detail::random_access_iterator<base_iterator> { return m_it - rhs.m_it; }
+
+		private:
+			step_iterator m_it;
+		};
+
+		using iterator = Iterator;
+		using const_iterator = Iterator;
+
+		StrideView(Base base, size_t step) : m_base(std::move(base)), m_step(static_cast<std::ptrdiff_t>(step))
+		{
+			axAssertFmt(step > 0, "Stride must be positive");
+		}
+
+		[[nodiscard]] iterator begin() const { return Iterator(step_iterator(m_base.begin(), m_base.end(), m_step)); }
+		[[nodiscard]] iterator end() const { return Iterator(step_iterator(m_base.end(), m_base.end(), m_step)); }
+
+	private:
+		Base m_base;
+		std::ptrdiff_t m_step;
+	};
+
+	/**
+	 * \brief Execution policy returned by par(). The view is split into contiguous batches that run on worker threads,
+	 * so func must be safe to call concurrently for different elements.
+	 */
+	template <typename View>
+	class ParallelView
+	{
+		using iterator = view_iterator_t<View>;
+
+	public:
+		ParallelView(View view, u32 num_threads, size_t min_batch)
+		: m_view(std::move(view)), m_numThreads(num_threads), m_minBatch(min_batch)
+		{
+			static_assert(detail::random_access_iterator<iterator>, "Only random access views can be split across threads");
+		}
+
+		/**
+		 * \brief Calls func(element) for every element of the view and returns when all calls have finished
+		 */
+		template <typename Func>
+		void forEach(Func&& func) const
+		{
+			forEachBatch([&func](auto batch)
+			{
+				for (auto&& elem : batch)
+					func(elem);
+			});
+		}
+
+		/**
+		 * \brief Calls func(batch) once per batch, where batch is an AxRange over a contiguous part of the view.
+		 * Useful when per-thread setup (scratch buffers, accumulators) should happen once per batch
+		 */
+		template <typename Func>
+		void forEachBatch(Func&& func) const
+		{
+			struct Context
+			{
+				iterator begin;
+				std::remove_reference_t<Func>* func;
+			};
+
+			Context ctx { m_view.begin(), &func };
+			concurrency::parallelFor(m_view.size(), m_minBatch, m_numThreads, [](void* p, size_t begin, size_t end)
+			{
+				Context const& context = *static_cast<Context const*>(p);
+				(*context.func)(AxRange<View, iterator>(detail::Advance(context.begin, begin), detail::Advance(context.begin, end)));
+			}, &ctx);
+		}
+
+	private:
+		View m_view;
+		u32 m_numThreads;
+		size_t m_minBatch;
+	};
+
+	template <typename Derived>
+	template <typename... Others>
+	auto AxViewBase<Derived>::zip(Others&&... others) const
+	{
+		return ZipView<Derived, all_t<Others>...>(Self(), all(std::forward<Others>(others))...);
+	}
+
+	template <typename Rng, typename Fn>
+	auto transform(Rng&& rng, Fn&& fn)
+	{
+		return all(std::forward<Rng>(rng)).transform(std::forward<Fn>(fn));
+	}
+
+	template <typename Rng, typename... Others>
+	auto zip(Rng&& rng, Others&&... others)
+	{
+		return all(std::forward<Rng>(rng)).zip(std::forward<Others>(others)...);
+	}
+
+	template <typename Rng>
+	auto enumerate(Rng&& rng)
+	{
+		return all(std::forward<Rng>(rng)).enumerate();
+	}
+
+	template <typename Rng>
+	auto chunk(Rng&& rng, size_t size)
+	{
+		return all(std::forward<Rng>(rng)).chunk(size);
+	}
+
+	template <typename Rng>
+	auto stride(Rng&& rng, size_t step)
+	{
+		return all(std::forward<Rng>(rng)).stride(step);
+	}
+
 }
 }
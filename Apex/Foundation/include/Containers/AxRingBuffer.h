@@ -0,0 +1,390 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "Containers/AxArray.h"
+#include "Core/Asserts.h"
+#include "Core/TypeTraits.h"
+#include "Core/Types.h"
+#include "Memory/MemoryManager.h"
+
+namespace apex {
+
+	enum class RingBufferMode
+	{
+		eGrow,      // grows when full, behaves like a deque
+		eOverwrite, // fixed capacity, pushing into a full buffer drops the element at the opposite end
+	};
+
+	/**
+	 * \brief Double ended queue stored in a power-of-two ring buffer.
+	 * \details Pushing and popping at either end is O(1) and indexing is a single mask. The elements always occupy at most
+	 * two contiguous runs of the buffer, which spans() returns for bulk processing (e.g. memcpy or SIMD over the contents).
+	 * In RingBufferMode::eOverwrite the capacity is fixed at construction and the oldest elements are dropped to make room,
+	 * which suits histories and log rings.
+	 */
+	template <typename T>
+	class AxRingBuffer
+	{
+	public:
+		using value_type = T;
+		using reference = T&;
+		using const_reference = T const&;
+		using pointer = T*;
+		using const_pointer = T const*;
+
+		/**
+		 * \brief The contents in order: first followed by second. second is empty when the contents do not wrap around
+		 */
+		template <typename U>
+		struct Spans
+		{
+			AxArrayRef<U> first;
+			AxArrayRef<U> second;
+		};
+
+		template <bool Const>
+		class Iterator
+		{
+			using owner_ptr = std::conditional_t<Const, const AxRingBuffer*, AxRingBuffer*>;
+
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<Const, T const*, T*>;
+			using reference = std::conditional_t<Const, T const&, T&>;
+
+			Iterator() = default;
+			Iterator(owner_ptr owner, size_t index) : m_owner(owner), m_index(index) {}
+
+			// Allow conversion from non-const iterator to const iterator
+			Iterator(Iterator<false> const& other) requires Const : m_owner(other.m_owner), m_index(other.m_index) {}
+
+			Iterator& operator++() { ++m_index; return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+			Iterator& operator--() { --m_index; return *this; }
+			Iterator operator--(int) { Iterator tmp(*this); operator--(); return tmp; }
+
+			Iterator& operator+=(difference_type n) { m_index += n; return *this; }
+			Iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+
+			Iterator operator+(difference_type n) const { return { m_owner, m_index + n }; }
+			Iterator operator-(difference_type n) const { return { m_owner, m_index - n }; }
+			friend Iterator operator+(difference_type n, Iterator const& it) { return it + n; }
+			difference_type operator-(Iterator const& rhs) const { return static_cast<difference_type>(m_index) - static_cast<difference_type>(rhs.m_index); }
+
+			bool operator==(Iterator const& rhs) const { return m_index == rhs.m_index; }
+			bool operator!=(Iterator const& rhs) const { return m_index != rhs.m_index; }
+			bool operator<(Iterator const& rhs) const { return m_index < rhs.m_index; }
+			bool operator<=(Iterator const& rhs) const { return m_index <= rhs.m_index; }
+			bool operator>(Iterator const& rhs) const { return m_index > rhs.m_index; }
+			bool operator>=(Iterator const& rhs) const { return m_index >= rhs.m_index; }
+
+			reference operator*() const { return (*m_owner)[m_index]; }
+			pointer operator->() const { return &(*m_owner)[m_index]; }
+			reference operator[](difference_type n) const { return (*m_owner)[m_index + n]; }
+
+		private:
+			owner_ptr m_owner {};
+			size_t m_index {};
+
+			friend class Iterator<true>;
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		AxRingBuffer() = default;
+
+		/**
+		 * \param capacity rounded up to the next power of two
+		 */
+		explicit AxRingBuffer(size_t capacity, RingBufferMode mode = RingBufferMode::eGrow)
+		: m_mode(mode)
+		{
+			axAssertFmt(mode == RingBufferMode::eGrow || capacity > 0, "Overwrite ring buffers need a capacity");
+			if (capacity > 0)
+			{
+				Reallocate(std::bit_ceil(capacity));
+			}
+		}
+
+		~AxRingBuffer()
+		{
+			clear();
+			Free();
+		}
+
+		NON_COPYABLE(AxRingBuffer);
+
+		AxRingBuffer(AxRingBuffer&& other) noexcept
+		: m_data(std::exchange(other.m_data, nullptr))
+		, m_capacity(std::exchange(other.m_capacity, 0))
+		, m_head(std::exchange(other.m_head, 0))
+		, m_size(std::exchange(other.m_size, 0))
+		, m_mode(other.m_mode)
+		{}
+
+		AxRingBuffer& operator=(AxRingBuffer&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clear();
+				Free();
+				m_data = std::exchange(other.m_data, nullptr);
+				m_capacity = std::exchange(other.m_capacity, 0);
+				m_head = std::exchange(other.m_head, 0);
+				m_size = std::exchange(other.m_size, 0);
+				m_mode = other.m_mode;
+			}
+			return *this;
+		}
+
+		void reserve(size_t capacity)
+		{
+			if (capacity > m_capacity)
+			{
+				axAssertFmt(m_mode == RingBufferMode::eGrow, "Cannot grow an overwrite ring buffer");
+				Reallocate(std::bit_ceil(capacity));
+			}
+		}
+
+		template <typename... Args>
+		reference emplace_back(Args&&... args)
+		{
+			if (m_size == m_capacity)
+			{
+				return EmplaceBackFull(std::forward<Args>(args)...);
+			}
+			T* slot = m_data + PhysicalIndex(m_size);
+			new (slot) T(std::forward<Args>(args)...);
+			m_size++;
+			return *slot;
+		}
+
+		template <typename... Args>
+		reference emplace_front(Args&&... args)
+		{
+			if (m_size == m_capacity)
+			{
+				return EmplaceFrontFull(std::forward<Args>(args)...);
+			}
+			const size_t head = (m_head - 1) & Mask();
+			new (m_data + head) T(std::forward<Args>(args)...);
+			m_head = head;
+			m_size++;
+			return m_data[head];
+		}
+
+		void push_back(const value_type& obj) { emplace_back(obj); }
+		void push_back(value_type&& obj)      { emplace_back(std::move(obj)); }
+
+		void push_front(const value_type& obj) { emplace_front(obj); }
+		void push_front(value_type&& obj)      { emplace_front(std::move(obj)); }
+
+		/**
+		 * \brief Copies count elements to the back, in at most two contiguous copies.
+		 * In overwrite mode only the last capacity() elements are kept
+		 */
+		void push_back_n(const T* data, size_t count)
+		{
+			if (m_mode == RingBufferMode::eOverwrite)
+			{
+				if (count > m_capacity)
+				{
+					data += count - m_capacity;
+					count = m_capacity;
+				}
+				const size_t available = m_capacity - m_size;
+				if (count > available)
+				{
+					pop_front_n(count - available);
+				}
+			}
+			else
+			{
+				reserve(m_size + count);
+			}
+
+			const size_t tail = PhysicalIndex(m_size);
+			const size_t firstCount = std::min(count, m_capacity - tail);
+			std::uninitialized_copy_n(data, firstCount, m_data + tail);
+			std::uninitialized_copy_n(data + firstCount, count - firstCount, m_data);
+			m_size += count;
+		}
+
+		void pop_front()
+		{
+			axAssertFmt(m_size > 0, "Cannot pop from an empty ring buffer");
+			std::destroy_at(m_data + m_head);
+			m_head = (m_head + 1) & Mask();
+			m_size--;
+		}
+
+		void pop_back()
+		{
+			axAssertFmt(m_size > 0, "Cannot pop from an empty ring buffer");
+			std::destroy_at(m_data + PhysicalIndex(m_size - 1));
+			m_size--;
+		}
+
+		/**
+		 * \brief Removes the first count elements
+		 */
+		void pop_front_n(size_t count)
+		{
+			axAssertFmt(count <= m_size, "Cannot pop more elements than the ring buffer holds");
+			if constexpr (!std::is_trivially_destructible_v<T>)
+			{
+				for (size_t i = 0; i < count; i++)
+				{
+					std::destroy_at(m_data + PhysicalIndex(i));
+				}
+			}
+			m_head = count == m_size ? 0 : (m_head + count) & Mask();
+			m_size -= count;
+		}
+
+		void clear()
+		{
+			pop_front_n(m_size);
+		}
+
+		[[nodiscard]] auto operator[](size_t index) -> reference
+		{
+			axAssert(index < m_size);
+			return m_data[PhysicalIndex(index)];
+		}
+
+		[[nodiscard]] auto operator[](size_t index) const -> const_reference
+		{
+			return const_cast<AxRingBuffer*>(this)->operator[](index);
+		}
+
+		[[nodiscard]] auto front() -> reference             { axAssert(m_size > 0); return m_data[m_head]; }
+		[[nodiscard]] auto front() const -> const_reference { return const_cast<AxRingBuffer*>(this)->front(); }
+
+		[[nodiscard]] auto back() -> reference             { axAssert(m_size > 0); return m_data[PhysicalIndex(m_size - 1)]; }
+		[[nodiscard]] auto back() const -> const_reference { return const_cast<AxRingBuffer*>(this)->back(); }
+
+		[[nodiscard]] auto spans() -> Spans<T>
+		{
+			const size_t firstCount = std::min(m_size, m_capacity - m_head);
+			return { make_array_ref<T>(m_data + m_head, firstCount), make_array_ref<T>(m_data, m_size - firstCount) };
+		}
+
+		[[nodiscard]] auto spans() const -> Spans<const T>
+		{
+			auto [first, second] = const_cast<AxRingBuffer*>(this)->spans();
+			return { make_array_ref<const T>(first.data(), first.size()), make_array_ref<const T>(second.data(), second.size()) };
+		}
+
+		[[nodiscard]] size_t size() const         { return m_size; }
+		[[nodiscard]] size_t capacity() const     { return m_capacity; }
+		[[nodiscard]] bool   empty() const        { return m_size == 0; }
+		[[nodiscard]] bool   full() const         { return m_size == m_capacity; }
+		[[nodiscard]] RingBufferMode mode() const { return m_mode; }
+
+		#pragma region Iterator functions
+		[[nodiscard]] iterator begin() { return { this, 0 }; }
+		[[nodiscard]] iterator end() { return { this, m_size }; }
+
+		[[nodiscard]] const_iterator cbegin() const { return { this, 0 }; }
+		[[nodiscard]] const_iterator cend() const { return { this, m_size }; }
+
+		[[nodiscard]] const_iterator begin() const { return cbegin(); }
+		[[nodiscard]] const_iterator end() const { return cend(); }
+		#pragma endregion
+
+	private:
+		[[nodiscard]] size_t Mask() const { return m_capacity - 1; }
+		[[nodiscard]] size_t PhysicalIndex(size_t index) const { return (m_head + index) & Mask(); }
+
+		// The arguments may refer to an element that is about to be dropped or relocated, so construct the value first
+		template <typename... Args>
+		reference EmplaceBackFull(Args&&... args)
+		{
+			T value(std::forward<Args>(args)...);
+			MakeRoom(&AxRingBuffer::pop_front);
+			return emplace_back(std::move(value));
+		}
+
+		template <typename... Args>
+		reference EmplaceFrontFull(Args&&... args)
+		{
+			T value(std::forward<Args>(args)...);
+			MakeRoom(&AxRingBuffer::pop_back);
+			return emplace_front(std::move(value));
+		}
+
+		// Grows the buffer, or in overwrite mode drops an element from the opposite end
+		void MakeRoom(void (AxRingBuffer::*drop)())
+		{
+			if (m_mode == RingBufferMode::eOverwrite)
+			{
+				(this->*drop)();
+			}
+			else
+			{
+				Reallocate(std::max<size_t>(m_capacity * 2, 16));
+			}
+		}
+
+		// Moves the contents to a new buffer, unwrapped so that the front is at index 0
+		void Reallocate(size_t capacity)
+		{
+			axAssert(std::has_single_bit(capacity) && capacity >= m_size);
+
+			T* data = static_cast<T*>(mem::MemoryManager::allocate(capacity * sizeof(T)));
+
+			auto [first, second] = spans();
+			if constexpr (is_trivially_relocatable_v<T>)
+			{
+				if (first.size())  std::memcpy(static_cast<void*>(data), first.data(), first.size() * sizeof(T));
+				if (second.size()) std::memcpy(static_cast<void*>(data + first.size()), second.data(), second.size() * sizeof(T));
+			}
+			else
+			{
+				std::uninitialized_move_n(first.data(), first.size(), data);
+				std::uninitialized_move_n(second.data(), second.size(), data + first.size());
+				std::destroy_n(first.data(), first.size());
+				std::destroy_n(second.data(), second.size());
+			}
+
+			const size_t size = m_size;
+			Free();
+			m_data = data;
+			m_capacity = capacity;
+			m_head = 0;
+			m_size = size;
+		}
+
+		void Free()
+		{
+			if (m_data)
+			{
+				mem::MemoryManager::free(m_data);
+				m_data = nullptr;
+			}
+			m_capacity = 0;
+			m_head = 0;
+			m_size = 0;
+		}
+
+	private:
+		T*             m_data {};
+		size_t         m_capacity {}; // always zero or a power of two
+		size_t         m_head {};
+		size_t         m_size {};
+		RingBufferMode m_mode { RingBufferMode::eGrow };
+	};
+
+	template <typename T>
+	using AxDeque = AxRingBuffer<T>;
+
+}
@@ -0,0 +1,207 @@
+#pragma once
+#include "AxArray.h"
+#include "Core/Asserts.h"
+#include "Core/Types.h"
+
+namespace apex {
+
+	/**
+	 * \brief Generation checked reference to an element in an AxSlotMap.
+	 * A handle stays valid until its element is erased. Handles to erased elements are detected
+	 * through the generation, even after the slot has been reused.
+	 */
+	struct AxSlotHandle
+	{
+		u32 index { Constants::u32_MAX };
+		u32 generation { 0 };
+
+		[[nodiscard]] constexpr bool isNull() const { return generation == 0; }
+
+		constexpr bool operator==(AxSlotHandle const&) const = default;
+	};
+
+	/**
+	 * \brief Container with stable, generation checked handles and contiguous storage.
+	 *
+	 * Elements are kept packed in a dense array, so iteration is a linear walk with no holes.
+	 * An indirection table of slots maps handles to dense indices. Insertion and erasure are O(1).
+	 * Erasure moves the last element into the hole, so the order of elements is not preserved.
+	 *
+	 * Based on "Slot Map", Allan Deutsch, C++Now 2017
+	 * \tparam StoredType type of elements stored in the map
+	 */
+	template <typename StoredType>
+	class AxSlotMap
+	{
+	public:
+		using value_type = StoredType;
+		using handle_type = AxSlotHandle;
+		using dense_array = AxArray<value_type>;
+		using iterator = typename dense_array::iterator;
+		using const_iterator = typename dense_array::const_iterator;
+
+		AxSlotMap() = default;
+
+		explicit AxSlotMap(size_t capacity)
+		{
+			reserve(capacity);
+		}
+
+		void reserve(size_t capacity)
+		{
+			m_dense.reserve(capacity);
+			m_denseToSlot.reserve(capacity);
+			m_slots.reserve(capacity);
+		}
+
+		/**
+		 * \brief Constructs a new element in place.
+		 * \return handle to the new element
+		 */
+		template <typename... Args>
+		handle_type emplace(Args&&... args)
+		{
+			const u32 slotIndex = AcquireSlot();
+			Slot& slot = m_slots[slotIndex];
+
+			slot.denseIndex = static_cast<u32>(m_dense.size());
+			m_dense.emplace_back(std::forward<Args>(args)...);
+			m_denseToSlot.emplace_back(slotIndex);
+
+			return { slotIndex, slot.generation };
+		}
+
+		handle_type insert(const value_type& value) { return emplace(value); }
+		handle_type insert(value_type&& value) { return emplace(std::move(value)); }
+
+		/**
+		 * \brief Removes the element referenced by handle. The last element is moved into its place.
+		 * \return true if the element was removed; false if the handle is stale or null.
+		 */
+		bool erase(handle_type handle)
+		{
+			if (!contains(handle))
+				return false;
+
+			Slot& slot = m_slots[handle.index];
+			const u32 denseIndex = slot.denseIndex;
+			const u32 lastIndex = static_cast<u32>(m_dense.size() - 1);
+
+			if (denseIndex != lastIndex)
+			{
+				m_dense[denseIndex] = std::move(m_dense[lastIndex]);
+				m_denseToSlot[denseIndex] = m_denseToSlot[lastIndex];
+				m_slots[m_denseToSlot[denseIndex]].denseIndex = denseIndex;
+			}
+			m_dense.pop_back();
+			m_denseToSlot.pop_back();
+
+			ReleaseSlot(handle.index);
+			return true;
+		}
+
+		void clear()
+		{
+			for (u32 denseIndex = 0; denseIndex < m_denseToSlot.size(); denseIndex++)
+			{
+				ReleaseSlot(m_denseToSlot[denseIndex]);
+			}
+			m_dense.clear();
+			m_denseToSlot.clear();
+		}
+
+		[[nodiscard]] bool contains(handle_type handle) const
+		{
+			return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation;
+		}
+
+		/**
+		 * \brief Returns a pointer to the element referenced by handle, or nullptr if the handle is stale.
+		 */
+		[[nodiscard]] auto get(handle_type handle) -> value_type*
+		{
+			return contains(handle) ? &m_dense[m_slots[handle.index].denseIndex] : nullptr;
+		}
+
+		[[nodiscard]] auto get(handle_type handle) const -> const value_type*
+		{
+			return const_cast<AxSlotMap*>(this)->get(handle);
+		}
+
+		[[nodiscard]] auto operator[](handle_type handle) -> value_type&
+		{
+			axAssertFmt(contains(handle), "Invalid or stale slot map handle!");
+			return m_dense[m_slots[handle.index].denseIndex];
+		}
+
+		[[nodiscard]] auto operator[](handle_type handle) const -> const value_type&
+		{
+			return const_cast<AxSlotMap*>(this)->operator[](handle);
+		}
+
+		/**
+		 * \brief Returns the handle of the element at a position in the dense array. Useful while iterating.
+		 */
+		[[nodiscard]] handle_type getHandle(size_t dense_index) const
+		{
+			axAssert(dense_index < m_dense.size());
+			const u32 slotIndex = m_denseToSlot[dense_index];
+			return { slotIndex, m_slots[slotIndex].generation };
+		}
+
+		[[nodiscard]] size_t size() const     { return m_dense.size(); }
+		[[nodiscard]] size_t capacity() const { return m_dense.capacity(); }
+		[[nodiscard]] bool   empty() const    { return m_dense.empty(); }
+
+		[[nodiscard]] auto data() -> value_type*             { return m_dense.data(); }
+		[[nodiscard]] auto data() const -> const value_type* { return m_dense.data(); }
+
+		[[nodiscard]] iterator begin()              { return m_dense.begin(); }
+		[[nodiscard]] iterator end()                { return m_dense.end(); }
+		[[nodiscard]] const_iterator begin() const  { return m_dense.begin(); }
+		[[nodiscard]] const_iterator end() const    { return m_dense.end(); }
+		[[nodiscard]] const_iterator cbegin() const { return m_dense.cbegin(); }
+		[[nodiscard]] const_iterator cend() const   { return m_dense.cend(); }
+
+	protected:
+		struct Slot
+		{
+			u32 denseIndex;  // index in the dense array while in use, next free slot otherwise
+			u32 generation;  // bumped on every release, never 0
+		};
+
+		u32 AcquireSlot()
+		{
+			if (m_freeHead != kEndOfFreeList)
+			{
+				const u32 slotIndex = m_freeHead;
+				m_freeHead = m_slots[slotIndex].denseIndex;
+				return slotIndex;
+			}
+
+			axAssertFmt(m_slots.size() < kEndOfFreeList, "Slot map is full!");
+			m_slots.emplace_back(Slot{ 0, 1 });
+			return static_cast<u32>(m_slots.size() - 1);
+		}
+
+		void ReleaseSlot(u32 slot_index)
+		{
+			Slot& slot = m_slots[slot_index];
+			// Skip 0 on wrap around so a null handle can never match
+			slot.generation = (slot.generation == Constants::u32_MAX) ? 1 : slot.generation + 1;
+			slot.denseIndex = m_freeHead;
+			m_freeHead = slot_index;
+		}
+
+	private:
+		static constexpr u32 kEndOfFreeList = Constants::u32_MAX;
+
+		dense_array  m_dense;
+		AxArray<u32> m_denseToSlot;
+		AxArray<Slot> m_slots;
+		u32 m_freeHead { kEndOfFreeList };
+
+		friend class AxSlotMapTest;
+	};
+
+}
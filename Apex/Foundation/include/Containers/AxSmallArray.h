@@ -0,0 +1,96 @@
+#pragma once
+#include "Containers/AxArray.h"
+
+namespace apex {
+
+	/**
+	 * \brief Array that stores up to N elements inline and only allocates from the MemoryManager when it grows past that.
+	 * \details All the array functionality lives in AxArrayBase<T, Small>, which is shared across every N.
+	 * Functions that do not care about the inline capacity can take an `AxArrayBase<T, Small>&`.
+	 * \tparam T Type of elements stored in the array
+	 * \tparam N Number of elements stored inline
+	 */
+	template <typename T, size_t N>
+	class AxSmallArray : public AxArrayBase<T, Small>
+	{
+		static_assert(N > 0, "Use AxArray for arrays without inline storage");
+
+		using base_type = AxArrayBase<T, Small>;
+
+	public:
+		static constexpr size_t kInlineCapacity = N;
+
+		AxSmallArray() noexcept
+		{
+			ResetToInline();
+		}
+
+		explicit AxSmallArray(size_t capacity) : AxSmallArray()
+		{
+			this->reserve(capacity);
+		}
+
+		AxSmallArray(std::initializer_list<T> init_list) : AxSmallArray()
+		{
+			this->CopyConstructFrom(init_list.begin(), init_list.size());
+		}
+
+		AxSmallArray(AxSmallArray const& other) : AxSmallArray()
+		{
+			this->CopyConstructFrom(other.data(), other.size());
+		}
+
+		template <StorageType OtherStorage>
+		explicit AxSmallArray(AxArrayBase<T, OtherStorage> const& other) : AxSmallArray()
+		{
+			this->CopyConstructFrom(other.data(), other.size());
+		}
+
+		AxSmallArray(AxSmallArray&& other) noexcept : AxSmallArray()
+		{
+			base_type::operator=(std::move(other));
+			other.RestoreInline();
+		}
+
+		~AxSmallArray() = default;
+
+		AxSmallArray& operator=(AxSmallArray const& other)
+		{
+			base_type::operator=(other);
+			return *this;
+		}
+
+		AxSmallArray& operator=(AxSmallArray&& other) noexcept
+		{
+			base_type::operator=(std::move(other));
+			other.RestoreInline();
+			return *this;
+		}
+
+		void reset()
+		{
+			base_type::reset();
+			ResetToInline();
+		}
+
+		[[nodiscard]] bool isInline() const { return this->IsInline(); }
+
+	private:
+		void ResetToInline()
+		{
+			this->m_data = reinterpret_cast<T*>(m_inlineStorage);
+			this->m_capacity = N;
+			axAssertFmt(this->IsInline(), "AxSmallArray inline storage is not laid out after AxArrayBase!");
+		}
+
+		// A moved-from array that handed over its heap buffer goes back to its own inline storage
+		void RestoreInline()
+		{
+			if (this->m_data == nullptr)
+				ResetToInline();
+		}
+
+		alignas(T) u8 m_inlineStorage[N * sizeof(T)];
+	};
+
+}
@@ -0,0 +1,374 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "Containers/AxArray.h"
+#include "Core/Asserts.h"
+#include "Core/TypeTraits.h"
+#include "Core/Types.h"
+#include "Memory/MemoryManager.h"
+
+namespace apex {
+
+	/**
+	 * \brief Structure of arrays container.
+	 * \details Each field is stored in its own column, so a loop over one field of every element (e.g. all positions)
+	 * reads contiguous memory and can be vectorised. All columns live in a single allocation and every column starts on
+	 * a kColumnAlignment boundary, so column<I>() and data<I>() can be fed straight to aligned SIMD loads.
+	 * Elements are accessed through proxy references (std::tuple of references), which work with structured bindings.
+	 * Columns are always kept in lock-step: element i is made of the i-th entry of every column.
+	 * \tparam Fields types of the columns
+	 */
+	template <typename... Fields>
+	class AxSoA
+	{
+	public:
+		static constexpr size_t kNumColumns = sizeof...(Fields);
+		static constexpr size_t kColumnAlignment = 64;
+
+		static_assert(kNumColumns > 0, "AxSoA needs at least one field");
+		static_assert(((alignof(Fields) <= kColumnAlignment) && ...), "Over aligned fields are not supported");
+
+		template <size_t I>
+		using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+		using value_type = std::tuple<Fields...>;
+		using reference = std::tuple<Fields&...>;
+		using const_reference = std::tuple<Fields const&...>;
+
+		template <bool Const>
+		class Iterator
+		{
+			using owner_ptr = std::conditional_t<Const, const AxSoA*, AxSoA*>;
+
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = AxSoA::value_type;
+			using difference_type = std::ptrdiff_t;
+			using reference = std::conditional_t<Const, AxSoA::const_reference, AxSoA::reference>;
+			using pointer = void;
+
+			Iterator() = default;
+			Iterator(owner_ptr owner, size_t index) : m_owner(owner), m_index(index) {}
+
+			// Allow conversion from non-const iterator to const iterator
+			Iterator(Iterator<false> const& other) requires Const : m_owner(other.m_owner), m_index(other.m_index) {}
+
+			Iterator& operator++() { ++m_index; return *this; }
+			Iterator operator++(int) { Iterator tmp(*this); operator++(); return tmp; }
+			Iterator& operator--() { --m_index; return *this; }
+			Iterator operator--(int) { Iterator tmp(*this); operator--(); return tmp; }
+
+			Iterator& operator+=(difference_type n) { m_index += n; return *this; }
+			Iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+
+			Iterator operator+(difference_type n) const { return { m_owner, m_index + n }; }
+			Iterator operator-(difference_type n) const { return { m_owner, m_index - n }; }
+			friend Iterator operator+(difference_type n, Iterator const& it) { return it + n; }
+			difference_type operator-(Iterator const& rhs) const { return static_cast<difference_type>(m_index) - static_cast<difference_type>(rhs.m_index); }
+
+			bool operator==(Iterator const& rhs) const { return m_index == rhs.m_index; }
+			bool operator!=(Iterator const& rhs) const { return m_index != rhs.m_index; }
+			bool operator<(Iterator const& rhs) const { return m_index < rhs.m_index; }
+			bool operator<=(Iterator const& rhs) const { return m_index <= rhs.m_index; }
+			bool operator>(Iterator const& rhs) const { return m_index > rhs.m_index; }
+			bool operator>=(Iterator const& rhs) const { return m_index >= rhs.m_index; }
+
+			reference operator*() const { return (*m_owner)[m_index]; }
+			reference operator[](difference_type n) const { return (*m_owner)[m_index + n]; }
+
+			[[nodiscard]] size_t index() const { return m_index; }
+
+		private:
+			owner_ptr m_owner {};
+			size_t m_index {};
+
+			friend class Iterator<true>;
+		};
+
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		AxSoA() = default;
+
+		explicit AxSoA(size_t capacity)
+		{
+			reserve(capacity);
+		}
+
+		~AxSoA()
+		{
+			clear();
+			Free();
+		}
+
+		NON_COPYABLE(AxSoA);
+
+		AxSoA(AxSoA&& other) noexcept
+		: m_block(std::exchange(other.m_block, nullptr))
+		, m_columns(std::exchange(other.m_columns, {}))
+		, m_size(std::exchange(other.m_size, 0))
+		, m_capacity(std::exchange(other.m_capacity, 0))
+		{}
+
+		AxSoA& operator=(AxSoA&& other) noexcept
+		{
+			if (this != &other)
+			{
+				clear();
+				Free();
+				m_block = std::exchange(other.m_block, nullptr);
+				m_columns = std::exchange(other.m_columns, {});
+				m_size = std::exchange(other.m_size, 0);
+				m_capacity = std::exchange(other.m_capacity, 0);
+			}
+			return *this;
+		}
+
+		void reserve(size_t capacity)
+		{
+			if (capacity > m_capacity)
+			{
+				Reallocate(capacity);
+			}
+		}
+
+		/**
+		 * \brief Changes the number of elements. New elements are default constructed in every column
+		 */
+		void resize(size_t size) requires (std::is_default_constructible_v<Fields> && ...)
+		{
+			reserve(size);
+			ForEachColumn([this, size]<size_t I>(std::integral_constant<size_t, I>)
+			{
+				field_type<I>* column = std::get<I>(m_columns);
+				if (size > m_size)
+					std::uninitialized_value_construct(column + m_size, column + size);
+				else
+					std::destroy(column + size, column + m_size);
+			});
+			m_size = size;
+		}
+
+		/**
+		 * \brief Appends an element, constructing the field of each column from the matching argument
+		 * \return proxy reference to the new element
+		 */
+		template <typename... Args> requires (sizeof...(Args) == kNumColumns)
+		reference emplace_back(Args&&... args)
+		{
+			if (m_size == m_capacity)
+			{
+				return GrowAndEmplaceBack(std::forward<Args>(args)...);
+			}
+
+			EmplaceAt(m_columns, m_size, std::index_sequence_for<Fields...>{}, std::forward<Args>(args)...);
+			return (*this)[m_size++];
+		}
+
+		reference push_back(Fields const&... values) { return emplace_back(values...); }
+		reference push_back(Fields&&... values) { return emplace_back(std::move(values)...); }
+
+		/**
+		 * \brief Removes the element at index in O(1) by moving the last element into its place. Does not preserve order
+		 */
+		void swap_remove(size_t index)
+		{
+			axAssertFmt(index < m_size, "Index out of range");
+			const size_t last = m_size - 1;
+			ForEachColumn([index, last, this]<size_t I>(std::integral_constant<size_t, I>)
+			{
+				field_type<I>* column = std::get<I>(m_columns);
+				if (index != last)
+					column[index] = std::move(column[last]);
+				std::destroy_at(column + last);
+			});
+			m_size = last;
+		}
+
+		void pop_back()
+		{
+			axAssertFmt(m_size > 0, "Cannot pop from an empty AxSoA");
+			swap_remove(m_size - 1);
+		}
+
+		void clear()
+		{
+			ForEachColumn([this]<size_t I>(std::integral_constant<size_t, I>)
+			{
+				std::destroy_n(std::get<I>(m_columns), m_size);
+			});
+			m_size = 0;
+		}
+
+		[[nodiscard]] reference operator[](size_t index)
+		{
+			axAssert(index < m_size);
+			return std::apply([index](Fields*... columns) { return reference(columns[index]...); }, m_columns);
+		}
+
+		[[nodiscard]] const_reference operator[](size_t index) const
+		{
+			axAssert(index < m_size);
+			return std::apply([index](Fields*... columns) { return const_reference(columns[index]...); }, m_columns);
+		}
+
+		template <size_t I>
+		[[nodiscard]] auto get(size_t index) -> field_type<I>&
+		{
+			axAssert(index < m_size);
+			return std::get<I>(m_columns)[index];
+		}
+
+		template <size_t I>
+		[[nodiscard]] auto get(size_t index) const -> field_type<I> const&
+		{
+			axAssert(index < m_size);
+			return std::get<I>(m_columns)[index];
+		}
+
+		/**
+		 * \brief Span over the I-th field of every element. The data is kColumnAlignment aligned
+		 */
+		template <size_t I>
+		[[nodiscard]] auto column() -> AxArrayRef<field_type<I>>
+		{
+			return make_array_ref<field_type<I>>(data<I>(), m_size);
+		}
+
+		template <size_t I>
+		[[nodiscard]] auto column() const -> AxArrayRef<const field_type<I>>
+		{
+			return make_array_ref<const field_type<I>>(const_cast<field_type<I>*>(data<I>()), m_size);
+		}
+
+		template <size_t I>
+		[[nodiscard]] auto data() -> field_type<I>* { return std::get<I>(m_columns); }
+
+		template <size_t I>
+		[[nodiscard]] auto data() const -> field_type<I> const* { return std::get<I>(m_columns); }
+
+		[[nodiscard]] size_t size() const     { return m_size; }
+		[[nodiscard]] size_t capacity() const { return m_capacity; }
+		[[nodiscard]] bool   empty() const    { return m_size == 0; }
+
+		#pragma region Iterator functions
+		[[nodiscard]] iterator begin() { return { this, 0 }; }
+		[[nodiscard]] iterator end() { return { this, m_size }; }
+
+		[[nodiscard]] const_iterator cbegin() const { return { this, 0 }; }
+		[[nodiscard]] const_iterator cend() const { return { this, m_size }; }
+
+		[[nodiscard]] const_iterator begin() const { return cbegin(); }
+		[[nodiscard]] const_iterator end() const { return cend(); }
+		#pragma endregion
+
+	private:
+		static constexpr size_t AlignUp(size_t size) { return (size + kColumnAlignment - 1) & ~(kColumnAlignment - 1); }
+
+		// Columns are laid out back to back, each padded to the column alignment
+		static constexpr size_t BlockSize(size_t capacity) { return (AlignUp(capacity * sizeof(Fields)) + ...); }
+
+		template <typename Func>
+		static void ForEachColumn(Func&& func)
+		{
+			[&func]<size_t... I>(std::index_sequence<I...>)
+			{
+				(func(std::integral_constant<size_t, I>{}), ...);
+			}(std::index_sequence_for<Fields...>{});
+		}
+
+		template <size_t... I, typename... Args>
+		static void EmplaceAt(std::tuple<Fields*...> const& columns, size_t index, std::index_sequence<I...>, Args&&... args)
+		{
+			(new (std::get<I>(columns) + index) field_type<I>(std::forward<Args>(args)), ...);
+		}
+
+		template <typename... Args>
+		reference GrowAndEmplaceBack(Args&&... args)
+		{
+			const size_t capacity = detail::CalculateGrowth(m_capacity, m_size + 1);
+			std::tuple<Fields*...> columns;
+			void* block = AllocateColumns(capacity, columns);
+
+			// Construct the new element first since args may reference an element in the old columns
+			EmplaceAt(columns, m_size, std::index_sequence_for<Fields...>{}, std::forward<Args>(args)...);
+
+			RelocateInto(block, columns, capacity);
+			return (*this)[m_size++];
+		}
+
+		// MemoryManager blocks are only 16 byte aligned, over-allocate to align the first column
+		static void* AllocateColumns(size_t capacity, std::tuple<Fields*...>& columns)
+		{
+			void* block = mem::MemoryManager::allocate(BlockSize(capacity) + kColumnAlignment);
+			u8* columnPtr = static_cast<u8*>(block) + (kColumnAlignment - reinterpret_cast<uintptr_t>(block) % kColumnAlignment) % kColumnAlignment;
+
+			ForEachColumn([&]<size_t I>(std::integral_constant<size_t, I>)
+			{
+				std::get<I>(columns) = reinterpret_cast<field_type<I>*>(columnPtr);
+				columnPtr += AlignUp(capacity * sizeof(field_type<I>));
+			});
+			return block;
+		}
+
+		// Moves the current elements into the given columns, then frees the old block and adopts the new one
+		void RelocateInto(void* block, std::tuple<Fields*...> const& columns, size_t capacity)
+		{
+			ForEachColumn([&]<size_t I>(std::integral_constant<size_t, I>)
+			{
+				using field = field_type<I>;
+				field* dst = std::get<I>(columns);
+				field* src = std::get<I>(m_columns);
+				if (m_size)
+				{
+					if constexpr (is_trivially_relocatable_v<field>)
+					{
+						std::memcpy(static_cast<void*>(dst), src, m_size * sizeof(field));
+					}
+					else
+					{
+						std::uninitialized_move_n(src, m_size, dst);
+						std::destroy_n(src, m_size);
+					}
+				}
+			});
+
+			Free();
+			m_block = block;
+			m_columns = columns;
+			m_capacity = capacity;
+		}
+
+		void Reallocate(size_t capacity)
+		{
+			axAssert(capacity >= m_size);
+
+			std::tuple<Fields*...> columns;
+			void* block = AllocateColumns(capacity, columns);
+			RelocateInto(block, columns, capacity);
+		}
+
+		void Free()
+		{
+			if (m_block)
+			{
+				mem::MemoryManager::free(m_block);
+				m_block = nullptr;
+			}
+			m_columns = {};
+			m_capacity = 0;
+		}
+
+	private:
+		void*                  m_block {};
+		std::tuple<Fields*...> m_columns {};
+		size_t                 m_size {};
+		size_t                 m_capacity {};
+	};
+
+}
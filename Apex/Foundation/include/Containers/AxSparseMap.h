@@ -12,14 +12,14 @@ namespace apex {
 	public:
 		using base_type = AxSparseSet<KeyType>;
 
-		using base_type::sparse_array;
-		using base_type::dense_array;
+		using typename base_type::sparse_array;
+		using typename base_type::dense_array;
 		
-		using base_type::key_type;
-		using base_type::key_pointer;
-		using base_type::const_key_pointer;
-		using base_type::key_reference;
-		using base_type::const_key_reference;
+		using typename base_type::key_type;
+		using typename base_type::key_pointer;
+		using typename base_type::const_key_pointer;
+		using typename base_type::key_reference;
+		using typename base_type::const_key_reference;
 
 		using element_type = ValueType;
 		using element_array = AxArray<element_type>;
@@ -39,7 +39,6 @@ namespace apex {
 		: base_type(capacity)
 		, m_elements(capacity)
 		{
-			m_elements.resize(capacity);
 		}
 
 		~AxSparseMap() = default;
@@ -55,11 +54,10 @@ namespace apex {
 		}
 		
 
-		void resize(size_t capacity)
+		void reserve(size_t capacity)
 		{
-			// TODO: Do NOT resize elements array if not required
 			base_type::reserve(capacity);
-			m_elements.resize(base_type::capacity());
+			m_elements.reserve(capacity);
 		}
 
 		void insert(key_type id, ValueType const& elem)
@@ -148,7 +146,7 @@ namespace apex {
 			auto idx = try_getIndex(id);
 			if (idx)
 			{
-				return { idx.value(), m_elements[idx.value()] };
+				return pair_type{ idx.value(), m_elements[idx.value()] };
 			}
 
 			return std::nullopt;
@@ -159,16 +157,20 @@ namespace apex {
 			auto idx = try_getIndex(id);
 			if (idx)
 			{
-				return { idx.value(), m_elements[idx.value()] };
+				return const_pair_type{ idx.value(), m_elements[idx.value()] };
 			}
 
 			return std::nullopt;
 		}
 
-		void clear() { base_type::clear(); }
+		void clear()
+		{
+			base_type::clear();
+			m_elements.clear();
+		}
 
-		auto elements() { return ranges::AxRange<element_array>(m_elements.begin(), m_elements.begin() + count()); }
-		auto elements() const { return ranges::AxRange<const element_array>(m_elements.begin(), m_elements.begin() + count()); }
+		auto elements() { return ranges::AxRange<element_array>(m_elements.begin(), m_elements.end()); }
+		auto elements() const { return ranges::AxRange<const element_array, typename element_array::const_iterator>(m_elements.begin(), m_elements.end()); }
 
 		auto keys() { return base_type::keys(); }
 		auto keys() const { return base_type::keys(); }
@@ -179,25 +181,20 @@ namespace apex {
 	protected:
 		void Insert(key_type id, ValueType const& elem)
 		{
-			base_type::Insert(id);
-			auto index = base_type::GetIndex(id);
-			m_elements[index] = elem;
+			Emplace(id, elem);
 		}
 
 		void Insert(key_type id, ValueType&& elem)
 		{
-			base_type::Insert(id);
-			auto index = base_type::GetIndex(id);
-			m_elements[index] = std::move(elem);
+			Emplace(id, std::move(elem));
 		}
 
+		// Elements are kept parallel to the dense keys, so they only take up space for keys that are present
 		template <typename... Args>
 		ValueType& Emplace(key_type id, Args&&... args)
 		{
 			base_type::Insert(id);
-			auto index = base_type::GetIndex(id);
-			auto pElem = std::construct_at(&m_elements[index], std::forward<Args>(args)...);
-			return *pElem;
+			return m_elements.emplace_back(std::forward<Args>(args)...);
 		}
 
 		void Remove(key_type id)
@@ -207,7 +204,11 @@ namespace apex {
 			base_type::Remove(id);
 			auto lastIndex = count();
 
-			m_elements[index] = m_elements[lastIndex];
+			if (index != lastIndex)
+			{
+				m_elements[index] = std::move(m_elements[lastIndex]);
+			}
+			m_elements.pop_back();
 		}
 
 	private:
@@ -221,9 +222,9 @@ namespace apex {
 	public:
 		using base_type = AxSparseSet<KeyType>;
 
-		using base_type::key_type;
-		using base_type::sparse_array;
-		using base_type::dense_array;
+		using typename base_type::key_type;
+		using typename base_type::sparse_array;
+		using typename base_type::dense_array;
 
 		using element_type = ValueType;
 
@@ -239,9 +240,8 @@ namespace apex {
 		~AxSparseMap() = default;
 
 
-		void resize(size_t capacity)
+		void reserve(size_t capacity)
 		{
-			// TODO: Do NOT resize elements array if not required
 			base_type::reserve(capacity);
 		}
 
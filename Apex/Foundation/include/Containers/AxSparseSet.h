@@ -2,6 +2,7 @@
 #include "AxArray.h"
 #include "AxRange.h"
 #include "Core/Asserts.h"
+#include "Memory/MemoryManager.h"
 
 #include <optional>
 
@@ -10,7 +11,10 @@ namespace apex {
 	/**
 	 * \brief Sparse set implementation.
 	 * Check https://manenko.com/2021/05/23/sparse-sets.html for details on design.
-	 * \tparam KeyType Type of keys that will be stored in the set.
+	 * The sparse array is split into fixed-size pages that are allocated the first time a key in their range is added.
+	 * Pages that were never written point to a shared, read-only null page, so lookups never branch on a missing page.
+	 * Memory scales with the spread of the keys in use rather than with the largest key.
+	 * \tparam KeyType Type of keys that will be stored in the set. Must be an unsigned integer.
 	 */
 	template <typename KeyType>
 	class AxSparseSet
@@ -22,9 +26,14 @@ namespace apex {
 		using key_reference = KeyType&;
 		using const_key_reference = const KeyType&;
 
-		using sparse_array = AxArray<key_type>;
+		using sparse_array = AxArray<key_type*>; // page table
 		using dense_array = AxArray<key_type>;
 
+		static_assert(std::is_unsigned_v<key_type>);
+
+		static constexpr size_t   kPageSize = 4096 / sizeof(key_type); // entries per sparse page, one 4 KiB pool block
+		static constexpr key_type kNullIndex = std::numeric_limits<key_type>::max();
+
 		/**
 		 * \brief Default constructor. Creates empty set with zero capacity.
 		 */
@@ -32,31 +41,47 @@ namespace apex {
 
 		/**
 		 * \brief Creates an empty set with initial capacity.
-		 * \param capacity Initial capacity.
+		 * \param capacity Initial capacity of the dense array. No sparse pages are allocated.
 		 */
 		explicit AxSparseSet(u32 capacity)
-		: m_sparse(capacity)
-		, m_dense(capacity)
+		: m_dense(capacity)
 		{
-			m_sparse.resize(capacity);
 		}
 
 		/**
-		 * \brief Default destructor.
+		 * \brief Frees all sparse pages.
 		 */
-		~AxSparseSet() = default;
+		~AxSparseSet()
+		{
+			FreePages();
+		}
+
+		NON_COPYABLE(AxSparseSet);
+
+		AxSparseSet(AxSparseSet&& other) noexcept
+		: m_sparse(std::move(other.m_sparse))
+		, m_dense(std::move(other.m_dense))
+		{
+		}
+
+		AxSparseSet& operator=(AxSparseSet&& other) noexcept
+		{
+			if (this != &other)
+			{
+				FreePages();
+				m_sparse = std::move(other.m_sparse);
+				m_dense = std::move(other.m_dense);
+			}
+			return *this;
+		}
 
 		/**
-		 * \brief Resizes set to new capacity.
-		 * \param capacity New capacity to resize to.
+		 * \brief Reserves space for capacity keys in the dense array. Sparse pages are still allocated on demand.
+		 * \param capacity New capacity to reserve.
 		 */
 		void reserve(size_t capacity)
 		{
-			// TODO: Do NOT resize dense array if not required
-			m_sparse.reserve(capacity);
 			m_dense.reserve(capacity);
-
-			m_sparse.resize(m_sparse.capacity());
 		}
 
 		/**
@@ -65,7 +90,6 @@ namespace apex {
 		 */
 		void add(key_type key)
 		{
-			axAssert(key < capacity());
 			axAssertFmt(!contains(key), "Cannot add element. ID already exists in the set!");
 
 			Insert(key);
@@ -78,8 +102,6 @@ namespace apex {
 		 */
 		bool try_add(key_type key)
 		{
-			axAssert(key < capacity());
-
 			if (!contains(key))
 			{
 				Insert(key);
@@ -95,7 +117,6 @@ namespace apex {
 		 */
 		void remove(key_type key)
 		{
-			axAssert(key < capacity());
 			axAssertFmt(contains(key), "Cannot delete element. ID does not exist!");
 
 			Remove(key);
@@ -108,8 +129,6 @@ namespace apex {
 		 */
 		bool try_remove(key_type key)
 		{
-			axAssert(key < capacity());
-
 			if (contains(key))
 			{
 				Remove(key);
@@ -126,12 +145,7 @@ namespace apex {
 		 */
 		bool contains(key_type key) const
 		{
-			if (key < capacity())
-			{
-				key_type denseIdx = m_sparse[key];
-				return denseIdx < m_dense.size() && m_dense[denseIdx] == key;
-			}
-			return false;
+			return SparseAt(key) != kNullIndex;
 		}
 
 		/**
@@ -141,10 +155,8 @@ namespace apex {
 		 */
 		key_type getIndex(key_type key) const
 		{
-			axAssert(key < capacity());
-
-			key_type denseIdx = m_sparse[key];
-			axAssert(denseIdx < m_dense.size() && m_dense[denseIdx] == key);
+			key_type denseIdx = SparseAt(key);
+			axAssert(denseIdx != kNullIndex);
 
 			return denseIdx;
 		}
@@ -156,11 +168,9 @@ namespace apex {
 		 */
 		auto try_getIndex(key_type key) const -> std::optional<key_type>
 		{
-			axAssert(key < capacity());
-
-			key_type denseIdx = m_sparse[key];
+			key_type denseIdx = SparseAt(key);
 
-			if (denseIdx < m_dense.size() && m_dense[denseIdx] == key)
+			if (denseIdx != kNullIndex)
 			{
 				return denseIdx;
 			}
@@ -169,10 +179,14 @@ namespace apex {
 		}
 
 		/**
-		 * \brief Clears all values from the set.
+		 * \brief Clears all values from the set. Sparse pages stay allocated for reuse.
 		 */
 		void clear()
 		{
+			for (key_type key : m_dense)
+			{
+				SparseRef(key) = kNullIndex;
+			}
 			m_dense.clear();
 		}
 
@@ -189,7 +203,7 @@ namespace apex {
 		auto keys() const { return ranges::AxRange<const dense_array, typename dense_array::const_iterator>(m_dense.begin(), m_dense.end()); }
 
 		/**
-		 * \brief Returns the currently allocated max capacity of the set.
+		 * \brief Returns the currently allocated capacity of the dense array.
 		 * \return Current capacity.
 		 */
 		size_t capacity() const { return m_dense.capacity(); }
@@ -200,32 +214,101 @@ namespace apex {
 		 */
 		size_t count() const { return m_dense.size(); }
 
+		/**
+		 * \brief Returns the number of sparse pages that have been allocated.
+		 * \return Allocated page count.
+		 */
+		size_t pageCount() const
+		{
+			size_t numPages = 0;
+			for (const key_type* page : m_sparse)
+			{
+				numPages += (page != NullPage());
+			}
+			return numPages;
+		}
+
 	protected:
 		void Insert(key_type key)
 		{
+			axAssertFmt(key != kNullIndex, "Key is reserved as the null index!");
 			m_dense.append(key);
-			m_sparse[key] = m_dense.size() - 1;
+			SparseRef(key) = static_cast<key_type>(m_dense.size() - 1);
 		}
 
 		void Remove(key_type key)
 		{
 			auto newCount = m_dense.size() - 1;
 
-			key_type denseIdx = m_sparse[key];
+			key_type& denseIdx = SparseRef(key);
 			key_type lastId = m_dense[newCount];
 			m_dense[denseIdx] = lastId;
-			m_sparse[lastId] = denseIdx;
+			SparseRef(lastId) = denseIdx;
+			denseIdx = kNullIndex;
 
 			m_dense.pop_back();
 		}
 
 		key_type GetIndex(key_type key) // unsafe operation. Only for internal use
 		{
-			key_type denseIdx = m_sparse[key];
-			return denseIdx;
+			return SparseAt(key);
 		}
 
 	private:
+		struct NullPageStorage
+		{
+			constexpr NullPageStorage()
+			{
+				for (key_type& index : indices)
+					index = kNullIndex;
+			}
+
+			key_type indices[kPageSize];
+		};
+
+		static key_type* NullPage()
+		{
+			// Only ever read through. SparseRef replaces it with a real page before writing.
+			return const_cast<key_type*>(s_nullPage.indices);
+		}
+
+		key_type SparseAt(key_type key) const
+		{
+			const size_t pageIdx = key / kPageSize;
+			return pageIdx < m_sparse.size() ? m_sparse[pageIdx][key % kPageSize] : kNullIndex;
+		}
+
+		key_type& SparseRef(key_type key)
+		{
+			const size_t pageIdx = key / kPageSize;
+			if (pageIdx >= m_sparse.size())
+			{
+				if (pageIdx >= m_sparse.capacity())
+					m_sparse.reserve(std::max(pageIdx + 1, m_sparse.capacity() * 2));
+				m_sparse.resize(pageIdx + 1, NullPage());
+			}
+
+			key_type*& page = m_sparse[pageIdx];
+			if (page == NullPage())
+			{
+				page = static_cast<key_type*>(mem::MemoryManager::allocate(kPageSize * sizeof(key_type)));
+				std::fill_n(page, kPageSize, kNullIndex);
+			}
+			return page[key % kPageSize];
+		}
+
+		void FreePages()
+		{
+			for (key_type* page : m_sparse)
+			{
+				if (page != NullPage())
+					mem::MemoryManager::free(page);
+			}
+			m_sparse.reset();
+		}
+
+		static constexpr NullPageStorage s_nullPage {};
+
 		sparse_array m_sparse{};
 		dense_array m_dense{};
 	};
@@ -1 +1,152 @@
-﻿#pragma once
+#pragma once
+#include <algorithm>
+
+#include "Containers/AxArray.h"
+#include "Core/Asserts.h"
+#include "Core/Types.h"
+
+namespace apex {
+
+	/**
+	 * \brief Fixed capacity array with inline storage and size tracking.
+	 * \details Never allocates. The struct is an aggregate with a standard layout, so it can be used in
+	 * constexpr contexts and mirrored into shared or GPU-visible memory.
+	 * All Capacity elements are always constructed; only the first size() of them are part of the array.
+	 * An array is full when default or aggregate initialized, matching a plain C array.
+	 * Call clear() first to use it as a bounded stack.
+	 * \tparam T type of elements stored in the array. Must be default constructible
+	 * \tparam Capacity maximum number of elements in the array
+	 */
+	template <typename T, size_t Capacity>
+	struct AxStaticArray
+	{
+		static_assert(Capacity > 0);
+		static_assert(std::is_default_constructible_v<T>);
+
+		using value_type = T;
+		using pointer = value_type*;
+		using const_pointer = const value_type*;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using iterator = pointer;
+		using const_iterator = const_pointer;
+
+		T m_data[Capacity] {};
+		u32 m_size = static_cast<u32>(Capacity);
+
+		template <typename... Args>
+		constexpr reference emplace_back(Args&&... args)
+		{
+			axAssertFmt(m_size < Capacity, "Static array size exceeds capacity!");
+			m_data[m_size] = T(std::forward<Args>(args)...);
+			return m_data[m_size++];
+		}
+
+		template <typename... Args>
+		constexpr reference emplace(size_t index, Args&&... args)
+		{
+			axAssertFmt(index <= m_size, "Array insertion index in out of range!");
+			axAssertFmt(m_size < Capacity, "Static array size exceeds capacity!");
+			// args may alias an element of this array, so the new element is built before anything is moved
+			T elem(std::forward<Args>(args)...);
+			std::move_backward(m_data + index, m_data + m_size, m_data + m_size + 1);
+			m_data[index] = std::move(elem);
+			m_size++;
+			return m_data[index];
+		}
+
+		constexpr void append(const value_type& obj) { emplace_back(obj); }
+		constexpr void append(value_type&& obj) { emplace_back(std::move(obj)); }
+
+		constexpr void insert(size_t index, const value_type& obj) { emplace(index, obj); }
+		constexpr void insert(size_t index, value_type&& obj) { emplace(index, std::move(obj)); }
+
+		constexpr void pop_back()
+		{
+			axAssertFmt(m_size > 0, "Cannot pop from empty array!");
+			m_data[--m_size] = T{};
+		}
+
+		constexpr void remove(size_t index)
+		{
+			axAssert(index < m_size);
+			std::move(m_data + index + 1, m_data + m_size, m_data + index);
+			pop_back();
+		}
+
+		template <typename... Args>
+		constexpr void resize(size_t new_size, Args&&... args)
+		{
+			axAssertFmt(new_size <= Capacity, "Static array size exceeds capacity!");
+			for (size_t i = m_size; i < new_size; i++)
+			{
+				m_data[i] = T(std::forward<Args>(args)...);
+			}
+			for (size_t i = new_size; i < m_size; i++)
+			{
+				m_data[i] = T{};
+			}
+			m_size = static_cast<u32>(new_size);
+		}
+
+		constexpr void clear()
+		{
+			resize(0);
+		}
+
+		constexpr void fill(const value_type& value)
+		{
+			std::fill(m_data, m_data + m_size, value);
+		}
+
+		[[nodiscard]] constexpr auto data() -> pointer             { return m_data; }
+		[[nodiscard]] constexpr auto data() const -> const_pointer { return m_data; }
+
+		[[nodiscard]] constexpr auto back() -> reference             { axAssert(m_size > 0); return m_data[m_size - 1]; }
+		[[nodiscard]] constexpr auto back() const -> const_reference { axAssert(m_size > 0); return m_data[m_size - 1]; }
+
+		[[nodiscard]] constexpr auto front() -> reference             { axAssert(m_size > 0); return m_data[0]; }
+		[[nodiscard]] constexpr auto front() const -> const_reference { axAssert(m_size > 0); return m_data[0]; }
+
+		[[nodiscard]] constexpr auto at(size_t index) -> reference             { return operator[](index); }
+		[[nodiscard]] constexpr auto at(size_t index) const -> const_reference { return operator[](index); }
+
+		[[nodiscard]] constexpr auto operator[](size_t index) -> reference             { axAssert(index < m_size); return m_data[index]; }
+		[[nodiscard]] constexpr auto operator[](size_t index) const -> const_reference { axAssert(index < m_size); return m_data[index]; }
+
+		[[nodiscard]] constexpr size_t size() const { return m_size; }
+		[[nodiscard]] static constexpr size_t capacity() { return Capacity; }
+		[[nodiscard]] constexpr bool empty() const { return m_size == 0; }
+		[[nodiscard]] constexpr bool full() const { return m_size == Capacity; }
+
+		[[nodiscard]] constexpr iterator begin()              { return m_data; }
+		[[nodiscard]] constexpr iterator end()                { return m_data + m_size; }
+		[[nodiscard]] constexpr const_iterator begin() const  { return m_data; }
+		[[nodiscard]] constexpr const_iterator end() const    { return m_data + m_size; }
+		[[nodiscard]] constexpr const_iterator cbegin() const { return m_data; }
+		[[nodiscard]] constexpr const_iterator cend() const   { return m_data + m_size; }
+
+		[[nodiscard]] constexpr auto getRef() -> AxArrayRef<T>
+		{
+			return { m_data, m_size };
+		}
+
+		[[nodiscard]] constexpr auto getRef() const -> AxArrayRef<const T>
+		{
+			return { m_data, m_size };
+		}
+	};
+
+	template <typename T, size_t Capacity>
+	auto make_array_ref(AxStaticArray<T, Capacity>& arr) -> AxArrayRef<T>
+	{
+		return arr.getRef();
+	}
+
+	template <typename T, size_t Capacity>
+	auto make_array_ref(AxStaticArray<T, Capacity> const& arr) -> AxArrayRef<const T>
+	{
+		return arr.getRef();
+	}
+
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include "Core/Platform.h"
+#include "Core/Types.h"
+
+// Enables an instruction set for a single function, so kernels picked with CpuInfo::GetSimdLevel() can be built without
+// raising the baseline of the whole target. MSVC accepts any intrinsic in any function
+#if defined(APEX_ARCH_X86) && (!defined(_MSC_VER) || defined(__clang__))
+#	define APEX_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#	define APEX_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx512vl,avx2,fma")))
+#else
+#	define APEX_TARGET_AVX2
+#	define APEX_TARGET_AVX512
+#endif
+
+namespace apex {
+
+	enum class CpuFeature : u32
+	{
+		eNone     = 0,
+		eSSE2     = 1 << 0,
+		eSSE3     = 1 << 1,
+		eSSSE3    = 1 << 2,
+		eSSE41    = 1 << 3,
+		eSSE42    = 1 << 4,
+		ePOPCNT   = 1 << 5,
+		eAVX      = 1 << 6,
+		eFMA      = 1 << 7,
+		eAVX2     = 1 << 8,
+		eBMI2     = 1 << 9,
+		eAVX512F  = 1 << 10,
+		eAVX512BW = 1 << 11,
+		eAVX512VL = 1 << 12,
+		eNEON     = 1 << 13,
+	};
+
+	using CpuFeatureFlags = Flags<CpuFeature>;
+	DEFINE_BITWISE_OPERATORS(CpuFeature, CpuFeatureFlags)
+
+	/**
+	 * \brief Widest SIMD instruction set usable at runtime. Kernels with multiple implementations
+	 * should switch on this once at init time rather than testing individual feature bits.
+	 */
+	enum class SimdLevel : u8
+	{
+		eScalar,
+		eSSE42,  // SSE4.2 + POPCNT
+		eAVX2,   // AVX2 + FMA
+		eAVX512, // AVX-512 F/BW/VL
+		eNEON,
+	};
+
+	struct CpuCacheInfo
+	{
+		u32 lineSize;
+		u32 l1DataSize;  // per physical core
+		u32 l2Size;      // per physical core
+		u32 l3Size;      // per L3 domain
+	};
+
+	struct LogicalCore
+	{
+		u16 osIndex;      // index used by the OS for affinity masks
+		u16 physicalCore; // dense index of the physical core
+		u16 package;
+		u16 l3Group;      // dense index of the L3 cache domain (CCX on AMD)
+		u16 numaNode;
+		u8  smtIndex;     // 0 for the first hardware thread of a physical core
+	};
+
+	struct CpuTopology
+	{
+		static constexpr u32 kMaxLogicalCores = 256;
+
+		u32 numLogicalCores;
+		u32 numPhysicalCores;
+		u32 numPackages;
+		u32 numL3Groups;
+		u32 numNumaNodes;
+
+		CpuCacheInfo caches;
+		LogicalCore  cores[kMaxLogicalCores];
+	};
+
+	/**
+	 * \brief Thread to logical core assignment produced by CpuInfo::PlanThreadPlacement.
+	 * Dedicated threads (render, IO) get a physical core to themselves, their SMT siblings are left idle.
+	 */
+	struct ThreadPlacement
+	{
+		static constexpr u32 kMaxDedicatedThreads = 8;
+
+		u32 numDedicated;
+		u32 numWorkers;
+		u16 dedicatedCores[kMaxDedicatedThreads];
+		u16 workerCores[CpuTopology::kMaxLogicalCores];
+	};
+
+	class CpuInfo
+	{
+	public:
+		/**
+		 * \brief Queries the OS and CPUID. Called lazily by the getters, but can be called
+		 * up front from engine start-up to keep the cost out of the first frame.
+		 */
+		static void Init();
+
+		[[nodiscard]] static CpuTopology const& GetTopology();
+		[[nodiscard]] static CpuFeatureFlags GetFeatures();
+		[[nodiscard]] static SimdLevel GetSimdLevel();
+		[[nodiscard]] static bool HasFeature(CpuFeature feature);
+
+		/**
+		 * \brief Assigns logical cores to threads.
+		 * Dedicated threads are placed first, each on its own physical core. Workers then take
+		 * one hardware thread per remaining physical core, grouped by L3 domain, before any
+		 * SMT siblings of other workers are used.
+		 * \param num_dedicated Number of threads that must not share a physical core (render, IO).
+		 * \param max_workers Upper bound on worker threads. Pass 0 to use every remaining logical core.
+		 * \param use_smt Whether workers may run on SMT siblings of other workers.
+		 */
+		[[nodiscard]] static ThreadPlacement PlanThreadPlacement(u32 num_dedicated, u32 max_workers = 0, bool use_smt = true);
+
+		/**
+		 * \brief Pins the calling thread to a single logical core.
+		 * \param os_index LogicalCore::osIndex of the target core.
+		 * \return true on success; false if the platform does not support thread affinity.
+		 */
+		static bool SetCurrentThreadAffinity(u32 os_index);
+	};
+
+}
@@ -38,6 +38,13 @@ namespace apex {
 		size_t Read(void* buffer, size_t buffer_size) const;
 		size_t Write(const void* buffer, size_t buffer_size);
 
+		// Positional I/O, does not use or move the file pointer
+		size_t ReadAt(u64 offset, void* buffer, size_t buffer_size) const;
+		size_t WriteAt(u64 offset, const void* buffer, size_t buffer_size);
+
+		bool IsValid() const { return m_handle != nullptr; }
+		u32 GetFlags() const { return m_flags; }
+
 	private:
 		FileHandle		m_handle = nullptr;
 		FileHandle		m_mappedHandle = nullptr;
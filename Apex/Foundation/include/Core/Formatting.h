@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <algorithm>
 #include <string_view>
 #include <fmt/core.h>
 
@@ -17,8 +18,9 @@ namespace apex {
 	{
 		auto [buffer, size] = get_buffer();
 		auto res = fmt::format_to_n(buffer, size-1, fmt, std::forward<Args>(args)...);
-		buffer[res.size] = '\0'; // null-terminate the string
-		return { buffer, res.size };
+		const size_t length = std::min(res.size, size - 1); // res.size is the untruncated length
+		buffer[length] = '\0'; // null-terminate the string
+		return { buffer, length };
 	}
 
 }
@@ -88,29 +88,6 @@ namespace logging {
 		Lock_t m_lock;
 	};
 
-
-	struct IRingBufferSink : public ISink
-	{
-		void log(const LogMsg& log_msg) override;
-	};
-	using RingBufferSink_st = IRingBufferSink;
-
-	template <typename Lock_t>
-	struct RingBufferSink final : public IRingBufferSink
-	{
-		void log(const LogMsg& log_msg) override
-		{
-			concurrency::LockGuard lock{ m_lock };
-			IRingBufferSink::log(log_msg);
-		}
-
-		char *m_pBuffer;
-		size_t m_capacity;
-
-	private:
-		Lock_t m_lock;
-	};
-
 	bool DisplayErrorMessageBox(const LogMsg& log_msg);
 
 	inline bool LogVerifyFailedError(const char *file, const char *funcsig, apex::u32 lineno, const char *msg)
@@ -1,6 +1,20 @@
 ﻿#pragma once
 
-#define _THREAD_PAUSE() _mm_pause()
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#	define APEX_ARCH_X86 1
+#	include <immintrin.h>
+#	define _THREAD_PAUSE() _mm_pause()
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#	define APEX_ARCH_ARM64 1
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#		define _THREAD_PAUSE() __yield()
+#	else
+#		define _THREAD_PAUSE() __asm__ __volatile__("yield")
+#	endif
+#else
+#	define _THREAD_PAUSE() ((void)0)
+#endif
 
 #if defined(_MSC_VER)
 #	define DEBUG_BREAK() (__debugbreak(), false)
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Containers/AxRingBuffer.h"
+#include "Core/Logging.h"
+
+namespace apex {
+namespace logging {
+
+	/**
+	 * \brief Keeps the most recent formatted log messages in a fixed size character ring.
+	 * \details Only whole messages are kept: when the ring is full the oldest messages are dropped until the new one fits.
+	 * A message longer than the ring keeps only its tail.
+	 */
+	struct IRingBufferSink : public ISink
+	{
+		explicit IRingBufferSink(size_t capacity) : m_buffer(capacity, RingBufferMode::eOverwrite) {}
+
+		void log(const LogMsg& log_msg) override;
+
+		/**
+		 * \brief The buffered text, oldest first, as at most two contiguous runs
+		 */
+		[[nodiscard]] auto contents() const { return m_buffer.spans(); }
+
+		void clear() { m_buffer.clear(); }
+
+	protected:
+		AxRingBuffer<char> m_buffer;
+	};
+	using RingBufferSink_st = IRingBufferSink;
+
+	template <typename Lock_t>
+	struct RingBufferSink final : public IRingBufferSink
+	{
+		using IRingBufferSink::IRingBufferSink;
+
+		void log(const LogMsg& log_msg) override
+		{
+			concurrency::LockGuard lock{ m_lock };
+			IRingBufferSink::log(log_msg);
+		}
+
+	private:
+		Lock_t m_lock;
+	};
+
+}
+}
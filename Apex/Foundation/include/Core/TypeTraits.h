@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include <type_traits>
 
 namespace apex {
 
@@ -84,6 +85,20 @@ namespace apex {
 	template <typename TypeList>
 	using non_empty_type_list_t = typename non_empty_type_list<TypeList>::type;
 
+	// is_trivially_relocatable
+	/**
+	 * \brief A type is trivially relocatable if moving it to a new address and ending the lifetime of the
+	 * source is equivalent to a memcpy of its bytes. This holds for most types that own memory through a
+	 * pointer (strings, arrays, unique pointers) as long as they do not store pointers into themselves.
+	 * Containers use it to relocate elements with memcpy/memmove instead of move-construct + destroy.
+	 * Trivially copyable types are relocatable by default, other types opt in by specializing this struct.
+	 */
+	template <typename T>
+	struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+	template <typename T>
+	inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
 	// Compile-time assertions
 	template <size_t a, size_t b>
 	struct TAssertEquality
@@ -0,0 +1,46 @@
+#pragma once
+#include "Containers/AxArray.h"
+#include "Core/Types.h"
+#include "Math/Math.h"
+#include "Math/Matrix4x4.h"
+
+namespace apex {
+namespace math {
+
+	/**
+	 * \brief Batched versions of the Matrix4x4 products, for skinning, culling, debug drawing and similar loops over
+	 * large arrays.
+	 * \details The kernel is picked once at runtime from CpuInfo::GetSimdLevel(): AVX-512 kernels work on 4-16
+	 * elements per iteration, AVX2 kernels on 2-8, NEON kernels on 4. Other targets use the Matrix4x4 operators.
+	 * Results match the single element operators up to floating point rounding (the kernels use FMA).
+	 * Outputs must be at least as large as the inputs and may alias them exactly, but must not partially overlap.
+	 */
+
+	// out[i] = (m * Vector4(in[i], 1)).xyz, no perspective divide
+	void transformPoints(Matrix4x4 const& m, AxArrayRef<const Vector3> in, AxArrayRef<Vector3> out);
+
+	// Same as above, for points stored as separate x, y and z columns (e.g. the columns of an AxSoA)
+	void transformPoints(Matrix4x4 const& m, const f32* in_x, const f32* in_y, const f32* in_z, f32* out_x, f32* out_y, f32* out_z, size_t count);
+
+	// out[i] = (m * Vector4(in[i], 0)).xyz
+	void transformDirections(Matrix4x4 const& m, AxArrayRef<const Vector3> in, AxArrayRef<Vector3> out);
+
+	// out[i] = m * in[i]
+	void transformVectors(Matrix4x4 const& m, AxArrayRef<const Vector4> in, AxArrayRef<Vector4> out);
+
+	// out[i] = lhs * rhs[i]
+	void multiplyMatrices(Matrix4x4 const& lhs, AxArrayRef<const Matrix4x4> rhs, AxArrayRef<Matrix4x4> out);
+
+	// out[i] = lhs[i] * rhs[i]
+	void multiplyMatrices(AxArrayRef<const Matrix4x4> lhs, AxArrayRef<const Matrix4x4> rhs, AxArrayRef<Matrix4x4> out);
+
+	constexpr u32 kRootParent = Constants::u32_MAX;
+
+	/**
+	 * \brief Resolves a transform hierarchy: world[i] = world[parents[i]] * local[i], or local[i] for roots.
+	 * \param parents index of each node's parent, or kRootParent. Parents must come before their children
+	 */
+	void computeWorldFromLocal(AxArrayRef<const Matrix4x4> local, AxArrayRef<const u32> parents, AxArrayRef<Matrix4x4> world);
+
+}
+}
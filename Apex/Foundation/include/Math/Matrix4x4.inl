@@ -3,6 +3,7 @@
 
 #include "Matrix4x4.h"
 
+#include "Simd.h"
 #include "Vector3.inl"
 #include "Vector4.inl"
 
@@ -18,11 +19,16 @@ namespace math {
 
 	inline Matrix4x4 Matrix4x4::transpose() const
 	{
+		const simd::float4 t0 = simd::shuffle2<0, 1, 0, 1>(detail::load(m_columns[0]), detail::load(m_columns[1]));
+		const simd::float4 t1 = simd::shuffle2<2, 3, 2, 3>(detail::load(m_columns[0]), detail::load(m_columns[1]));
+		const simd::float4 t2 = simd::shuffle2<0, 1, 0, 1>(detail::load(m_columns[2]), detail::load(m_columns[3]));
+		const simd::float4 t3 = simd::shuffle2<2, 3, 2, 3>(detail::load(m_columns[2]), detail::load(m_columns[3]));
+
 		return {
-			m_columns[0].x, m_columns[1].x, m_columns[2].x, m_columns[3].x,
-			m_columns[0].y, m_columns[1].y, m_columns[2].y, m_columns[3].y,
-			m_columns[0].z, m_columns[1].z, m_columns[2].z, m_columns[3].z,
-			m_columns[0].w, m_columns[1].w, m_columns[2].w, m_columns[3].w
+			detail::store(simd::shuffle2<0, 2, 0, 2>(t0, t2)),
+			detail::store(simd::shuffle2<1, 3, 1, 3>(t0, t2)),
+			detail::store(simd::shuffle2<0, 2, 0, 2>(t1, t3)),
+			detail::store(simd::shuffle2<1, 3, 1, 3>(t1, t3))
 		};
 	}
 
@@ -49,81 +55,144 @@ namespace math {
 
 	inline Matrix4x4 operator*(Matrix4x4 const& m, f32 t)
 	{
+		const simd::float4 st = simd::splat(t);
 		return {
-			m[0] * t,
-			m[1] * t,
-			m[2] * t,
-			m[3] * t
+			detail::store(simd::mul(detail::load(m.m_columns[0]), st)),
+			detail::store(simd::mul(detail::load(m.m_columns[1]), st)),
+			detail::store(simd::mul(detail::load(m.m_columns[2]), st)),
+			detail::store(simd::mul(detail::load(m.m_columns[3]), st))
 		};
 	}
 
-	inline Vector4 operator*(Matrix4x4 const &m, Vector4 const &v)
+namespace detail {
+
+	// m * v, with the columns of m already loaded
+	inline simd::float4 transform(const simd::float4 (&columns)[4], simd::float4 v)
 	{
-		auto& c0 = m.m_columns[0];
-		auto& c1 = m.m_columns[1];
-		auto& c2 = m.m_columns[2];
-		auto& c3 = m.m_columns[3];
+		simd::float4 res = simd::mul(columns[0], simd::lane<0>(v));
+		res = simd::madd(columns[1], simd::lane<1>(v), res);
+		res = simd::madd(columns[2], simd::lane<2>(v), res);
+		return simd::madd(columns[3], simd::lane<3>(v), res);
+	}
 
-		return {
-			(c0.x * v.x) + (c1.x * v.y) + (c2.x * v.z) + (c3.x * v.w),
-			(c0.y * v.x) + (c1.y * v.y) + (c2.y * v.z) + (c3.y * v.w),
-			(c0.z * v.x) + (c1.z * v.y) + (c2.z * v.z) + (c3.z * v.w),
-			(c0.w * v.x) + (c1.w * v.y) + (c2.w * v.z) + (c3.w * v.w)
+}
+
+	inline Vector4 operator*(Matrix4x4 const &m, Vector4 const &v)
+	{
+		const simd::float4 columns[4] = {
+			detail::load(m.m_columns[0]), detail::load(m.m_columns[1]), detail::load(m.m_columns[2]), detail::load(m.m_columns[3])
 		};
+		return detail::store(detail::transform(columns, detail::load(v)));
 	}
 
 	inline Matrix4x4 operator*(Matrix4x4 const& m1, Matrix4x4 const& m2)
 	{
-		Vector4 X = m1 * m2[0];
-		Vector4 Y = m1 * m2[1];
-		Vector4 Z = m1 * m2[2];
-		Vector4 W = m1 * m2[3];
+		Matrix4x4 res;
 
-		return Matrix4x4{ X, Y, Z, W };
+	#if defined(APEX_MATH_SIMD_AVX2) && defined(APEX_MATH_SIMD_FMA)
+		// Two result columns per iteration: each 256-bit register holds a column of m1 twice, and is scaled by the
+		// matching elements of two columns of m2
+		const __m256 c0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m1.m_columns[0].m_values));
+		const __m256 c1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m1.m_columns[1].m_values));
+		const __m256 c2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m1.m_columns[2].m_values));
+		const __m256 c3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(m1.m_columns[3].m_values));
+
+		for (size_t i = 0; i < 4; i += 2)
+		{
+			const __m256 b = _mm256_loadu_ps(m2.m_columns[i].m_values);
+			__m256 col = _mm256_mul_ps(c0, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0)));
+			col = _mm256_fmadd_ps(c1, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)), col);
+			col = _mm256_fmadd_ps(c2, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2)), col);
+			col = _mm256_fmadd_ps(c3, _mm256_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3)), col);
+			_mm256_storeu_ps(res.m_columns[i].m_values, col);
+		}
+	#else
+		const simd::float4 columns[4] = {
+			detail::load(m1.m_columns[0]), detail::load(m1.m_columns[1]), detail::load(m1.m_columns[2]), detail::load(m1.m_columns[3])
+		};
+		for (size_t i = 0; i < 4; i++)
+		{
+			simd::store(res.m_columns[i].m_values, detail::transform(columns, detail::load(m2.m_columns[i])));
+		}
+	#endif
+
+		return res;
 	}
 
+namespace detail {
+
+	// Products of 2x2 matrices packed as (m00, m01, m10, m11), used by inverse. A# is the adjugate of A
+
+	// A * B
+	inline simd::float4 mat2Mul(simd::float4 a, simd::float4 b)
+	{
+		return simd::madd(a, simd::shuffle<0, 3, 0, 3>(b), simd::mul(simd::shuffle<1, 0, 3, 2>(a), simd::shuffle<2, 1, 2, 1>(b)));
+	}
+
+	// A# * B
+	inline simd::float4 mat2AdjMul(simd::float4 a, simd::float4 b)
+	{
+		return simd::sub(simd::mul(simd::shuffle<3, 3, 0, 0>(a), b), simd::mul(simd::shuffle<1, 1, 2, 2>(a), simd::shuffle<2, 3, 0, 1>(b)));
+	}
+
+	// A * B#
+	inline simd::float4 mat2MulAdj(simd::float4 a, simd::float4 b)
+	{
+		return simd::sub(simd::mul(a, simd::shuffle<3, 0, 3, 0>(b)), simd::mul(simd::shuffle<1, 0, 3, 2>(a), simd::shuffle<2, 1, 2, 1>(b)));
+	}
+
+}
+
 	inline Matrix4x4 inverse(Matrix4x4 const& m)
 	{
-		float c00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
-		float c02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
-		float c03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
-		float c04 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
-		float c06 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
-		float c07 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
-		float c08 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
-		float c10 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
-        float c11 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
-		float c12 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
-		float c14 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
-		float c15 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
-		float c16 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
-		float c18 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
-		float c19 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
-		float c20 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
-		float c22 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
-		float c23 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
-		Vector4 fac0 { c00, c00, c02, c03 };
-		Vector4 fac1 { c04, c04, c06, c07 };
-		Vector4 fac2 { c08, c08, c10, c11 };
-		Vector4 fac3 { c12, c12, c14, c15 };
-		Vector4 fac4 { c16, c16, c18, c19 };
-		Vector4 fac5 { c20, c20, c22, c23 };
-		Vector4 vec0 { m[1][0], m[0][0], m[0][0], m[0][0] };
-		Vector4 vec1 { m[1][1], m[0][1], m[0][1], m[0][1] };
-		Vector4 vec2 { m[1][2], m[0][2], m[0][2], m[0][2] };
-        Vector4 vec3 { m[1][3], m[0][3], m[0][3], m[0][3] };
-		Vector4 inv0 { vec1 * fac0 - vec2 * fac1 + vec3 * fac2 };
-		Vector4 inv1 { vec0 * fac0 - vec2 * fac3 + vec3 * fac4 };
-		Vector4 inv2 { vec0 * fac1 - vec1 * fac3 + vec3 * fac5 };
-		Vector4 inv3 { vec0 * fac2 - vec1 * fac4 + vec2 * fac5 };
-		Vector4 signA { +1, -1, +1, -1 };
-		Vector4 signB { -1, +1, -1, +1 };
-		Matrix4x4 inverse { inv0 * signA, inv1 * signB, inv2 * signA, inv3 * signB };
-		Vector4 row0 { inverse[0][0], inverse[1][0], inverse[2][0], inverse[3][0] };
-		Vector4 dot0 { m[0] * row0 };
-		f32 dot1 = (dot0.x + dot0.y) + (dot0.z + dot0.w);
-		f32 one_over_determinant = 1.0f / dot1;
-		return inverse * one_over_determinant;
+		// Block-wise inversion with 2x2 sub-matrices M = | A B |
+		//                                              | C D |
+		// The formulas are written for rows. Applied to the columns they invert the transpose, and since
+		// inverse(transpose(M)) = transpose(inverse(M)) the result comes out column-major as well
+		const simd::float4 c0 = detail::load(m.m_columns[0]);
+		const simd::float4 c1 = detail::load(m.m_columns[1]);
+		const simd::float4 c2 = detail::load(m.m_columns[2]);
+		const simd::float4 c3 = detail::load(m.m_columns[3]);
+
+		const simd::float4 A = simd::shuffle2<0, 1, 0, 1>(c0, c1);
+		const simd::float4 B = simd::shuffle2<2, 3, 2, 3>(c0, c1);
+		const simd::float4 C = simd::shuffle2<0, 1, 0, 1>(c2, c3);
+		const simd::float4 D = simd::shuffle2<2, 3, 2, 3>(c2, c3);
+
+		// (|A|, |B|, |C|, |D|)
+		const simd::float4 detSub = simd::sub(
+			simd::mul(simd::shuffle2<0, 2, 0, 2>(c0, c2), simd::shuffle2<1, 3, 1, 3>(c1, c3)),
+			simd::mul(simd::shuffle2<1, 3, 1, 3>(c0, c2), simd::shuffle2<0, 2, 0, 2>(c1, c3)));
+		const simd::float4 detA = simd::lane<0>(detSub);
+		const simd::float4 detB = simd::lane<1>(detSub);
+		const simd::float4 detC = simd::lane<2>(detSub);
+		const simd::float4 detD = simd::lane<3>(detSub);
+
+		const simd::float4 adjD_C = detail::mat2AdjMul(D, C);
+		const simd::float4 adjA_B = detail::mat2AdjMul(A, B);
+
+		const simd::float4 X = simd::sub(simd::mul(detD, A), detail::mat2Mul(B, adjD_C));
+		const simd::float4 W = simd::sub(simd::mul(detA, D), detail::mat2Mul(C, adjA_B));
+		const simd::float4 Y = simd::sub(simd::mul(detB, C), detail::mat2MulAdj(D, adjA_B));
+		const simd::float4 Z = simd::sub(simd::mul(detC, B), detail::mat2MulAdj(A, adjD_C));
+
+		// |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+		const f32 trace = simd::dot(adjA_B, simd::shuffle<0, 2, 1, 3>(adjD_C));
+		const f32 det = simd::first(simd::madd(detA, detD, simd::mul(detB, detC))) - trace;
+
+		// The sign pattern applies the remaining adjugate of each block
+		const simd::float4 scale = simd::div(simd::set(1.f, -1.f, -1.f, 1.f), simd::splat(det));
+		const simd::float4 sX = simd::mul(X, scale);
+		const simd::float4 sY = simd::mul(Y, scale);
+		const simd::float4 sZ = simd::mul(Z, scale);
+		const simd::float4 sW = simd::mul(W, scale);
+
+		return {
+			detail::store(simd::shuffle2<3, 1, 3, 1>(sX, sY)),
+			detail::store(simd::shuffle2<2, 0, 2, 0>(sX, sY)),
+			detail::store(simd::shuffle2<3, 1, 3, 1>(sZ, sW)),
+			detail::store(simd::shuffle2<2, 0, 2, 0>(sZ, sW))
+		};
 	}
 
 	inline Matrix4x4 rotateX(Matrix4x4 const& m, f32 angle)
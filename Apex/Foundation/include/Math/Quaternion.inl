@@ -2,12 +2,45 @@
 
 #include "Quaternion.h"
 
+#include "Simd.h"
 #include "Vector3.inl"
 #include "Matrix4x4.inl"
 
 namespace apex {
 namespace math {
 
+namespace detail {
+
+	inline simd::float4 load(Quat const& q)
+	{
+		return simd::set(q.w, q.x, q.y, q.z);
+	}
+
+	inline Quat storeQuat(simd::float4 v)
+	{
+		f32 values[4];
+		simd::store(values, v);
+		return { values[0], values[1], values[2], values[3] };
+	}
+
+	/**
+	 * \brief Hamilton product a * b of quaternions held in (w, x, y, z) lane order:
+	 *   a.w * ( b.w,  b.x,  b.y,  b.z)
+	 * + a.x * (-b.x,  b.w, -b.z,  b.y)
+	 * + a.y * (-b.y,  b.z,  b.w, -b.x)
+	 * + a.z * (-b.z, -b.y,  b.x,  b.w)
+	 */
+	inline simd::float4 quatMul(simd::float4 a, simd::float4 b)
+	{
+		simd::float4 res = simd::mul(simd::lane<0>(a), b);
+		res = simd::madd(simd::lane<1>(a), simd::mul(simd::shuffle<1, 0, 3, 2>(b), simd::set(-1.f, 1.f, -1.f, 1.f)), res);
+		res = simd::madd(simd::lane<2>(a), simd::mul(simd::shuffle<2, 3, 0, 1>(b), simd::set(-1.f, 1.f, 1.f, -1.f)), res);
+		res = simd::madd(simd::lane<3>(a), simd::mul(simd::shuffle<3, 2, 1, 0>(b), simd::set(-1.f, -1.f, 1.f, 1.f)), res);
+		return res;
+	}
+
+}
+
 	inline Quat Quat::fromAxisAngle(Vector3 const& axis, f32 angle)
 	{
 		Vector3 scaledAxis = std::sin(angle / 2) * axis.normalize();
@@ -86,7 +119,7 @@ namespace math {
 
 	inline auto Quat::dot(Quat const& a, Quat const& b) -> f32
 	{
-		return a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+		return simd::dot(detail::load(a), detail::load(b));
 	}
 
 	inline auto Quat::normalized() const -> Quat
@@ -124,15 +157,7 @@ namespace math {
 
 	inline Quat& Quat::operator*=(Quat const& v)
 	{
-		f32 w1 = w * v.w - x * v.x - y * v.y - z * v.z;
-		f32 x1 = w * v.x + x * v.w + y * v.z - z * v.y;
-		f32 y1 = w * v.y - x * v.z + y * v.w + z * v.x;
-		f32 z1 = w * v.z + x * v.y - y * v.x + z * v.w;
-		w = w1;
-		x = x1;
-		y = y1;
-		z = z1;
-		return *this;
+		return *this = detail::storeQuat(detail::quatMul(detail::load(*this), detail::load(v)));
 	}
 
 	inline Quat& Quat::operator*=(f32 t)
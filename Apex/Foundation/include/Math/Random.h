@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "Containers/AxArray.h"
 #include "Core/Types.h"
 // #include "Vector3.h"
 #include "Vector-Fwd.h"
@@ -7,6 +8,11 @@
 namespace apex {
 namespace math {
 
+	/**
+	 * \brief Convenience functions drawing from the calling thread's RandomStream::threadLocal().
+	 * \details init() picks a new seed from the OS for the calling thread and every thread that draws for the first time
+	 * afterwards. Threads that already drew keep their streams.
+	 */
 	struct Random
 	{
 		static void init();
@@ -26,6 +32,10 @@ namespace math {
 		static Vector4 randomVector4(f32 min, f32 max);
 	};
 
+	/**
+	 * \brief Stateless random values hashed from a seed, e.g. from a particle or vertex index. Floats are in [0, 1) and
+	 * vectors hash the seed again for every component.
+	 */
 	struct FastRandom
 	{
 		static s32 randomInt32(u32 seed);
@@ -43,5 +53,58 @@ namespace math {
 		static Vector4 randomVector4(u32 seed, f32 min, f32 max);
 	};
 
+	/**
+	 * \brief Random number stream owned by one thread or job, so draws need no synchronisation.
+	 * \details The stream runs kLanes xoshiro128** generators side by side and hands out their outputs in lane order, so
+	 * bulk fills produce kLanes values per step with AVX2, AVX-512 or NEON. The integer sequence only depends on the seed:
+	 * filling an array gives the same values as drawing them one at a time, on every instruction set. Floats scaled to a
+	 * range can differ in the last bit where the compiler fuses the multiply-add.
+	 * Use split() to hand deterministic, non-overlapping streams to parallel jobs.
+	 */
+	class RandomStream
+	{
+	public:
+		static constexpr size_t kLanes = 16;
+
+		explicit RandomStream(u64 seed, u64 stream_index = 0);
+
+		// The calling thread's stream, used by Random
+		static RandomStream& threadLocal();
+
+		/**
+		 * \brief Returns a copy of this stream, then moves this stream 2^96 draws per lane ahead, so neither overlaps
+		 * the other in practice. Splitting the same stream in the same order always yields the same children.
+		 */
+		RandomStream split();
+
+		// Moves 2^64 draws per lane ahead. Values already buffered by single draws are dropped
+		void jump();
+
+		u32 nextU32();
+		f32 nextFloat32(); // [0, 1)
+		f32 nextFloat32(f32 min, f32 max); // [min, max)
+		s32 nextInt32(s32 min, s32 max); // [min, max)
+
+		Vector2 nextVector2(f32 min, f32 max);
+		Vector3 nextVector3(f32 min, f32 max);
+		Vector4 nextVector4(f32 min, f32 max);
+		Vector3 nextUnitSphereVector3();
+		Vector3 nextUnitVector3();
+
+		void fillU32(AxArrayRef<u32> out);
+		void fillFloat32(AxArrayRef<f32> out, f32 min = 0.f, f32 max = 1.f);
+		void fillVector3(AxArrayRef<Vector3> out, f32 min, f32 max);
+		void fillVector4(AxArrayRef<Vector4> out, f32 min, f32 max);
+
+	private:
+		void Refill();
+		void LongJump();
+		void ApplyJump(const u32 (&polynomial)[4]);
+
+		alignas(64) u32 m_state[4][kLanes];
+		alignas(64) u32 m_buffer[kLanes];
+		u32 m_bufferPos = kLanes;
+	};
+
 }
 }
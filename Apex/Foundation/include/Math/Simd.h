@@ -0,0 +1,152 @@
+#pragma once
+#include "Core/Platform.h"
+#include "Core/Types.h"
+
+// Selects the backend used by the math types. Define APEX_MATH_FORCE_SCALAR to build the portable version on any target
+#if defined(APEX_MATH_FORCE_SCALAR)
+#	define APEX_MATH_SIMD_SCALAR 1
+#elif defined(APEX_ARCH_X86)
+#	define APEX_MATH_SIMD_SSE 1
+#	if defined(__AVX2__)
+#		define APEX_MATH_SIMD_AVX2 1
+// GCC and Clang only enable FMA with -mfma (or -march), MSVC's /arch:AVX2 always includes it and never defines __FMA__
+#		if defined(__FMA__) || (defined(_MSC_VER) && !defined(__clang__))
+#			define APEX_MATH_SIMD_FMA 1
+#		endif
+#	endif
+#elif defined(APEX_ARCH_ARM64)
+#	define APEX_MATH_SIMD_NEON 1
+#	include <arm_neon.h>
+#else
+#	define APEX_MATH_SIMD_SCALAR 1
+#endif
+
+namespace apex {
+namespace math {
+namespace simd {
+
+	/**
+	 * \brief Thin wrappers over the 4-wide float registers of the target, used to implement Vector4, Matrix4x4 and Quat.
+	 * \details Loads and stores are unaligned, so the math types keep their plain float layout and stay compatible with
+	 * GLSL. shuffle2<i0, i1, i2, i3>(a, b) follows the SSE convention: the first two lanes come from a and the last two
+	 * from b.
+	 */
+#if defined(APEX_MATH_SIMD_SSE)
+
+	using float4 = __m128;
+
+	inline float4 load(const f32* p) { return _mm_loadu_ps(p); }
+	inline void store(f32* p, float4 v) { _mm_storeu_ps(p, v); }
+	inline float4 set(f32 x, f32 y, f32 z, f32 w) { return _mm_setr_ps(x, y, z, w); }
+	inline float4 splat(f32 s) { return _mm_set1_ps(s); }
+
+	inline float4 add(float4 a, float4 b) { return _mm_add_ps(a, b); }
+	inline float4 sub(float4 a, float4 b) { return _mm_sub_ps(a, b); }
+	inline float4 mul(float4 a, float4 b) { return _mm_mul_ps(a, b); }
+	inline float4 div(float4 a, float4 b) { return _mm_div_ps(a, b); }
+	inline float4 min(float4 a, float4 b) { return _mm_min_ps(a, b); }
+	inline float4 max(float4 a, float4 b) { return _mm_max_ps(a, b); }
+	inline float4 neg(float4 a) { return _mm_xor_ps(a, _mm_set1_ps(-0.f)); }
+
+	// a * b + c
+	inline float4 madd(float4 a, float4 b, float4 c)
+	{
+	#if defined(APEX_MATH_SIMD_FMA)
+		return _mm_fmadd_ps(a, b, c);
+	#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+	#endif
+	}
+
+	template <int i0, int i1, int i2, int i3>
+	inline float4 shuffle2(float4 a, float4 b) { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(i3, i2, i1, i0)); }
+
+	template <int i0, int i1, int i2, int i3>
+	inline float4 shuffle(float4 v) { return shuffle2<i0, i1, i2, i3>(v, v); }
+
+	inline f32 first(float4 v) { return _mm_cvtss_f32(v); }
+
+	inline f32 hsum(float4 v)
+	{
+		const float4 pairs = _mm_add_ps(v, _mm_movehl_ps(v, v));
+		return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+	}
+
+#elif defined(APEX_MATH_SIMD_NEON)
+
+	using float4 = float32x4_t;
+
+	inline float4 load(const f32* p) { return vld1q_f32(p); }
+	inline void store(f32* p, float4 v) { vst1q_f32(p, v); }
+	inline float4 set(f32 x, f32 y, f32 z, f32 w) { const f32 values[4] = { x, y, z, w }; return vld1q_f32(values); }
+	inline float4 splat(f32 s) { return vdupq_n_f32(s); }
+
+	inline float4 add(float4 a, float4 b) { return vaddq_f32(a, b); }
+	inline float4 sub(float4 a, float4 b) { return vsubq_f32(a, b); }
+	inline float4 mul(float4 a, float4 b) { return vmulq_f32(a, b); }
+	inline float4 div(float4 a, float4 b) { return vdivq_f32(a, b); }
+	inline float4 min(float4 a, float4 b) { return vminq_f32(a, b); }
+	inline float4 max(float4 a, float4 b) { return vmaxq_f32(a, b); }
+	inline float4 neg(float4 a) { return vnegq_f32(a); }
+
+	// a * b + c
+	inline float4 madd(float4 a, float4 b, float4 c) { return vfmaq_f32(c, a, b); }
+
+	template <int i0, int i1, int i2, int i3>
+	inline float4 shuffle2(float4 a, float4 b)
+	{
+		float4 res = vdupq_n_f32(vgetq_lane_f32(a, i0));
+		res = vsetq_lane_f32(vgetq_lane_f32(a, i1), res, 1);
+		res = vsetq_lane_f32(vgetq_lane_f32(b, i2), res, 2);
+		return vsetq_lane_f32(vgetq_lane_f32(b, i3), res, 3);
+	}
+
+	template <int i0, int i1, int i2, int i3>
+	inline float4 shuffle(float4 v) { return shuffle2<i0, i1, i2, i3>(v, v); }
+
+	inline f32 first(float4 v) { return vgetq_lane_f32(v, 0); }
+	inline f32 hsum(float4 v) { return vaddvq_f32(v); }
+
+#else
+
+	struct float4 { f32 v[4]; };
+
+	inline float4 load(const f32* p) { return { p[0], p[1], p[2], p[3] }; }
+	inline void store(f32* p, float4 v) { p[0] = v.v[0]; p[1] = v.v[1]; p[2] = v.v[2]; p[3] = v.v[3]; }
+	inline float4 set(f32 x, f32 y, f32 z, f32 w) { return { x, y, z, w }; }
+	inline float4 splat(f32 s) { return { s, s, s, s }; }
+
+	template <typename Op>
+	inline float4 apply(float4 a, float4 b, Op op) { return { op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3]) }; }
+
+	inline float4 add(float4 a, float4 b) { return apply(a, b, [](f32 x, f32 y) { return x + y; }); }
+	inline float4 sub(float4 a, float4 b) { return apply(a, b, [](f32 x, f32 y) { return x - y; }); }
+	inline float4 mul(float4 a, float4 b) { return apply(a, b, [](f32 x, f32 y) { return x * y; }); }
+	inline float4 div(float4 a, float4 b) { return apply(a, b, [](f32 x, f32 y) { return x / y; }); }
+	inline float4 min(float4 a, float4 b) { return apply(a, b, [](f32 x, f32 y) { return x < y ? x : y; }); }
+	inline float4 max(float4 a, float4 b) { return apply(a, b, [](f32 x, f32 y) { return x > y ? x : y; }); }
+	inline float4 neg(float4 a) { return { -a.v[0], -a.v[1], -a.v[2], -a.v[3] }; }
+
+	// a * b + c
+	inline float4 madd(float4 a, float4 b, float4 c) { return add(mul(a, b), c); }
+
+	template <int i0, int i1, int i2, int i3>
+	inline float4 shuffle2(float4 a, float4 b) { return { a.v[i0], a.v[i1], b.v[i2], b.v[i3] }; }
+
+	template <int i0, int i1, int i2, int i3>
+	inline float4 shuffle(float4 v) { return shuffle2<i0, i1, i2, i3>(v, v); }
+
+	inline f32 first(float4 v) { return v.v[0]; }
+	inline f32 hsum(float4 v) { return (v.v[0] + v.v[1]) + (v.v[2] + v.v[3]); }
+
+#endif
+
+	// Broadcasts one lane to all four
+	template <int i>
+	inline float4 lane(float4 v) { return shuffle<i, i, i, i>(v); }
+
+	inline f32 dot(float4 a, float4 b) { return hsum(mul(a, b)); }
+
+}
+}
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "Core/Types.h"
+
+#include "Math.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include "Matrix4x4.h"
+#include "Quaternion.h"
+
+namespace apex {
+namespace math {
+
+	/**
+	 * \brief Affine transform stored as the upper 3x4 block of a Matrix4x4, row-major with the translation in w.
+	 * \details The last row is implicitly (0, 0, 0, 1), so composing two transforms takes 12 vector multiply-adds instead
+	 * of 16 and the inverse only has to invert the 3x3 linear part. Keep transforms in this form and convert with
+	 * toMatrix() when uploading to the GPU.
+	 */
+	struct AffineTransform
+	{
+		Vector4 m_rows[3] { { 1.f, 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f, 0.f }, { 0.f, 0.f, 1.f, 0.f } };
+
+		constexpr AffineTransform() = default;
+		constexpr AffineTransform(Vector4 r0, Vector4 r1, Vector4 r2) : m_rows { r0, r1, r2 } {}
+
+		// Drops the last row of the matrix, which must be (0, 0, 0, 1)
+		static AffineTransform fromMatrix(Matrix4x4 const& m);
+
+		static AffineTransform fromTranslation(Vector3 const& v);
+		static AffineTransform fromScale(Vector3 const& v);
+
+		// View transform for a camera facing in -Z direction, same as math::lookAt
+		static AffineTransform lookAt(Vector3 const& eye, Vector3 const& target, Vector3 const& up);
+
+		static constexpr AffineTransform identity()
+		{
+			return {};
+		}
+
+		Vector4 operator [](size_t row) const { return m_rows[row]; }
+		Vector4& operator [](size_t row) { return m_rows[row]; }
+
+		Vector3 getTranslation() const;
+		void setTranslation(Vector3 const& v);
+
+		Vector3 transformPoint(Vector3 const& p) const; // (M * (p, 1)).xyz
+		Vector3 transformDirection(Vector3 const& d) const; // (M * (d, 0)).xyz
+
+		AffineTransform inverse() const;
+		Matrix4x4 toMatrix() const;
+	};
+
+	/**
+	 * \brief Rotation, uniform scale and translation : p' = translation + scale * rotation.applyToVector(p)
+	 * \details Rigid motions with an optional uniform scale stay closed under composition and inversion, so both are
+	 * computed directly on the quaternion. The 32 byte layout (half a Matrix4x4) is two SIMD registers, the rotation and
+	 * the translation with the scale in w. Use AffineTransform for non-uniform scale or shear.
+	 */
+	struct RigidTransform
+	{
+		Quat rotation {};
+		Vector3 translation {};
+		f32 scale = 1.f;
+
+		constexpr RigidTransform() = default;
+		constexpr RigidTransform(Quat const& rotation, Vector3 const& translation, f32 scale = 1.f)
+		: rotation(rotation), translation(translation), scale(scale)
+		{}
+
+		static constexpr RigidTransform identity()
+		{
+			return {};
+		}
+
+		Vector3 transformPoint(Vector3 const& p) const;
+		Vector3 transformDirection(Vector3 const& d) const; // rotated and scaled, not translated
+
+		// Expects a unit rotation quaternion
+		RigidTransform inverse() const;
+
+		AffineTransform toAffine() const;
+		Matrix4x4 toMatrix() const;
+	};
+
+	// Transform utility functions
+
+	AffineTransform operator*(AffineTransform const& a, AffineTransform const& b); // applies b, then a
+	RigidTransform operator*(RigidTransform const& a, RigidTransform const& b); // applies b, then a
+
+	AffineTransform inverse(AffineTransform const& t);
+	RigidTransform inverse(RigidTransform const& t);
+
+}
+}
+
+#ifndef APEX_MATH_SKIP_INLINE_IMPL
+#include "Transform.inl"
+#endif
@@ -0,0 +1,296 @@
+#pragma once
+#include <cstddef>
+
+#include "Transform.h"
+
+#include "Simd.h"
+#include "Vector3.inl"
+#include "Vector4.inl"
+#include "Matrix4x4.inl"
+#include "Quaternion.inl"
+
+namespace apex {
+namespace math {
+
+namespace detail {
+
+	// Same as q.applyToVector(v) for a unit quaternion, without the two quaternion products
+	inline Vector3 rotate(Quat const& q, Vector3 const& v)
+	{
+		// applyToVector computes q* v q, a rotation by the conjugate
+		const Vector3 u { -q.x, -q.y, -q.z };
+		const Vector3 t = 2.f * cross(u, v);
+		return v + q.w * t + cross(u, t);
+	}
+
+	// The rigid transform kernels work on two registers: the rotation in (w, x, y, z) lane order as laid out in Quat,
+	// and the translation with the scale in the w lane
+	static_assert(sizeof(Quat) == 4 * sizeof(f32) && sizeof(Vector3) == 3 * sizeof(f32));
+	static_assert(offsetof(RigidTransform, translation) == 4 * sizeof(f32) && offsetof(RigidTransform, scale) == 7 * sizeof(f32));
+
+	inline simd::float4 loadRotation(RigidTransform const& t) { return simd::load(reinterpret_cast<const f32*>(&t)); }
+	inline simd::float4 loadTranslationScale(RigidTransform const& t) { return simd::load(reinterpret_cast<const f32*>(&t) + 4); }
+
+	inline RigidTransform storeRigid(simd::float4 rotation, simd::float4 translation_scale)
+	{
+		RigidTransform t;
+		simd::store(reinterpret_cast<f32*>(&t), rotation);
+		simd::store(reinterpret_cast<f32*>(&t) + 4, translation_scale);
+		return t;
+	}
+
+	// Cross product of the xyz lanes as yzx(u * yzx(v) - yzx(u) * v), three shuffles instead of four. The w lane is 0 as
+	// long as the w lane of u is 0, even when contracted into FMAs
+	inline simd::float4 cross3(simd::float4 u, simd::float4 v)
+	{
+		const simd::float4 res = simd::sub(
+			simd::mul(u, simd::shuffle<1, 2, 0, 3>(v)),
+			simd::mul(simd::shuffle<1, 2, 0, 3>(u), v));
+		return simd::shuffle<1, 2, 0, 3>(res);
+	}
+
+	/**
+	 * \brief rotate() on registers: q in (w, x, y, z) lane order, v in the xyz lanes. The w lane of v passes through
+	 */
+	inline simd::float4 rotate(simd::float4 q, simd::float4 v)
+	{
+		const simd::float4 u = simd::mul(simd::shuffle<1, 2, 3, 0>(q), simd::set(-1.f, -1.f, -1.f, 0.f));
+		const simd::float4 uv = cross3(u, v);
+		const simd::float4 t = simd::add(uv, uv);
+		return simd::add(simd::madd(simd::lane<0>(q), t, v), cross3(u, t));
+	}
+
+}
+
+	/**************************************************************
+	 * AffineTransform
+	 *************************************************************/
+
+	#pragma region AffineTransform member functions
+
+	inline AffineTransform AffineTransform::fromMatrix(Matrix4x4 const& m)
+	{
+		return {
+			{ m.m_columns[0].x, m.m_columns[1].x, m.m_columns[2].x, m.m_columns[3].x },
+			{ m.m_columns[0].y, m.m_columns[1].y, m.m_columns[2].y, m.m_columns[3].y },
+			{ m.m_columns[0].z, m.m_columns[1].z, m.m_columns[2].z, m.m_columns[3].z }
+		};
+	}
+
+	inline AffineTransform AffineTransform::fromTranslation(Vector3 const& v)
+	{
+		return {
+			{ 1.f, 0.f, 0.f, v.x },
+			{ 0.f, 1.f, 0.f, v.y },
+			{ 0.f, 0.f, 1.f, v.z }
+		};
+	}
+
+	inline AffineTransform AffineTransform::fromScale(Vector3 const& v)
+	{
+		return {
+			{ v.x, 0.f, 0.f, 0.f },
+			{ 0.f, v.y, 0.f, 0.f },
+			{ 0.f, 0.f, v.z, 0.f }
+		};
+	}
+
+	inline AffineTransform AffineTransform::lookAt(Vector3 const& eye, Vector3 const& target, Vector3 const& up)
+	{
+		Vector3 Z = normalize(eye - target);
+		Vector3 X = normalize(cross(up, Z));
+		Vector3 Y = cross(Z, X);
+
+		return {
+			{ X, -dot(X, eye) },
+			{ Y, -dot(Y, eye) },
+			{ Z, -dot(Z, eye) }
+		};
+	}
+
+	inline Vector3 AffineTransform::getTranslation() const
+	{
+		return { m_rows[0].w, m_rows[1].w, m_rows[2].w };
+	}
+
+	inline void AffineTransform::setTranslation(Vector3 const& v)
+	{
+		m_rows[0].w = v.x;
+		m_rows[1].w = v.y;
+		m_rows[2].w = v.z;
+	}
+
+	inline Vector3 AffineTransform::transformPoint(Vector3 const& p) const
+	{
+		return {
+			m_rows[0].x * p.x + m_rows[0].y * p.y + m_rows[0].z * p.z + m_rows[0].w,
+			m_rows[1].x * p.x + m_rows[1].y * p.y + m_rows[1].z * p.z + m_rows[1].w,
+			m_rows[2].x * p.x + m_rows[2].y * p.y + m_rows[2].z * p.z + m_rows[2].w
+		};
+	}
+
+	inline Vector3 AffineTransform::transformDirection(Vector3 const& d) const
+	{
+		return {
+			m_rows[0].x * d.x + m_rows[0].y * d.y + m_rows[0].z * d.z,
+			m_rows[1].x * d.x + m_rows[1].y * d.y + m_rows[1].z * d.z,
+			m_rows[2].x * d.x + m_rows[2].y * d.y + m_rows[2].z * d.z
+		};
+	}
+
+	inline AffineTransform AffineTransform::inverse() const
+	{
+		return math::inverse(*this);
+	}
+
+	inline Matrix4x4 AffineTransform::toMatrix() const
+	{
+		return { row_major{},
+			m_rows[0].x, m_rows[0].y, m_rows[0].z, m_rows[0].w,
+			m_rows[1].x, m_rows[1].y, m_rows[1].z, m_rows[1].w,
+			m_rows[2].x, m_rows[2].y, m_rows[2].z, m_rows[2].w,
+			        0.f,         0.f,         0.f,         1.f
+		};
+	}
+
+#pragma endregion
+
+	/**************************************************************
+	 * RigidTransform
+	 *************************************************************/
+
+	#pragma region RigidTransform member functions
+
+	inline Vector3 RigidTransform::transformPoint(Vector3 const& p) const
+	{
+		return translation + scale * detail::rotate(rotation, p);
+	}
+
+	inline Vector3 RigidTransform::transformDirection(Vector3 const& d) const
+	{
+		return scale * detail::rotate(rotation, d);
+	}
+
+	inline RigidTransform RigidTransform::inverse() const
+	{
+		return math::inverse(*this);
+	}
+
+	inline AffineTransform RigidTransform::toAffine() const
+	{
+		const f32 x = rotation.x, y = rotation.y, z = rotation.z, w = rotation.w;
+		const f32 xx = x * x, yy = y * y, zz = z * z;
+		const f32 xy = x * y, xz = x * z, yz = y * z;
+		const f32 wx = w * x, wy = w * y, wz = w * z;
+		const f32 s = scale, s2 = 2.f * scale;
+
+		// Rows of the matrix applyToVector multiplies with, which is Quat::matrix()
+		return {
+			{ s - s2 * (yy + zz), s2 * (xy + wz), s2 * (xz - wy), translation.x },
+			{ s2 * (xy - wz), s - s2 * (xx + zz), s2 * (yz + wx), translation.y },
+			{ s2 * (xz + wy), s2 * (yz - wx), s - s2 * (xx + yy), translation.z }
+		};
+	}
+
+	inline Matrix4x4 RigidTransform::toMatrix() const
+	{
+		return toAffine().toMatrix();
+	}
+
+#pragma endregion
+
+	#pragma region Transform utility functions
+
+	inline AffineTransform operator*(AffineTransform const& a, AffineTransform const& b)
+	{
+		const simd::float4 b0 = detail::load(b.m_rows[0]);
+		const simd::float4 b1 = detail::load(b.m_rows[1]);
+		const simd::float4 b2 = detail::load(b.m_rows[2]);
+		const simd::float4 translationMask = simd::set(0.f, 0.f, 0.f, 1.f);
+
+		// Row i of the product is a[i].x * b0 + a[i].y * b1 + a[i].z * b2 + (0, 0, 0, a[i].w)
+		auto row = [&](Vector4 const& ai)
+		{
+			const simd::float4 r = detail::load(ai);
+			simd::float4 res = simd::mul(r, translationMask);
+			res = simd::madd(simd::lane<0>(r), b0, res);
+			res = simd::madd(simd::lane<1>(r), b1, res);
+			res = simd::madd(simd::lane<2>(r), b2, res);
+			return detail::store(res);
+		};
+
+		return { row(a.m_rows[0]), row(a.m_rows[1]), row(a.m_rows[2]) };
+	}
+
+	inline RigidTransform operator*(RigidTransform const& a, RigidTransform const& b)
+	{
+		const simd::float4 aRotation = detail::loadRotation(a);
+		const simd::float4 aTranslationScale = detail::loadTranslationScale(a);
+
+		// applyToVector(p) with (b.rotation * a.rotation) rotates by b.rotation first, then by a.rotation
+		const simd::float4 rotation = detail::quatMul(detail::loadRotation(b), aRotation);
+
+		// xyz: a.translation + a.scale * rotate(a.rotation, b.translation), w: a.scale * b.scale
+		const simd::float4 rotated = detail::rotate(aRotation, detail::loadTranslationScale(b));
+		const simd::float4 translationScale = simd::madd(simd::lane<3>(aTranslationScale), rotated,
+			simd::mul(aTranslationScale, simd::set(1.f, 1.f, 1.f, 0.f)));
+
+		return detail::storeRigid(rotation, translationScale);
+	}
+
+	inline AffineTransform inverse(AffineTransform const& t)
+	{
+		const simd::float4 r0 = detail::load(t.m_rows[0]);
+		const simd::float4 r1 = detail::load(t.m_rows[1]);
+		const simd::float4 r2 = detail::load(t.m_rows[2]);
+
+		// Columns of the adjugate of the linear part are cross products of its rows. Their w lanes are only close to 0
+		// once the compiler contracts the products into FMAs, so they are kept out of the determinant
+		auto cross = [](simd::float4 u, simd::float4 v)
+		{
+			return simd::sub(
+				simd::mul(simd::shuffle<1, 2, 0, 3>(u), simd::shuffle<2, 0, 1, 3>(v)),
+				simd::mul(simd::shuffle<2, 0, 1, 3>(u), simd::shuffle<1, 2, 0, 3>(v)));
+		};
+
+		const simd::float4 a0 = cross(r1, r2);
+		const simd::float4 recipDet = simd::splat(1.f / simd::dot(simd::mul(r0, simd::set(1.f, 1.f, 1.f, 0.f)), a0));
+		const simd::float4 c0 = simd::mul(a0, recipDet);
+		const simd::float4 c1 = simd::mul(cross(r2, r0), recipDet);
+		const simd::float4 c2 = simd::mul(cross(r0, r1), recipDet);
+
+		// -(L^-1 * translation), the translation being the w lanes of the rows
+		simd::float4 translation = simd::mul(c0, simd::lane<3>(r0));
+		translation = simd::madd(c1, simd::lane<3>(r1), translation);
+		translation = simd::madd(c2, simd::lane<3>(r2), translation);
+		translation = simd::neg(translation);
+
+		// Transposes the columns (c0, c1, c2, translation) into the rows of the result
+		const simd::float4 t0 = simd::shuffle2<0, 1, 0, 1>(c0, c1);
+		const simd::float4 t1 = simd::shuffle2<2, 3, 2, 3>(c0, c1);
+		const simd::float4 t2 = simd::shuffle2<0, 1, 0, 1>(c2, translation);
+		const simd::float4 t3 = simd::shuffle2<2, 3, 2, 3>(c2, translation);
+
+		return {
+			detail::store(simd::shuffle2<0, 2, 0, 2>(t0, t2)),
+			detail::store(simd::shuffle2<1, 3, 1, 3>(t0, t2)),
+			detail::store(simd::shuffle2<0, 2, 0, 2>(t1, t3))
+		};
+	}
+
+	inline RigidTransform inverse(RigidTransform const& t)
+	{
+		const simd::float4 rotation = simd::mul(detail::loadRotation(t), simd::set(1.f, -1.f, -1.f, -1.f));
+		const simd::float4 scale = simd::splat(1.f / t.scale);
+
+		// xyz: -scale * rotate(conjugate, translation), w: scale
+		const simd::float4 rotated = detail::rotate(rotation, detail::loadTranslationScale(t));
+		const simd::float4 translationScale = simd::mul(scale, simd::madd(rotated, simd::set(-1.f, -1.f, -1.f, 0.f), simd::set(0.f, 0.f, 0.f, 1.f)));
+
+		return detail::storeRigid(rotation, translationScale);
+	}
+
+#pragma endregion
+
+}
+}
@@ -1,8 +1,6 @@
 #pragma once
 //#pragma message("Including Vector3.inl")
 
-#include <immintrin.h>
-
 #include "Math.h"
 #include "Vector3.h"
 #include "Core/Utility.h"
@@ -36,7 +34,7 @@ namespace math {
 	{
 		m_values[0] *= v.m_values[0];
 		m_values[1] *= v.m_values[1];
-		m_values[2] *= v.m_values[0];
+		m_values[2] *= v.m_values[2];
 		return *this;
 	}
 
@@ -89,55 +87,26 @@ namespace math {
 
 	#pragma region Vector3 utility functions
 
+	// Vector3 is kept scalar. Its 12-byte layout cannot be loaded into a 4-wide register without reading past the end
+	// of the object, and the partial loads and stores needed instead cost more than the three scalar operations
+
 	inline Vector3 operator+(Vector3 const& u, Vector3 const& v)
 	{
-		__m128 mU = _mm_loadu_ps(u.m_values);
-		__m128 mV = _mm_loadu_ps(v.m_values);
-		__m128 mRes = _mm_add_ps(mU, mV);
-
-		float res[4];
-		_mm_storeu_ps(res, mRes);
-		return res;
-
 		return { u.x + v.x, u.y + v.y, u.z + v.z };
 	}
 
 	inline Vector3 operator-(Vector3 const& u, Vector3 const& v)
 	{
-		__m128 mU = _mm_loadu_ps(u.m_values);
-		__m128 mV = _mm_loadu_ps(v.m_values);
-		__m128 mRes = _mm_sub_ps(mU, mV);
-
-		float res[4];
-		_mm_storeu_ps(res, mRes);
-		return res;
-
 		return { u.x - v.x, u.y - v.y, u.z - v.z };
 	}
 
 	inline Vector3 operator*(Vector3 const& u, Vector3 const& v)
 	{
-		__m128 mU = _mm_loadu_ps(u.m_values);
-        __m128 mV = _mm_loadu_ps(v.m_values);
-		__m128 mRes = _mm_mul_ps(mU, mV);
-
-		float res[4];
-		_mm_storeu_ps(res, mRes);
-		return res;
-
 		return { u.x * v.x, u.y * v.y, u.z * v.z };
 	}
 
 	inline Vector3 operator*(f32 t, Vector3 const& v)
 	{
-		__m128 mT = _mm_set1_ps(t);
-        __m128 mV = _mm_loadu_ps(v.m_values);
-		__m128 mRes = _mm_mul_ps(mT, mV);
-
-		float res[4];
-		_mm_storeu_ps(res, mRes);
-		return res;
-
 		return { t * v.x, t * v.y, t * v.z };
 	}
 
@@ -203,17 +172,6 @@ namespace math {
 
 	inline f32 dot(Vector3 const& u, Vector3 const& v)
 	{
-		__m128 mU = _mm_loadu_ps(u.m_values);
-		__m128 mV = _mm_loadu_ps(v.m_values);
-		__m128 mRes = _mm_dp_ps(mU, mV, 0x71 /* mask */);
-
-		// mask: 0111 0001 (use the lower 3 positions for dot product & save result in only the first position)
-		// the high bits define the condition for dot product - only positions with 1 in the high bits are used
-		// the low bits define the broadcast - broadcast the result to all positions with 1 in the low bits
-
-		float res = _mm_cvtss_f32(mRes);
-		return res;
-
 		return u.x * v.x
 			 + u.y * v.y
 			 + u.z * v.z;
@@ -221,17 +179,6 @@ namespace math {
 
 	inline Vector3 cross(Vector3 const& u, Vector3 const& v)
 	{
-		__m128 mU = _mm_loadu_ps(u.m_values);
-		__m128 mV = _mm_loadu_ps(v.m_values);
-		__m128 mRes = _mm_sub_ps(
-			_mm_mul_ps(_mm_permute_ps(mU, _MM_SHUFFLE(3, 0, 2, 1)), _mm_permute_ps(mV, _MM_SHUFFLE(3, 1, 0, 2))),
-			_mm_mul_ps(_mm_permute_ps(mU, _MM_SHUFFLE(3, 1, 0, 2)), _mm_permute_ps(mV, _MM_SHUFFLE(3, 0, 2, 1)))
-		);
-
-		float res[4];
-		_mm_storeu_ps(res, mRes);
-		return res;
-
 		return {
 			u[1] * v[2] - u[2] * v[1],
 			u[2] * v[0] - u[0] * v[2],
@@ -2,11 +2,27 @@
 //#pragma message("Including Vector4.inl")
 
 #include "Vector4.h"
+#include "Simd.h"
 #include "Core/Utility.h"
 
 namespace apex {
 namespace math {
 
+namespace detail {
+
+	inline simd::float4 load(Vector4 const& v)
+	{
+		return simd::load(v.m_values);
+	}
+
+	inline Vector4 store(simd::float4 v)
+	{
+		Vector4 res;
+		simd::store(res.m_values, v);
+		return res;
+	}
+
+}
 	
 	/**************************************************************
 	 * Vector4
@@ -16,37 +32,25 @@ namespace math {
 
 	inline Vector4& Vector4::operator+=(Vector4 const& v)
 	{
-		m_values[0] += v.m_values[0];
-		m_values[1] += v.m_values[1];
-		m_values[2] += v.m_values[2];
-		m_values[3] += v.m_values[3];
+		simd::store(m_values, simd::add(detail::load(*this), detail::load(v)));
 		return *this;
 	}
 
 	inline Vector4& Vector4::operator-=(Vector4 const& v)
 	{
-		m_values[0] -= v.m_values[0];
-		m_values[1] -= v.m_values[1];
-		m_values[2] -= v.m_values[2];
-		m_values[3] -= v.m_values[3];
+		simd::store(m_values, simd::sub(detail::load(*this), detail::load(v)));
 		return *this;
 	}
 
 	inline Vector4& Vector4::operator*=(Vector4 const &v)
 	{
-		m_values[0] *= v.m_values[0];
-		m_values[1] *= v.m_values[1];
-		m_values[2] *= v.m_values[0];
-		m_values[3] *= v.m_values[3];
+		simd::store(m_values, simd::mul(detail::load(*this), detail::load(v)));
 		return *this;
 	}
 
 	inline Vector4& Vector4::operator*=(const f32 t)
 	{
-		m_values[0] *= t;
-		m_values[1] *= t;
-		m_values[2] *= t;
-		m_values[3] *= t;
+		simd::store(m_values, simd::mul(detail::load(*this), simd::splat(t)));
 		return *this;
 	}
 
@@ -61,22 +65,22 @@ namespace math {
 
 	inline Vector4 operator+(Vector4 const& u, Vector4 const& v)
 	{
-		return { u.x + v.x, u.y + v.y, u.z + v.z, u.w + v.w };
+		return detail::store(simd::add(detail::load(u), detail::load(v)));
 	}
 
 	inline Vector4 operator-(Vector4 const& u, Vector4 const& v)
 	{
-		return { u.x - v.x, u.y - v.y, u.z - v.z, u.w - v.w };
+		return detail::store(simd::sub(detail::load(u), detail::load(v)));
 	}
 
 	inline Vector4 operator*(Vector4 const& u, Vector4 const& v)
 	{
-		return { u.x * v.x, u.y * v.y, u.z * v.z, u.w * v.w };
+		return detail::store(simd::mul(detail::load(u), detail::load(v)));
 	}
 
 	inline Vector4 operator*(f32 t, Vector4 const& v)
 	{
-		return { t * v.x, t * v.y, t * v.z, t * v.w };
+		return detail::store(simd::mul(simd::splat(t), detail::load(v)));
 	}
 
 	inline Vector4 operator*(Vector4 const& v, f32 t)
@@ -126,26 +130,17 @@ namespace math {
 
 	inline f32 dot(Vector4 const& u, Vector4 const& v)
 	{
-		__m128 mU = _mm_loadu_ps(u.m_values);
-		__m128 mV = _mm_loadu_ps(v.m_values);
-		__m128 mRes = _mm_dp_ps(mU, mV, 0xf1 /* mask */);
-
-		// mask: 1111 0001 (use all 4 positions for dot product & save result in only the first position)
-		// the high bits define the condition for dot product - only positions with 1 in the high bits are used
-		// the low bits define the broadcast - broadcast the result to all positions with 1 in the low bits
-
-		float res = _mm_cvtss_f32(mRes);
-		return res;
+		return simd::dot(detail::load(u), detail::load(v));
 	}
 
 	inline Vector4 min(Vector4 const& u, Vector4 const& v)
 	{
-		return { apex::min(u.x, v.x), apex::min(u.y, v.y), apex::min(u.z, v.z), apex::min(u.w, v.w) };
+		return detail::store(simd::min(detail::load(u), detail::load(v)));
 	}
 
 	inline Vector4 max(Vector4 const& u, Vector4 const& v)
 	{
-		return { apex::max(u.x, v.x), apex::max(u.y, v.y), apex::max(u.z, v.z), apex::max(u.w, v.w) };
+		return detail::store(simd::max(detail::load(u), detail::load(v)));
 	}
 
 #pragma endregion
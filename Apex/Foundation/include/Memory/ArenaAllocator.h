@@ -24,5 +24,36 @@ namespace mem {
 #endif
 	};
 
+	/**
+	 * \brief Standard allocator adaptor over an ArenaAllocator, for containers that only live as long as the arena
+	 * (e.g. per-frame AxHashMaps). deallocate is a no-op; memory comes back when the arena is reset.
+	 */
+	template <typename T>
+	class ArenaStdAllocator
+	{
+	public:
+		using value_type = T;
+
+		ArenaStdAllocator(ArenaAllocator* arena) noexcept : m_arena(arena) {}
+
+		template <typename U>
+		ArenaStdAllocator(ArenaStdAllocator<U> const& other) noexcept : m_arena(other.m_arena) {}
+
+		[[nodiscard]] T* allocate(size_t n)
+		{
+			return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* p, size_t n) noexcept {}
+
+		template <typename U>
+		bool operator==(ArenaStdAllocator<U> const& other) const noexcept { return m_arena == other.m_arena; }
+
+	private:
+		ArenaAllocator* m_arena;
+
+		template <typename U> friend class ArenaStdAllocator;
+	};
+
 }
 }
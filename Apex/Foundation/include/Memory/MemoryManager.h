@@ -134,13 +134,16 @@ namespace apex::mem {
 
 		[[nodiscard]] constexpr T* allocate(size_t n)
 		{
-			return static_cast<T*>(mem::MemoryManager::allocate(n));
+			return static_cast<T*>(mem::MemoryManager::allocate(n * sizeof(T)));
 		}
 
 		void deallocate(T* p, size_t n) noexcept
 		{
 			mem::MemoryManager::free(p);
 		}
+
+		template <typename U>
+		bool operator==(const StdAllocator<U>&) const noexcept { return true; }
 	};
 
 }
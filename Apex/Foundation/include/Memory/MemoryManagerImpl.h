@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Core/Asserts.h"
+#include "Concurrency/Concurrency.h"
 #include "ArenaAllocator.h"
 #include "PoolAllocator.h"
 
@@ -15,8 +16,11 @@ namespace mem {
 	class MemoryManagerImpl
 	{
 	public:
+		static constexpr size_t kMaxMemoryPools = 32;
+
 		std::vector<ArenaAllocator> m_arenaAllocators;
 		std::vector<PoolAllocator> m_poolAllocators;
+		concurrency::SpinLock m_poolLocks[kMaxMemoryPools]; // Pools are shared by every thread, e.g. nodes of concurrent containers
 
 		void setUpMemoryPools();
 		void setUpMemoryArenas(u32 numFramesInFlight, u32 frameArenaSize);
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Core/Asserts.h"
+#include "Core/TypeTraits.h"
 
 namespace apex {
 
@@ -214,6 +215,9 @@ namespace apex {
 		template <typename> friend class UniquePtr;
 	};
 
+	template <typename T>
+	struct is_trivially_relocatable<UniquePtr<T>> : std::true_type {};
+
 	// make a UniquePtr
 	template <typename T, typename... Args> requires (!std::is_array_v<T>) // not array
 	[[nodiscard]] constexpr auto make_unique(Args&&... args) noexcept -> UniquePtr<T>
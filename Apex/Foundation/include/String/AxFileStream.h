@@ -0,0 +1,261 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+#include "Core/Asserts.h"
+#include "Core/Files.h"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+
+namespace apex {
+
+namespace detail {
+
+	/**
+	 * \brief Runs one positional read or write at a time for the buffered file streams.
+	 * \details Without a thread the request is carried out inside Submit(). With a thread Submit() returns immediately
+	 * and Wait() blocks until the request has completed, so the stream can work on its other buffer in the meantime.
+	 */
+	class FileStreamWorker
+	{
+	public:
+		FileStreamWorker() = default;
+		~FileStreamWorker();
+
+		NON_COPYABLE(FileStreamWorker);
+		NON_MOVABLE(FileStreamWorker);
+
+		void StartThread();
+
+		void SubmitRead(const File* file, u64 offset, char* buffer, size_t size);
+		void SubmitWrite(File* file, u64 offset, const char* buffer, size_t size);
+
+		// Waits for the pending request and returns the number of bytes it transferred, or 0 if nothing was pending
+		size_t Wait();
+
+		[[nodiscard]] bool IsPending() const { return m_pending; }
+		[[nodiscard]] u64 GetPendingOffset() const { return m_offset; }
+		[[nodiscard]] size_t GetPendingSize() const { return m_size; }
+
+	private:
+		enum State : u32 { eIdle, eRequested, eCompleted, eExit };
+
+		void Submit();
+		void Execute();
+		void ThreadMain();
+
+		std::thread          m_thread;
+		std::atomic<u32>     m_state { eIdle };
+		bool                 m_pending {};
+
+		File*                m_file {};
+		bool                 m_write {};
+		u64                  m_offset {};
+		char*                m_buffer {};
+		size_t               m_size {};
+		size_t               m_transferred {};
+	};
+
+	template <typename T>
+	constexpr T ByteSwap(T value) noexcept
+	{
+		static_assert(std::is_integral_v<T>);
+		using U = std::make_unsigned_t<T>;
+		U in = static_cast<U>(value), out = 0;
+		for (size_t i = 0; i < sizeof(T); i++)
+		{
+			out = static_cast<U>((out << 8) | (in & 0xff));
+			in = static_cast<U>(in >> 8);
+		}
+		return static_cast<T>(out);
+	}
+
+	template <typename T>
+	constexpr T ToEndian(T value, std::endian endian) noexcept
+	{
+		return endian == std::endian::native ? value : ByteSwap(value);
+	}
+
+}
+
+	/**
+	 * \brief Reads an apex::File sequentially through a fixed-size double buffer, so files of any size are read in
+	 * constant memory.
+	 * \details With prefetch enabled a worker thread reads the next chunk into the second buffer while the current one
+	 * is being consumed. Seeking inside the current chunk is free; seeking elsewhere discards the buffered data.
+	 * The file must stay open and unmodified while the reader is alive.
+	 */
+	class AxFileStreamReader
+	{
+	public:
+		static constexpr size_t kDefaultBufferSize = 64 * 1024;
+
+		explicit AxFileStreamReader(const File& file, size_t buffer_size = kDefaultBufferSize, bool prefetch = false);
+		~AxFileStreamReader();
+
+		NON_COPYABLE(AxFileStreamReader);
+		NON_MOVABLE(AxFileStreamReader);
+
+		/**
+		 * \brief Copies up to size bytes into dst and returns the number of bytes read, which is less than size only at the
+		 * end of the file
+		 */
+		size_t Read(void* dst, size_t size);
+
+		template <typename T>
+		[[nodiscard]] bool ReadObject(T& object)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			return Read(&object, sizeof(T)) == sizeof(T);
+		}
+
+		template <typename T>
+		[[nodiscard]] bool ReadArray(T* arr, size_t element_count)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			return Read(arr, sizeof(T) * element_count) == sizeof(T) * element_count;
+		}
+
+		/**
+		 * \brief Reads an integer stored with the given byte order
+		 */
+		template <typename T>
+		[[nodiscard]] bool ReadInt(T& value, std::endian endian = std::endian::little)
+		{
+			if (!ReadObject(value))
+				return false;
+			value = detail::ToEndian(value, endian);
+			return true;
+		}
+
+		// LEB128 variable-length integers, signed values are zigzag encoded
+		[[nodiscard]] bool ReadVarU64(u64& value);
+		[[nodiscard]] bool ReadVarS64(s64& value);
+
+		/**
+		 * \brief Skips forward to the next multiple of alignment, e.g. to the start of a section written after
+		 * AxFileStreamWriter::AlignTo
+		 */
+		void AlignTo(size_t alignment);
+
+		void Seek(u64 offset);
+		void Skip(u64 count) { Seek(Tell() + count); }
+
+		[[nodiscard]] u64 Tell() const { return m_bufferOffset + m_readPos; }
+		[[nodiscard]] u64 GetSize() const { return m_file->GetSize(); }
+		[[nodiscard]] bool IsEof() const { return Tell() >= GetSize(); }
+
+	private:
+		bool Refill();
+		void Prefetch();
+		size_t ReadDirect(char* dst, size_t size);
+
+		const File*               m_file;
+		char*                     m_buffers[2] {};
+		size_t                    m_bufferSize;
+		u32                       m_current {};
+
+		u64                       m_bufferOffset {}; // file offset of the first byte in the current buffer
+		size_t                    m_readPos {};
+		size_t                    m_readEnd {};
+
+		bool                      m_prefetch;
+		detail::FileStreamWorker  m_worker;
+	};
+
+	/**
+	 * \brief Writes an apex::File sequentially through a fixed-size double buffer.
+	 * \details When a buffer fills up it is written out while the other one is filled. With background enabled the
+	 * write runs on a worker thread, otherwise it happens inline. Everything is flushed on destruction.
+	 */
+	class AxFileStreamWriter
+	{
+	public:
+		static constexpr size_t kDefaultBufferSize = 64 * 1024;
+
+		explicit AxFileStreamWriter(File& file, size_t buffer_size = kDefaultBufferSize, bool background = false);
+		~AxFileStreamWriter();
+
+		NON_COPYABLE(AxFileStreamWriter);
+		NON_MOVABLE(AxFileStreamWriter);
+
+		void Write(const void* src, size_t size);
+
+		template <typename T>
+		void WriteObject(const T* object)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			Write(object, sizeof(T));
+		}
+
+		template <typename T>
+		void WriteArray(const T* arr, size_t element_count)
+		{
+			static_assert(std::is_trivially_copyable_v<T>);
+			Write(arr, sizeof(T) * element_count);
+		}
+
+		/**
+		 * \brief Writes an integer with the given byte order
+		 */
+		template <typename T>
+		void WriteInt(T value, std::endian endian = std::endian::little)
+		{
+			value = detail::ToEndian(value, endian);
+			WriteObject(&value);
+		}
+
+		// LEB128 variable-length integers, signed values are zigzag encoded
+		void WriteVarU64(u64 value);
+		void WriteVarS64(s64 value);
+
+		/**
+		 * \brief Pads with fill bytes up to the next multiple of alignment, so the following section can be found with
+		 * AxFileStreamReader::AlignTo or memory mapped
+		 */
+		void AlignTo(size_t alignment, u8 fill = 0);
+
+		/**
+		 * \brief Flushes and moves the write position, e.g. to patch a header once the size of the data is known
+		 */
+		void Seek(u64 offset);
+
+		/**
+		 * \brief Writes out all buffered data and waits for it to complete
+		 */
+		void Flush();
+
+		[[nodiscard]] u64 Tell() const { return m_bufferOffset + m_writePos; }
+
+		/**
+		 * \brief Number of bytes that have actually reached the file. Buffered data is only counted once it is flushed
+		 */
+		[[nodiscard]] u64 GetBytesWritten() const { return m_bytesWritten; }
+
+		/**
+		 * \brief True if any write so far transferred fewer bytes than were submitted
+		 */
+		[[nodiscard]] bool HasFailed() const { return m_failed; }
+
+	private:
+		void SubmitBuffer();
+		void CompleteWrite();
+
+		File*                     m_file;
+		char*                     m_buffers[2] {};
+		size_t                    m_bufferSize;
+		u32                       m_current {};
+
+		u64                       m_bufferOffset {}; // file offset the current buffer will be written to
+		size_t                    m_writePos {};
+
+		u64                       m_bytesWritten {};
+		bool                      m_failed {};
+
+		detail::FileStreamWorker  m_worker;
+	};
+
+}
@@ -1,5 +1,9 @@
 ﻿#pragma once
 
+#include <type_traits>
+
+#include "AxStringHash.h"
+#include "AxStringTable.h"
 #include "AxStringView.h"
 
 namespace apex {
@@ -13,6 +17,7 @@ namespace apex {
 	class AxBaseHashString<Hasher, AxHashStringType::HashOnly>
 	{
 	public:
+		using HasherType = Hasher;
 		using HashType = decltype(std::declval<Hasher>()(AxStringView{}));
 
 		constexpr AxBaseHashString() = default;
@@ -29,38 +34,37 @@ namespace apex {
 		HashType m_hash { 0 };
 	};
 
+	/**
+	 * \brief Hash with the string it was computed from.
+	 * \details Strings built at runtime are interned in the AxStringTable, so GetStr() never dangles and every
+	 * AxHashString with the same hash points at the same characters. Compile-time strings (e.g. "..."_hs in a constexpr
+	 * context) keep pointing at the literal. Comparisons only look at the hash; the string table asserts that no two
+	 * interned strings share a hash. Use AxHash to pass names around as 8-byte ids, and AxStringTable::Find to get the
+	 * string back.
+	 */
 	template <typename Hasher>
 	class AxBaseHashString<Hasher, AxHashStringType::HashAndString> : public AxBaseHashString<Hasher, AxHashStringType::HashOnly>
 	{
 		using Base = AxBaseHashString<Hasher, AxHashStringType::HashOnly>;
 	public:
 		constexpr AxBaseHashString() = default;
-		constexpr AxBaseHashString(AxStringView str) : Base(str), m_str(str) {}
+		constexpr AxBaseHashString(AxStringView str) : Base(str), m_str(Intern(str, this->GetHash())) {}
 
 		[[nodiscard]] constexpr AxStringView GetStr() const { return m_str; }
 		
 	private:
-		AxStringView m_str;
-	};
-
-	struct FnvHasher64
-	{
-		static constexpr u64 kValue = 0xcbf29ce484222325;
-		static constexpr u64 kPrime = 0x100000001b3;
-
-		[[nodiscard]] static constexpr u64 Hash(const AxStringView& str, const u64 value = kValue) noexcept
+		static constexpr AxStringView Intern(AxStringView str, typename Base::HashType hash)
 		{
-			return (str.length() == 0) ? value : Hash(str.substr(1), (value ^ u64((u8)str[0])) * kPrime);
+			if (std::is_constant_evaluated())
+				return str;
+			return AxStringTable::Intern(str, hash);
 		}
 
-		[[nodiscard]] constexpr u64 operator()(AxStringView str) const noexcept
-		{
-			return Hash(str);
-		}
+		AxStringView m_str;
 	};
 
-	using AxHashString	= AxBaseHashString<FnvHasher64, AxHashStringType::HashAndString>;
-	using AxHash		= AxBaseHashString<FnvHasher64, AxHashStringType::HashOnly>;
+	using AxHashString	= AxBaseHashString<FastHasher64, AxHashStringType::HashAndString>;
+	using AxHash		= AxBaseHashString<FastHasher64, AxHashStringType::HashOnly>;
 
 }
 
@@ -2,10 +2,14 @@
 #include "AxStringView.h"
 #include "Core/Asserts.h"
 #include "Core/Types.h"
+#include "Core/TypeTraits.h"
 #include "Memory/MemoryManager.h"
 
 namespace apex {
 
+	template <size_t InlineSize>
+	class AxStringBuilder;
+
 	class AxString
 	{
 	public:
@@ -160,6 +164,19 @@ namespace apex {
 			}
 		}
 
+		// Takes ownership of a null-terminated MemoryManager allocation
+		void Adopt(char* str, size_t length, size_t capacity)
+		{
+			reset();
+			m_storage.non_sso.m_isSSO = false;
+			m_storage.non_sso.m_capacity = capacity;
+			m_storage.non_sso.m_length = length;
+			m_storage.non_sso.m_str = str;
+		}
+
+		template <size_t InlineSize>
+		friend class AxStringBuilder;
+
 
 	private:
 		constexpr static size_t kSsoBufSize = 23;
@@ -183,6 +200,10 @@ namespace apex {
 		static_assert(sizeof(m_storage) == 24);
 	};
 
+	// AxString never points into its own small string buffer, data() is recomputed on every access
+	template <>
+	struct is_trivially_relocatable<AxString> : std::true_type {};
+
 
 }
 
@@ -0,0 +1,220 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <fmt/core.h>
+
+#include "Core/Asserts.h"
+#include "Core/Macros.h"
+#include "Core/Types.h"
+#include "Memory/ArenaAllocator.h"
+#include "Memory/MemoryManager.h"
+#include "String/AxString.h"
+#include "String/AxStringView.h"
+
+namespace apex {
+
+	enum class StringBuilderMode
+	{
+		eGrow,     // spill to the heap (or the scratch arena) when the inline buffer is full
+		eTruncate, // never allocate, drop whatever does not fit in the inline buffer
+	};
+
+	/**
+	 * \brief Builds a string by appending into an inline buffer, then into a heap or scratch arena buffer that grows
+	 * geometrically.
+	 * \details The text is always null-terminated, so view() and c_str() can be passed on directly; both are valid until
+	 * the next modification. format() runs fmt straight into the buffer, and push_back makes std::back_inserter work for
+	 * other fmt calls.
+	 * With a scratch arena the buffer is never freed, which suits per-frame strings. In eTruncate mode the builder
+	 * never allocates and keeps at most InlineSize - 1 characters, which suits fixed per-thread buffers such as log
+	 * formatting.
+	 * ToString() hands a heap buffer over to the AxString without copying.
+	 * \tparam InlineSize bytes of inline storage, including the null terminator
+	 */
+	template <size_t InlineSize = 256>
+	class AxStringBuilder
+	{
+		static_assert(InlineSize >= 2, "AxStringBuilder needs room for at least one character");
+
+	public:
+		using value_type = char;
+
+		AxStringBuilder() = default;
+
+		explicit AxStringBuilder(StringBuilderMode mode) : m_mode(mode) {}
+
+		explicit AxStringBuilder(mem::ArenaAllocator* scratch) : m_arena(scratch) {}
+
+		~AxStringBuilder()
+		{
+			FreeHeap();
+		}
+
+		NON_COPYABLE(AxStringBuilder);
+		NON_MOVABLE(AxStringBuilder);
+
+		AxStringBuilder& append(AxStringView str)
+		{
+			const size_t count = Prepare(str.length());
+			::memcpy(m_data + m_size, str.data(), count);
+			return Commit(count);
+		}
+
+		AxStringBuilder& append(const char* str) { return append(AxStringView(str)); }
+
+		AxStringBuilder& append(size_t count, char c)
+		{
+			count = Prepare(count);
+			::memset(m_data + m_size, c, count);
+			return Commit(count);
+		}
+
+		AxStringBuilder& append(char c) { return append(1, c); }
+
+		void push_back(char c) { append(1, c); }
+
+		AxStringBuilder& operator+=(AxStringView str) { return append(str); }
+		AxStringBuilder& operator+=(char c) { return append(1, c); }
+
+		/**
+		 * \brief Appends fmt formatted text. The text is formatted in place; only when it does not fit is the buffer
+		 * grown and the text formatted a second time
+		 */
+		template <typename... Args>
+		AxStringBuilder& format(fmt::format_string<Args...> fmt, Args&&... args)
+		{
+			const auto formatArgs = fmt::make_format_args(args...);
+
+			const size_t available = m_capacity - 1 - m_size;
+			const size_t length = fmt::vformat_to_n(m_data + m_size, available, fmt, formatArgs).size;
+			if (length <= available)
+			{
+				return Commit(length);
+			}
+
+			const size_t count = Prepare(length);
+			if (count == length)
+			{
+				fmt::vformat_to(m_data + m_size, fmt, formatArgs);
+			}
+			return Commit(count);
+		}
+
+		void reserve(size_t length)
+		{
+			if (length + 1 > m_capacity && m_mode == StringBuilderMode::eGrow)
+			{
+				Grow(length + 1);
+			}
+		}
+
+		/**
+		 * \brief Empties the builder but keeps its buffer for reuse
+		 */
+		void clear()
+		{
+			m_size = 0;
+			m_data[0] = '\0';
+			m_truncated = false;
+		}
+
+		/**
+		 * \brief Returns the text as an AxString and empties the builder. A heap buffer is moved into the AxString,
+		 * inline and arena buffers are copied
+		 */
+		[[nodiscard]] AxString ToString()
+		{
+			AxString str;
+			if (IsHeap())
+			{
+				str.Adopt(m_data, m_size, m_capacity);
+				m_data = m_inline;
+				m_capacity = InlineSize;
+			}
+			else
+			{
+				str = AxString(m_data, m_size);
+			}
+			clear();
+			return str;
+		}
+
+		[[nodiscard]] AxStringView view() const { return { m_data, m_size }; }
+		[[nodiscard]] const char* c_str() const { return m_data; }
+		[[nodiscard]] const char* data() const { return m_data; }
+
+		[[nodiscard]] size_t size() const     { return m_size; }
+		[[nodiscard]] size_t capacity() const { return m_capacity - 1; }
+		[[nodiscard]] bool   empty() const    { return m_size == 0; }
+
+		// True if text was dropped in eTruncate mode since the last clear()
+		[[nodiscard]] bool truncated() const  { return m_truncated; }
+
+		operator AxStringView() const { return view(); }
+
+	private:
+		[[nodiscard]] bool IsHeap() const { return m_data != m_inline && !m_arena; }
+
+		// Makes room for count more characters, returns how many of them fit
+		size_t Prepare(size_t count)
+		{
+			const size_t required = m_size + count + 1;
+			if (required <= m_capacity)
+				return count;
+
+			if (m_mode == StringBuilderMode::eTruncate)
+			{
+				m_truncated = true;
+				return m_capacity - 1 - m_size;
+			}
+
+			Grow(std::max(required, m_capacity * 2));
+			return count;
+		}
+
+		AxStringBuilder& Commit(size_t count)
+		{
+			m_size += count;
+			m_data[m_size] = '\0';
+			return *this;
+		}
+
+		void Grow(size_t capacity)
+		{
+			char* data;
+			if (m_arena)
+			{
+				data = static_cast<char*>(m_arena->allocate(capacity, 1));
+			}
+			else
+			{
+				capacity += capacity & 1; // same rounding as AxString, so the buffer can be handed over
+				data = static_cast<char*>(mem::MemoryManager::allocate(capacity));
+			}
+			axAssertFmt(data, "Out of memory in AxStringBuilder");
+
+			::memcpy(data, m_data, m_size + 1);
+			FreeHeap();
+			m_data = data;
+			m_capacity = capacity;
+		}
+
+		void FreeHeap()
+		{
+			if (IsHeap())
+			{
+				mem::MemoryManager::free(m_data);
+			}
+		}
+
+	private:
+		char*                   m_data { m_inline };
+		size_t                  m_size {};
+		size_t                  m_capacity { InlineSize };
+		mem::ArenaAllocator*    m_arena {};
+		StringBuilderMode       m_mode { StringBuilderMode::eGrow };
+		bool                    m_truncated {};
+		char                    m_inline[InlineSize] {};
+	};
+
+}
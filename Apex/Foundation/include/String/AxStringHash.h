@@ -0,0 +1,281 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <type_traits>
+
+#include "Core/Types.h"
+#include "String/AxStringView.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#	include <intrin.h>
+#endif
+
+namespace apex {
+
+	/**
+	 * \brief 64-bit FNV-1a. Simple and constexpr, but hashes one byte at a time.
+	 */
+	struct FnvHasher64
+	{
+		static constexpr u64 kValue = 0xcbf29ce484222325;
+		static constexpr u64 kPrime = 0x100000001b3;
+
+		[[nodiscard]] static constexpr u64 Hash(const AxStringView& str, const u64 value = kValue) noexcept
+		{
+			u64 hash = value;
+			for (const char c : str)
+			{
+				hash = (hash ^ u64((u8)c)) * kPrime;
+			}
+			return hash;
+		}
+
+		[[nodiscard]] constexpr u64 operator()(AxStringView str) const noexcept
+		{
+			return Hash(str);
+		}
+	};
+
+namespace detail {
+
+	// Keys for the long string path, generated with splitmix64
+	consteval std::array<u64, 32> MakeStringHashKeys()
+	{
+		std::array<u64, 32> keys {};
+		u64 state = 0x243f6a8885a308d3;
+		for (u64& key : keys)
+		{
+			u64 z = (state += 0x9e3779b97f4a7c15);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+			key = z ^ (z >> 31);
+		}
+		return keys;
+	}
+
+	inline constexpr std::array<u64, 32> kStringHashKeys = MakeStringHashKeys();
+
+	// Runtime long string path, vectorised where the target supports it. Defined in AxStringHash.cpp
+	u64 FastHashLong(const char* data, size_t length, u64 seed) noexcept;
+
+}
+
+	/**
+	 * \brief Fast 64-bit string hash that gives the same result at compile time and at runtime.
+	 * \details Strings up to kLongThreshold bytes use wyhash-style mixing of 16-byte chunks with 64x64->128-bit multiplies.
+	 * Longer strings are consumed in 64-byte stripes by eight accumulators (as in XXH3); at runtime the stripes are
+	 * processed with AVX2, SSE2 or NEON. The scalar path is constexpr, so "..."_hs literals and strings hashed at runtime
+	 * always match. Assumes a little-endian target.
+	 */
+	struct FastHasher64
+	{
+		static constexpr u64 kSecret[4] = { 0x2d358dccaa6c78a5, 0x8bb84b93962eacc9, 0x4b33a62ed433d4a3, 0x4d5a2da51de1aa47 };
+
+		static constexpr size_t kLongThreshold = 128;
+		static constexpr size_t kStripeSize = 64;
+		static constexpr size_t kStripesPerBlock = 16; // accumulators are scrambled after every block
+		static constexpr size_t kLastStripeKeyOffset = 17;
+		static constexpr size_t kScrambleKeyOffset = 24;
+
+		[[nodiscard]] static constexpr u64 Hash(AxStringView str, u64 seed = 0) noexcept
+		{
+			if (!std::is_constant_evaluated() && str.length() > kLongThreshold)
+			{
+				return detail::FastHashLong(str.data(), str.length(), seed);
+			}
+			return HashScalar(str, seed);
+		}
+
+		/**
+		 * \brief The portable implementation, also used for constant evaluation
+		 */
+		[[nodiscard]] static constexpr u64 HashScalar(AxStringView str, u64 seed = 0) noexcept
+		{
+			const char* p = str.data();
+			const size_t len = str.length();
+			if (len > kLongThreshold)
+			{
+				return HashLong(p, len, seed, [](u64* acc, const char* stripes, size_t count, const u64* keys) constexpr
+				{
+					for (size_t s = 0; s < count; s++)
+					{
+						AccumulateStripe(acc, stripes + s * kStripeSize, keys + s);
+					}
+				});
+			}
+
+			seed ^= Mix(seed ^ kSecret[0], kSecret[1]);
+
+			u64 a = 0, b = 0;
+			if (len <= 16)
+			{
+				if (len >= 4)
+				{
+					const size_t offset = (len >> 3) << 2;
+					a = (Read32(p) << 32) | Read32(p + offset);
+					b = (Read32(p + len - 4) << 32) | Read32(p + len - 4 - offset);
+				}
+				else if (len > 0)
+				{
+					a = (u64(u8(p[0])) << 16) | (u64(u8(p[len >> 1])) << 8) | u64(u8(p[len - 1]));
+				}
+			}
+			else
+			{
+				size_t remaining = len;
+				if (remaining > 48)
+				{
+					u64 seed1 = seed, seed2 = seed;
+					do
+					{
+						seed = Mix(Read64(p) ^ kSecret[1], Read64(p + 8) ^ seed);
+						seed1 = Mix(Read64(p + 16) ^ kSecret[2], Read64(p + 24) ^ seed1);
+						seed2 = Mix(Read64(p + 32) ^ kSecret[3], Read64(p + 40) ^ seed2);
+						p += 48;
+						remaining -= 48;
+					}
+					while (remaining > 48);
+					seed ^= seed1 ^ seed2;
+				}
+				while (remaining > 16)
+				{
+					seed = Mix(Read64(p) ^ kSecret[1], Read64(p + 8) ^ seed);
+					p += 16;
+					remaining -= 16;
+				}
+				// The last 16 bytes, which may overlap the previous chunk
+				a = Read64(p + remaining - 16);
+				b = Read64(p + remaining - 8);
+			}
+
+			a ^= kSecret[1];
+			b ^= seed;
+			Mum(a, b);
+			return Mix(a ^ kSecret[0] ^ len, b ^ kSecret[1]);
+		}
+
+		/**
+		 * \brief Long string path shared by the scalar and SIMD implementations, which only differ in accumulate.
+		 * accumulate(acc, stripes, count, keys) adds count stripes to the accumulators, keying stripe i with keys[i, i + 8)
+		 */
+		template <typename Accumulate>
+		[[nodiscard]] static constexpr u64 HashLong(const char* p, size_t len, u64 seed, Accumulate&& accumulate) noexcept
+		{
+			constexpr auto& keys = detail::kStringHashKeys;
+
+			u64 acc[8];
+			for (size_t j = 0; j < 8; j++)
+			{
+				acc[j] = keys[kScrambleKeyOffset + j] ^ seed;
+			}
+
+			// Every full stripe except the last one, which is hashed with the (possibly overlapping) final stripe
+			const size_t numStripes = (len - 1) / kStripeSize;
+			for (size_t stripe = 0; stripe < numStripes; stripe += kStripesPerBlock)
+			{
+				const size_t count = std::min(kStripesPerBlock, numStripes - stripe);
+				accumulate(acc, p + stripe * kStripeSize, count, keys.data());
+				if (count == kStripesPerBlock)
+				{
+					Scramble(acc);
+				}
+			}
+			accumulate(acc, p + len - kStripeSize, 1, keys.data() + kLastStripeKeyOffset);
+
+			u64 result = len * 0x9e3779b97f4a7c15 ^ seed;
+			for (size_t j = 0; j < 4; j++)
+			{
+				result += Mix(acc[2 * j] ^ kSecret[j], acc[2 * j + 1] ^ keys[j]);
+			}
+			result ^= result >> 37;
+			result *= 0x165667919e3779f9;
+			return result ^ (result >> 32);
+		}
+
+		[[nodiscard]] constexpr u64 operator()(AxStringView str) const noexcept
+		{
+			return Hash(str);
+		}
+
+	private:
+		static constexpr void AccumulateStripe(u64* acc, const char* stripe, const u64* keys) noexcept
+		{
+			for (size_t j = 0; j < 8; j++)
+			{
+				const u64 data = Read64(stripe + j * 8);
+				const u64 keyed = data ^ keys[j];
+				acc[j ^ 1] += data;
+				acc[j] += (keyed & 0xffffffff) * (keyed >> 32);
+			}
+		}
+
+		static constexpr void Scramble(u64* acc) noexcept
+		{
+			for (size_t j = 0; j < 8; j++)
+			{
+				acc[j] ^= acc[j] >> 47;
+				acc[j] ^= detail::kStringHashKeys[kScrambleKeyOffset + j];
+				acc[j] *= 0x9e3779b1;
+			}
+		}
+
+		// 64x64 -> 128-bit multiply, a receives the low half and b the high half
+		static constexpr void Mum(u64& a, u64& b) noexcept
+		{
+			if (!std::is_constant_evaluated())
+			{
+			#if defined(__SIZEOF_INT128__)
+				const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+				a = static_cast<u64>(product);
+				b = static_cast<u64>(product >> 64);
+				return;
+			#elif defined(_MSC_VER) && defined(_M_X64)
+				a = _umul128(a, b, &b);
+				return;
+			#endif
+			}
+
+			const u64 aHi = a >> 32, aLo = a & 0xffffffff;
+			const u64 bHi = b >> 32, bLo = b & 0xffffffff;
+			const u64 hh = aHi * bHi, hl = aHi * bLo, lh = aLo * bHi, ll = aLo * bLo;
+			const u64 mid = (ll >> 32) + (hl & 0xffffffff) + (lh & 0xffffffff);
+			a = (mid << 32) | (ll & 0xffffffff);
+			b = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+		}
+
+		static constexpr u64 Mix(u64 a, u64 b) noexcept
+		{
+			Mum(a, b);
+			return a ^ b;
+		}
+
+		static constexpr u64 Read64(const char* p) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				u64 value = 0;
+				for (size_t i = 0; i < 8; i++)
+				{
+					value |= u64(u8(p[i])) << (i * 8);
+				}
+				return value;
+			}
+			u64 value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+
+		static constexpr u64 Read32(const char* p) noexcept
+		{
+			if (std::is_constant_evaluated())
+			{
+				return u64(u8(p[0])) | (u64(u8(p[1])) << 8) | (u64(u8(p[2])) << 16) | (u64(u8(p[3])) << 24);
+			}
+			u32 value;
+			std::memcpy(&value, p, sizeof(value));
+			return value;
+		}
+	};
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "Core/Types.h"
+#include "String/AxStringView.h"
+
+namespace apex {
+
+	/**
+	 * \brief Global intern table that gives every string a single canonical copy, keyed by its 64-bit hash.
+	 * \details Strings are copied once into an append-only arena and never freed, so the returned views stay valid for
+	 * the lifetime of the program and are null-terminated. Interning and lookups are lock-free: the index is a fixed
+	 * array of bucket lists that only ever grow at the head.
+	 * The arena takes its memory from malloc instead of the MemoryManager, since strings can be interned before the
+	 * MemoryManager is initialized and live past its shutdown.
+	 * Two different strings with the same hash trip an assert. Without asserts the string that was interned first wins.
+	 */
+	class AxStringTable
+	{
+	public:
+		/**
+		 * \brief Returns the canonical copy of str, copying it into the table if it is not present yet
+		 */
+		static AxStringView Intern(AxStringView str);
+
+		/**
+		 * \brief Intern with the AxHashString hash of str computed earlier, e.g. by AxHashString
+		 */
+		static AxStringView Intern(AxStringView str, u64 hash);
+
+		/**
+		 * \brief Reverse lookup of an interned string from its hash, for tools and debug output
+		 * \return the string, or an empty view if no string with this hash was interned
+		 */
+		[[nodiscard]] static AxStringView Find(u64 hash);
+
+		[[nodiscard]] static size_t GetCount();
+
+		// Bytes allocated for the arena, including the unused tail of each block
+		[[nodiscard]] static size_t GetMemoryUsage();
+	};
+
+}
@@ -0,0 +1,287 @@
+#include "Containers/AxBitSet.h"
+
+#include "Core/Platform.h"
+
+#if defined(APEX_ARCH_ARM64)
+#	include <arm_neon.h>
+#endif
+
+namespace apex {
+
+	namespace
+	{
+		enum class BitOp { eAnd, eOr, eAndNot };
+
+		template <BitOp Op>
+		u64 ApplyWord(u64 dst, u64 src)
+		{
+			if constexpr (Op == BitOp::eAnd)         return dst & src;
+			else if constexpr (Op == BitOp::eOr)     return dst | src;
+			else if constexpr (Op == BitOp::eAndNot) return dst & ~src;
+		}
+
+		// dst[i] = dst[i] op src[i] for i in [0, count)
+		template <BitOp Op>
+		void ApplyWords(u64* dst, const u64* src, size_t count)
+		{
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+				const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				__m256i r;
+				if constexpr (Op == BitOp::eAnd)         r = _mm256_and_si256(a, b);
+				else if constexpr (Op == BitOp::eOr)     r = _mm256_or_si256(a, b);
+				else if constexpr (Op == BitOp::eAndNot) r = _mm256_andnot_si256(b, a);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+			}
+		#elif defined(APEX_ARCH_X86)
+			for (; i + 2 <= count; i += 2)
+			{
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+				const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				__m128i r;
+				if constexpr (Op == BitOp::eAnd)         r = _mm_and_si128(a, b);
+				else if constexpr (Op == BitOp::eOr)     r = _mm_or_si128(a, b);
+				else if constexpr (Op == BitOp::eAndNot) r = _mm_andnot_si128(b, a);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+			}
+		#elif defined(APEX_ARCH_ARM64)
+			for (; i + 2 <= count; i += 2)
+			{
+				const uint64x2_t a = vld1q_u64(dst + i);
+				const uint64x2_t b = vld1q_u64(src + i);
+				uint64x2_t r;
+				if constexpr (Op == BitOp::eAnd)         r = vandq_u64(a, b);
+				else if constexpr (Op == BitOp::eOr)     r = vorrq_u64(a, b);
+				else if constexpr (Op == BitOp::eAndNot) r = vbicq_u64(a, b);
+				vst1q_u64(dst + i, r);
+			}
+		#endif
+
+			for (; i < count; i++)
+			{
+				dst[i] = ApplyWord<Op>(dst[i], src[i]);
+			}
+		}
+	}
+
+	void AxBitSet::resize(size_t num_bits)
+	{
+		const size_t numWords = (num_bits + kBitsPerWord - 1) / kBitsPerWord;
+		const size_t numBlocks = (numWords + kWordsPerBlock - 1) / kWordsPerBlock;
+
+		m_words.resize(numWords, u64{ 0 });
+		m_summary.resize(numBlocks, u64{ 0 });
+		m_size = num_bits;
+
+		TrimTail();
+	}
+
+	void AxBitSet::clear()
+	{
+		for (size_t blockIdx = 0; blockIdx < NumBlocks(); blockIdx++)
+		{
+			for (u64 summary = m_summary[blockIdx]; summary != 0; summary &= summary - 1)
+			{
+				m_words[blockIdx * kWordsPerBlock + std::countr_zero(summary)] = 0;
+			}
+			m_summary[blockIdx] = 0;
+		}
+	}
+
+	void AxBitSet::setAll()
+	{
+		std::fill(m_words.begin(), m_words.end(), Constants::u64_MAX);
+		for (size_t blockIdx = 0; blockIdx < NumBlocks(); blockIdx++)
+		{
+			const size_t numWords = BlockWordCount(blockIdx);
+			m_summary[blockIdx] = numWords == kWordsPerBlock ? Constants::u64_MAX : (u64(1) << numWords) - 1;
+		}
+		TrimTail();
+	}
+
+	size_t AxBitSet::count() const
+	{
+		size_t total = 0;
+		for (size_t blockIdx = 0; blockIdx < NumBlocks(); blockIdx++)
+		{
+			for (u64 summary = m_summary[blockIdx]; summary != 0; summary &= summary - 1)
+			{
+				total += std::popcount(m_words[blockIdx * kWordsPerBlock + std::countr_zero(summary)]);
+			}
+		}
+		return total;
+	}
+
+	bool AxBitSet::any() const
+	{
+		for (const u64 summary : m_summary)
+		{
+			if (summary != 0)
+				return true;
+		}
+		return false;
+	}
+
+	size_t AxBitSet::countIntersection(AxBitSet const& other) const
+	{
+		const size_t numBlocks = std::min(NumBlocks(), other.NumBlocks());
+
+		size_t total = 0;
+		for (size_t blockIdx = 0; blockIdx < numBlocks; blockIdx++)
+		{
+			for (u64 summary = m_summary[blockIdx] & other.m_summary[blockIdx]; summary != 0; summary &= summary - 1)
+			{
+				const size_t wordIdx = blockIdx * kWordsPerBlock + std::countr_zero(summary);
+				total += std::popcount(m_words[wordIdx] & other.m_words[wordIdx]);
+			}
+		}
+		return total;
+	}
+
+	bool AxBitSet::intersects(AxBitSet const& other) const
+	{
+		const size_t numBlocks = std::min(NumBlocks(), other.NumBlocks());
+
+		for (size_t blockIdx = 0; blockIdx < numBlocks; blockIdx++)
+		{
+			for (u64 summary = m_summary[blockIdx] & other.m_summary[blockIdx]; summary != 0; summary &= summary - 1)
+			{
+				const size_t wordIdx = blockIdx * kWordsPerBlock + std::countr_zero(summary);
+				if ((m_words[wordIdx] & other.m_words[wordIdx]) != 0)
+					return true;
+			}
+		}
+		return false;
+	}
+
+	AxBitSet& AxBitSet::operator&=(AxBitSet const& other)
+	{
+		for (size_t blockIdx = 0; blockIdx < NumBlocks(); blockIdx++)
+		{
+			const u64 summary = m_summary[blockIdx];
+			if (summary == 0)
+				continue;
+
+			const u64 otherSummary = blockIdx < other.NumBlocks() ? other.m_summary[blockIdx] : 0;
+			if ((summary & otherSummary) == 0)
+			{
+				// Nothing in common, only the words that are set need clearing
+				for (u64 bits = summary; bits != 0; bits &= bits - 1)
+				{
+					m_words[blockIdx * kWordsPerBlock + std::countr_zero(bits)] = 0;
+				}
+				m_summary[blockIdx] = 0;
+				continue;
+			}
+
+			const size_t firstWord = blockIdx * kWordsPerBlock;
+			const size_t numWords = BlockWordCount(blockIdx);
+			const size_t numOtherWords = std::min(numWords, other.BlockWordCount(blockIdx));
+
+			ApplyWords<BitOp::eAnd>(m_words.data() + firstWord, other.m_words.data() + firstWord, numOtherWords);
+			std::fill(m_words.data() + firstWord + numOtherWords, m_words.data() + firstWord + numWords, u64{ 0 });
+			RebuildSummary(blockIdx);
+		}
+		return *this;
+	}
+
+	AxBitSet& AxBitSet::operator|=(AxBitSet const& other)
+	{
+		if (other.m_size > m_size)
+		{
+			resize(other.m_size);
+		}
+
+		for (size_t blockIdx = 0; blockIdx < other.NumBlocks(); blockIdx++)
+		{
+			const u64 otherSummary = other.m_summary[blockIdx];
+			if (otherSummary == 0)
+				continue;
+
+			const size_t firstWord = blockIdx * kWordsPerBlock;
+			ApplyWords<BitOp::eOr>(m_words.data() + firstWord, other.m_words.data() + firstWord, other.BlockWordCount(blockIdx));
+			m_summary[blockIdx] |= otherSummary;
+		}
+		return *this;
+	}
+
+	AxBitSet& AxBitSet::andNot(AxBitSet const& other)
+	{
+		const size_t numBlocks = std::min(NumBlocks(), other.NumBlocks());
+
+		for (size_t blockIdx = 0; blockIdx < numBlocks; blockIdx++)
+		{
+			if ((m_summary[blockIdx] & other.m_summary[blockIdx]) == 0)
+				continue;
+
+			const size_t firstWord = blockIdx * kWordsPerBlock;
+			const size_t numWords = std::min(BlockWordCount(blockIdx), other.BlockWordCount(blockIdx));
+			ApplyWords<BitOp::eAndNot>(m_words.data() + firstWord, other.m_words.data() + firstWord, numWords);
+			RebuildSummary(blockIdx);
+		}
+		return *this;
+	}
+
+	size_t AxBitSet::findNext(size_t bit) const
+	{
+		if (bit >= m_size)
+			return kNpos;
+
+		size_t wordIdx = bit / kBitsPerWord;
+		const u64 word = m_words[wordIdx] & (Constants::u64_MAX << (bit % kBitsPerWord));
+		if (word != 0)
+			return wordIdx * kBitsPerWord + std::countr_zero(word);
+
+		// Continue from the next word through the summary
+		wordIdx++;
+		size_t blockIdx = wordIdx / kWordsPerBlock;
+		if (blockIdx >= NumBlocks())
+			return kNpos;
+
+		u64 summary = m_summary[blockIdx] & (Constants::u64_MAX << (wordIdx % kWordsPerBlock));
+		while (summary == 0)
+		{
+			if (++blockIdx >= NumBlocks())
+				return kNpos;
+			summary = m_summary[blockIdx];
+		}
+
+		wordIdx = blockIdx * kWordsPerBlock + std::countr_zero(summary);
+		return wordIdx * kBitsPerWord + std::countr_zero(m_words[wordIdx]);
+	}
+
+	bool AxBitSet::operator==(AxBitSet const& other) const
+	{
+		return m_size == other.m_size && std::equal(m_words.begin(), m_words.end(), other.m_words.begin());
+	}
+
+	void AxBitSet::RebuildSummary(size_t block_idx)
+	{
+		const u64* words = m_words.data() + block_idx * kWordsPerBlock;
+		const size_t numWords = BlockWordCount(block_idx);
+
+		u64 summary = 0;
+		for (size_t i = 0; i < numWords; i++)
+		{
+			summary |= u64(words[i] != 0) << i;
+		}
+		m_summary[block_idx] = summary;
+	}
+
+	void AxBitSet::TrimTail()
+	{
+		if (m_words.empty())
+			return;
+
+		if (const size_t tailBits = m_size % kBitsPerWord; tailBits != 0)
+		{
+			m_words.back() &= (u64(1) << tailBits) - 1;
+		}
+		RebuildSummary(NumBlocks() - 1);
+	}
+
+}
@@ -0,0 +1,366 @@
+#include "String/AxFileStream.h"
+
+#include "Memory/MemoryManager.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace apex {
+
+namespace detail {
+
+	FileStreamWorker::~FileStreamWorker()
+	{
+		if (m_thread.joinable())
+		{
+			Wait();
+			m_state.store(eExit, std::memory_order_release);
+			m_state.notify_one();
+			m_thread.join();
+		}
+	}
+
+	void FileStreamWorker::StartThread()
+	{
+		axAssert(!m_thread.joinable());
+		m_thread = std::thread([this] { ThreadMain(); });
+	}
+
+	void FileStreamWorker::SubmitRead(const File* file, u64 offset, char* buffer, size_t size)
+	{
+		m_file = const_cast<File*>(file);
+		m_write = false;
+		m_offset = offset;
+		m_buffer = buffer;
+		m_size = size;
+		Submit();
+	}
+
+	void FileStreamWorker::SubmitWrite(File* file, u64 offset, const char* buffer, size_t size)
+	{
+		m_file = file;
+		m_write = true;
+		m_offset = offset;
+		m_buffer = const_cast<char*>(buffer);
+		m_size = size;
+		Submit();
+	}
+
+	size_t FileStreamWorker::Wait()
+	{
+		if (!m_pending)
+			return 0;
+
+		if (m_thread.joinable())
+		{
+			while (m_state.load(std::memory_order_acquire) == eRequested)
+			{
+				m_state.wait(eRequested, std::memory_order_acquire);
+			}
+			m_state.store(eIdle, std::memory_order_relaxed);
+		}
+
+		m_pending = false;
+		return m_transferred;
+	}
+
+	void FileStreamWorker::Submit()
+	{
+		axAssertFmt(!m_pending, "Only one request can be in flight at a time");
+		m_pending = true;
+
+		if (m_thread.joinable())
+		{
+			m_state.store(eRequested, std::memory_order_release);
+			m_state.notify_one();
+		}
+		else
+		{
+			Execute();
+		}
+	}
+
+	void FileStreamWorker::Execute()
+	{
+		m_transferred = m_write
+			? m_file->WriteAt(m_offset, m_buffer, m_size)
+			: m_file->ReadAt(m_offset, m_buffer, m_size);
+	}
+
+	void FileStreamWorker::ThreadMain()
+	{
+		while (true)
+		{
+			u32 state;
+			while ((state = m_state.load(std::memory_order_acquire)) == eIdle || state == eCompleted)
+			{
+				m_state.wait(state, std::memory_order_acquire);
+			}
+
+			if (state == eExit)
+				return;
+
+			Execute();
+
+			m_state.store(eCompleted, std::memory_order_release);
+			m_state.notify_one();
+		}
+	}
+
+}
+
+	AxFileStreamReader::AxFileStreamReader(const File& file, size_t buffer_size, bool prefetch)
+		: m_file(&file), m_bufferSize(buffer_size), m_prefetch(prefetch)
+	{
+		axAssertFmt(file.IsValid() && (file.GetFlags() & FileAccessMode::eRead), "AxFileStreamReader needs a file opened for reading");
+		axAssert(buffer_size > 0);
+
+		m_buffers[0] = static_cast<char*>(mem::MemoryManager::allocate(buffer_size * 2));
+		m_buffers[1] = m_buffers[0] + buffer_size;
+
+		if (m_prefetch)
+		{
+			m_worker.StartThread();
+		}
+	}
+
+	AxFileStreamReader::~AxFileStreamReader()
+	{
+		m_worker.Wait();
+		mem::MemoryManager::free(m_buffers[0]);
+	}
+
+	size_t AxFileStreamReader::Read(void* dst, size_t size)
+	{
+		char* out = static_cast<char*>(dst);
+		size_t total = 0;
+		while (total < size)
+		{
+			if (m_readPos == m_readEnd)
+			{
+				const size_t remaining = size - total;
+				if (!m_prefetch && remaining >= m_bufferSize)
+				{
+					// Large reads go straight to the destination instead of through the buffer
+					m_bufferOffset += m_readEnd;
+					m_readPos = m_readEnd = 0;
+					return total + ReadDirect(out + total, remaining);
+				}
+
+				if (!Refill())
+					break;
+			}
+
+			const size_t count = std::min(size - total, m_readEnd - m_readPos);
+			::memcpy(out + total, m_buffers[m_current] + m_readPos, count);
+			m_readPos += count;
+			total += count;
+		}
+		return total;
+	}
+
+	size_t AxFileStreamReader::ReadDirect(char* dst, size_t size)
+	{
+		// File::ReadAt takes a 32 bit count on Win32, so split reads of 4 GiB and more
+		size_t total = 0;
+		while (total < size)
+		{
+			const size_t chunk = std::min<size_t>(size - total, std::numeric_limits<u32>::max());
+			const size_t count = m_file->ReadAt(m_bufferOffset, dst + total, chunk);
+			m_bufferOffset += count;
+			total += count;
+
+			if (count < chunk)
+				break;
+		}
+		return total;
+	}
+
+	bool AxFileStreamReader::ReadVarU64(u64& value)
+	{
+		value = 0;
+		for (u32 shift = 0; shift < 64; shift += 7)
+		{
+			u8 byte;
+			if (!ReadObject(byte))
+				return false;
+
+			value |= u64(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return true;
+		}
+		return axVerifyFmt(false, "Malformed varint at offset {}", Tell());
+	}
+
+	bool AxFileStreamReader::ReadVarS64(s64& value)
+	{
+		u64 zigzag;
+		if (!ReadVarU64(zigzag))
+			return false;
+
+		value = static_cast<s64>(zigzag >> 1) ^ -static_cast<s64>(zigzag & 1);
+		return true;
+	}
+
+	void AxFileStreamReader::AlignTo(size_t alignment)
+	{
+		axAssert(alignment > 0);
+		Seek((Tell() + alignment - 1) / alignment * alignment);
+	}
+
+	void AxFileStreamReader::Seek(u64 offset)
+	{
+		if (offset >= m_bufferOffset && offset <= m_bufferOffset + m_readEnd)
+		{
+			m_readPos = static_cast<size_t>(offset - m_bufferOffset);
+			return;
+		}
+
+		// The buffered data is dropped, but a pending prefetch is kept in case it starts at the new position
+		m_bufferOffset = offset;
+		m_readPos = m_readEnd = 0;
+	}
+
+	bool AxFileStreamReader::Refill()
+	{
+		const u64 offset = m_bufferOffset + m_readEnd;
+
+		size_t count;
+		if (m_worker.IsPending() && m_worker.GetPendingOffset() == offset)
+		{
+			count = m_worker.Wait();
+			m_current ^= 1;
+		}
+		else
+		{
+			m_worker.Wait();
+			count = m_file->ReadAt(offset, m_buffers[m_current], m_bufferSize);
+		}
+
+		m_bufferOffset = offset;
+		m_readPos = 0;
+		m_readEnd = count;
+
+		if (m_prefetch && count == m_bufferSize)
+		{
+			Prefetch();
+		}
+		return count > 0;
+	}
+
+	void AxFileStreamReader::Prefetch()
+	{
+		m_worker.SubmitRead(m_file, m_bufferOffset + m_readEnd, m_buffers[m_current ^ 1], m_bufferSize);
+	}
+
+	AxFileStreamWriter::AxFileStreamWriter(File& file, size_t buffer_size, bool background)
+		: m_file(&file), m_bufferSize(buffer_size)
+	{
+		axAssertFmt(file.IsValid() && (file.GetFlags() & FileAccessMode::eWrite), "AxFileStreamWriter needs a file opened for writing");
+		axAssert(buffer_size > 0);
+
+		m_buffers[0] = static_cast<char*>(mem::MemoryManager::allocate(buffer_size * 2));
+		m_buffers[1] = m_buffers[0] + buffer_size;
+
+		if (background)
+		{
+			m_worker.StartThread();
+		}
+	}
+
+	AxFileStreamWriter::~AxFileStreamWriter()
+	{
+		Flush();
+		mem::MemoryManager::free(m_buffers[0]);
+	}
+
+	void AxFileStreamWriter::Write(const void* src, size_t size)
+	{
+		const char* in = static_cast<const char*>(src);
+		while (size > 0)
+		{
+			const size_t count = std::min(size, m_bufferSize - m_writePos);
+			::memcpy(m_buffers[m_current] + m_writePos, in, count);
+			m_writePos += count;
+			in += count;
+			size -= count;
+
+			if (m_writePos == m_bufferSize)
+			{
+				SubmitBuffer();
+			}
+		}
+	}
+
+	void AxFileStreamWriter::WriteVarU64(u64 value)
+	{
+		u8 bytes[10];
+		size_t count = 0;
+		do
+		{
+			bytes[count] = static_cast<u8>(value & 0x7f);
+			value >>= 7;
+			bytes[count++] |= value ? 0x80 : 0;
+		}
+		while (value);
+		Write(bytes, count);
+	}
+
+	void AxFileStreamWriter::WriteVarS64(s64 value)
+	{
+		WriteVarU64((static_cast<u64>(value) << 1) ^ static_cast<u64>(value >> 63));
+	}
+
+	void AxFileStreamWriter::AlignTo(size_t alignment, u8 fill)
+	{
+		axAssert(alignment > 0);
+		size_t padding = (alignment - Tell() % alignment) % alignment;
+
+		u8 bytes[64];
+		::memset(bytes, fill, sizeof(bytes));
+		while (padding > 0)
+		{
+			const size_t count = std::min(padding, sizeof(bytes));
+			Write(bytes, count);
+			padding -= count;
+		}
+	}
+
+	void AxFileStreamWriter::Seek(u64 offset)
+	{
+		Flush();
+		m_bufferOffset = offset;
+	}
+
+	void AxFileStreamWriter::Flush()
+	{
+		SubmitBuffer();
+		CompleteWrite();
+	}
+
+	void AxFileStreamWriter::SubmitBuffer()
+	{
+		if (m_writePos == 0)
+			return;
+
+		// The other buffer becomes current, so its write has to be finished first
+		CompleteWrite();
+		m_worker.SubmitWrite(m_file, m_bufferOffset, m_buffers[m_current], m_writePos);
+
+		m_bufferOffset += m_writePos;
+		m_writePos = 0;
+		m_current ^= 1;
+	}
+
+	void AxFileStreamWriter::CompleteWrite()
+	{
+		if (!m_worker.IsPending())
+			return;
+
+		const size_t requested = m_worker.GetPendingSize();
+		const size_t written = m_worker.Wait();
+		m_bytesWritten += written;
+		m_failed |= written != requested;
+	}
+
+}
@@ -0,0 +1,112 @@
+#include "String/AxStringHash.h"
+
+#include "Core/Platform.h"
+
+#if defined(APEX_ARCH_ARM64)
+#	include <arm_neon.h>
+#endif
+
+namespace apex::detail {
+
+	namespace
+	{
+		// Each function adds count 64-byte stripes to the eight accumulators exactly like FastHasher64::AccumulateStripe:
+		// acc[j] += lo32(data[j] ^ key[j]) * hi32(data[j] ^ key[j]) and acc[j ^ 1] += data[j]
+
+		#if defined(__AVX2__)
+
+		void AccumulateStripes(u64* acc, const char* stripes, size_t count, const u64* keys)
+		{
+			__m256i acc0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc));
+			__m256i acc1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc + 4));
+
+			for (size_t s = 0; s < count; s++)
+			{
+				const char* stripe = stripes + s * FastHasher64::kStripeSize;
+				const __m256i data0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe));
+				const __m256i data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripe + 32));
+				const __m256i keyed0 = _mm256_xor_si256(data0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + s)));
+				const __m256i keyed1 = _mm256_xor_si256(data1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + s + 4)));
+
+				// _mm256_mul_epu32 multiplies the low 32 bits of each 64-bit lane
+				const __m256i product0 = _mm256_mul_epu32(keyed0, _mm256_srli_epi64(keyed0, 32));
+				const __m256i product1 = _mm256_mul_epu32(keyed1, _mm256_srli_epi64(keyed1, 32));
+
+				// Swapping the 64-bit halves of each 128-bit lane gives data[j ^ 1]
+				acc0 = _mm256_add_epi64(acc0, _mm256_add_epi64(product0, _mm256_shuffle_epi32(data0, _MM_SHUFFLE(1, 0, 3, 2))));
+				acc1 = _mm256_add_epi64(acc1, _mm256_add_epi64(product1, _mm256_shuffle_epi32(data1, _MM_SHUFFLE(1, 0, 3, 2))));
+			}
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), acc0);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + 4), acc1);
+		}
+
+		#elif defined(APEX_ARCH_X86)
+
+		void AccumulateStripes(u64* acc, const char* stripes, size_t count, const u64* keys)
+		{
+			__m128i accs[4];
+			for (size_t i = 0; i < 4; i++)
+			{
+				accs[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + 2 * i));
+			}
+
+			for (size_t s = 0; s < count; s++)
+			{
+				const char* stripe = stripes + s * FastHasher64::kStripeSize;
+				for (size_t i = 0; i < 4; i++)
+				{
+					const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripe + 16 * i));
+					const __m128i keyed = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + s + 2 * i)));
+					const __m128i product = _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+					accs[i] = _mm_add_epi64(accs[i], _mm_add_epi64(product, _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2))));
+				}
+			}
+
+			for (size_t i = 0; i < 4; i++)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 2 * i), accs[i]);
+			}
+		}
+
+		#elif defined(APEX_ARCH_ARM64)
+
+		void AccumulateStripes(u64* acc, const char* stripes, size_t count, const u64* keys)
+		{
+			uint64x2_t accs[4];
+			for (size_t i = 0; i < 4; i++)
+			{
+				accs[i] = vld1q_u64(acc + 2 * i);
+			}
+
+			for (size_t s = 0; s < count; s++)
+			{
+				const char* stripe = stripes + s * FastHasher64::kStripeSize;
+				for (size_t i = 0; i < 4; i++)
+				{
+					const uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(reinterpret_cast<const u8*>(stripe + 16 * i)));
+					const uint64x2_t keyed = veorq_u64(data, vld1q_u64(keys + s + 2 * i));
+					const uint64x2_t product = vmull_u32(vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+					accs[i] = vaddq_u64(accs[i], vaddq_u64(product, vextq_u64(data, data, 1)));
+				}
+			}
+
+			for (size_t i = 0; i < 4; i++)
+			{
+				vst1q_u64(acc + 2 * i, accs[i]);
+			}
+		}
+
+		#endif
+	}
+
+	u64 FastHashLong(const char* data, size_t length, u64 seed) noexcept
+	{
+	#if defined(__AVX2__) || defined(APEX_ARCH_X86) || defined(APEX_ARCH_ARM64)
+		return FastHasher64::HashLong(data, length, seed, AccumulateStripes);
+	#else
+		return FastHasher64::HashScalar(AxStringView(data, length), seed);
+	#endif
+	}
+
+}
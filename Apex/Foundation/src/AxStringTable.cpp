@@ -0,0 +1,187 @@
+#include "String/AxStringTable.h"
+
+#include "Core/Asserts.h"
+#include "String/AxHashString.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+namespace apex {
+
+	namespace
+	{
+		constexpr size_t kNumBuckets = 1 << 14;
+		constexpr size_t kBlockSize = 64 * 1024;
+		constexpr size_t kMaxSmallAllocation = kBlockSize / 4;
+
+		struct Entry
+		{
+			Entry* next;
+			u64    hash;
+			u32    length;
+
+			const char* str() const { return reinterpret_cast<const char*>(this + 1); }
+			AxStringView view() const { return { str(), length }; }
+		};
+
+		struct Block
+		{
+			Block*              next;
+			std::atomic<size_t> used;
+			size_t              capacity;
+
+			char* data() { return reinterpret_cast<char*>(this + 1); }
+		};
+
+		static_assert(sizeof(Entry) % alignof(Entry) == 0 && sizeof(Block) % alignof(Entry) == 0);
+
+		// Zero initialized before any dynamic initialization, so strings can be interned from static constructors
+		struct StringTable
+		{
+			std::atomic<Entry*> buckets[kNumBuckets];
+			std::atomic<Block*> current;
+			std::atomic<Block*> blocks; // every block, for GetMemoryUsage
+			std::atomic<size_t> count;
+			std::atomic<size_t> memory;
+		};
+
+		constinit StringTable s_table {};
+
+		Block* NewBlock(size_t capacity)
+		{
+			Block* block = static_cast<Block*>(std::malloc(sizeof(Block) + capacity));
+			axAssertFmt(block, "Out of memory for the string table");
+			block->next = nullptr;
+			block->used.store(0, std::memory_order_relaxed);
+			block->capacity = capacity;
+			return block;
+		}
+
+		void LinkBlock(Block* block)
+		{
+			Block* head = s_table.blocks.load(std::memory_order_relaxed);
+			do
+			{
+				block->next = head;
+			}
+			while (!s_table.blocks.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+
+			s_table.memory.fetch_add(sizeof(Block) + block->capacity, std::memory_order_relaxed);
+		}
+
+		// Lock-free bump allocation from the current block. Threads that find the block full race to replace it,
+		// the losers free their block and retry in the winner's
+		void* Allocate(size_t size)
+		{
+			size = (size + alignof(Entry) - 1) & ~(alignof(Entry) - 1);
+
+			if (size > kMaxSmallAllocation)
+			{
+				Block* block = NewBlock(size);
+				block->used.store(size, std::memory_order_relaxed);
+				LinkBlock(block);
+				return block->data();
+			}
+
+			for (;;)
+			{
+				Block* block = s_table.current.load(std::memory_order_acquire);
+				if (block)
+				{
+					const size_t offset = block->used.fetch_add(size, std::memory_order_relaxed);
+					if (offset + size <= block->capacity)
+						return block->data() + offset;
+				}
+
+				Block* fresh = NewBlock(kBlockSize);
+				fresh->used.store(size, std::memory_order_relaxed);
+				if (s_table.current.compare_exchange_strong(block, fresh, std::memory_order_acq_rel))
+				{
+					LinkBlock(fresh);
+					return fresh->data();
+				}
+				std::free(fresh);
+			}
+		}
+
+		// Searches the entries from first up to (not including) last
+		Entry* FindInChain(Entry* first, Entry* last, AxStringView str, u64 hash)
+		{
+			for (Entry* entry = first; entry != last; entry = entry->next)
+			{
+				if (entry->hash == hash)
+				{
+					axAssertFmt(entry->view() == str, "String hash collision between '{}' and '{}'", entry->view(), str);
+					return entry;
+				}
+			}
+			return nullptr;
+		}
+
+		std::atomic<Entry*>& BucketFor(u64 hash)
+		{
+			// Both FastHasher64 paths end in a multiply based finalizer, so the low bits alone index well
+			return s_table.buckets[hash & (kNumBuckets - 1)];
+		}
+	}
+
+	AxStringView AxStringTable::Intern(AxStringView str)
+	{
+		return Intern(str, AxHashString::HasherType::Hash(str));
+	}
+
+	AxStringView AxStringTable::Intern(AxStringView str, u64 hash)
+	{
+		if (str.empty())
+			return {};
+
+		std::atomic<Entry*>& bucket = BucketFor(hash);
+		Entry* head = bucket.load(std::memory_order_acquire);
+		if (Entry* existing = FindInChain(head, nullptr, str, hash))
+			return existing->view();
+
+		axAssertFmt(str.length() <= Constants::u32_MAX, "String is too long to intern");
+
+		Entry* entry = static_cast<Entry*>(Allocate(sizeof(Entry) + str.length() + 1));
+		entry->hash = hash;
+		entry->length = static_cast<u32>(str.length());
+		char* chars = reinterpret_cast<char*>(entry + 1);
+		std::memcpy(chars, str.data(), str.length());
+		chars[str.length()] = '\0';
+
+		entry->next = head;
+		while (!bucket.compare_exchange_weak(entry->next, entry, std::memory_order_release, std::memory_order_acquire))
+		{
+			// Another thread pushed to the bucket first. If it interned the same string, use that copy and leave ours
+			// unreachable in the arena
+			if (Entry* existing = FindInChain(entry->next, head, str, hash))
+				return existing->view();
+			head = entry->next;
+		}
+
+		s_table.count.fetch_add(1, std::memory_order_relaxed);
+		return entry->view();
+	}
+
+	AxStringView AxStringTable::Find(u64 hash)
+	{
+		for (Entry* entry = BucketFor(hash).load(std::memory_order_acquire); entry; entry = entry->next)
+		{
+			if (entry->hash == hash)
+				return entry->view();
+		}
+		return {};
+	}
+
+	size_t AxStringTable::GetCount()
+	{
+		return s_table.count.load(std::memory_order_relaxed);
+	}
+
+	size_t AxStringTable::GetMemoryUsage()
+	{
+		return s_table.memory.load(std::memory_order_relaxed);
+	}
+
+}
@@ -0,0 +1,608 @@
+#include "Math/BatchTransform.h"
+
+#include "Core/Asserts.h"
+#include "Core/CpuInfo.h"
+#include "Core/Platform.h"
+
+#if defined(APEX_ARCH_ARM64)
+#	include <arm_neon.h>
+#endif
+
+namespace apex {
+namespace math {
+
+	namespace
+	{
+		using TransformVector3Fn = void (*)(Matrix4x4 const& m, const Vector3* in, Vector3* out, size_t count);
+		using TransformColumnsFn = void (*)(Matrix4x4 const& m, const f32* const in[3], f32* const out[3], size_t count);
+		using TransformVector4Fn = void (*)(Matrix4x4 const& m, const Vector4* in, Vector4* out, size_t count);
+		// lhs advances by lhsStride matrices per element, 0 multiplies every rhs by the same matrix
+		using MultiplyFn = void (*)(const Matrix4x4* lhs, size_t lhsStride, const Matrix4x4* rhs, Matrix4x4* out, size_t count);
+		using WorldFromLocalFn = void (*)(const Matrix4x4* local, const u32* parents, Matrix4x4* world, size_t count);
+
+		struct Kernels
+		{
+			TransformVector3Fn transformPoints;
+			TransformVector3Fn transformDirections;
+			TransformColumnsFn transformPointColumns;
+			TransformVector4Fn transformVectors;
+			MultiplyFn         multiply;
+			WorldFromLocalFn   worldFromLocal;
+		};
+
+		// Portable kernels, also used for the tails of the vectorised ones
+
+		template <bool IsPoint>
+		void TransformVector3Generic(Matrix4x4 const& m, const Vector3* in, Vector3* out, size_t count)
+		{
+			const Vector4 c0 = m[0], c1 = m[1], c2 = m[2], c3 = IsPoint ? m[3] : Vector4 {};
+			for (size_t i = 0; i < count; i++)
+			{
+				const f32 x = in[i].x, y = in[i].y, z = in[i].z;
+				out[i].x = c0.x * x + c1.x * y + c2.x * z + c3.x;
+				out[i].y = c0.y * x + c1.y * y + c2.y * z + c3.y;
+				out[i].z = c0.z * x + c1.z * y + c2.z * z + c3.z;
+			}
+		}
+
+		void TransformPointColumnsGeneric(Matrix4x4 const& m, const f32* const in[3], f32* const out[3], size_t count)
+		{
+			const Vector4 c0 = m[0], c1 = m[1], c2 = m[2], c3 = m[3];
+			for (size_t i = 0; i < count; i++)
+			{
+				const f32 x = in[0][i], y = in[1][i], z = in[2][i];
+				out[0][i] = c0.x * x + c1.x * y + c2.x * z + c3.x;
+				out[1][i] = c0.y * x + c1.y * y + c2.y * z + c3.y;
+				out[2][i] = c0.z * x + c1.z * y + c2.z * z + c3.z;
+			}
+		}
+
+		void TransformVector4Generic(Matrix4x4 const& m, const Vector4* in, Vector4* out, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				out[i] = m * in[i];
+			}
+		}
+
+		void MultiplyGeneric(const Matrix4x4* lhs, size_t lhsStride, const Matrix4x4* rhs, Matrix4x4* out, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				out[i] = lhs[i * lhsStride] * rhs[i];
+			}
+		}
+
+		void WorldFromLocalGeneric(const Matrix4x4* local, const u32* parents, Matrix4x4* world, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				world[i] = parents[i] == kRootParent ? local[i] : world[parents[i]] * local[i];
+			}
+		}
+
+	#if defined(APEX_ARCH_X86)
+
+		/**************************************************************
+		 * AVX2 : 8 Vector3 per iteration through a 3x8 transpose, 2 Vector4 per register
+		 *************************************************************/
+
+		// Eight xyz triples (24 floats) to x, y and z registers. The lanes come out permuted, which is harmless since the
+		// inverse below undoes the same permutation
+		APEX_TARGET_AVX2 inline void LoadXYZ8(const f32* p, __m256& x, __m256& y, __m256& z)
+		{
+			const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 0)), _mm_loadu_ps(p + 12), 1);
+			const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 4)), _mm_loadu_ps(p + 16), 1);
+			const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + 8)), _mm_loadu_ps(p + 20), 1);
+
+			const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+			const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+			x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+			y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+			z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+		}
+
+		APEX_TARGET_AVX2 inline void StoreXYZ8(f32* p, __m256 x, __m256 y, __m256 z)
+		{
+			const __m256 rxy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 ryz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+			const __m256 rzx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+			const __m256 r03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+			const __m256 r14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+			const __m256 r25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+			_mm_storeu_ps(p + 0, _mm256_castps256_ps128(r03));
+			_mm_storeu_ps(p + 4, _mm256_castps256_ps128(r14));
+			_mm_storeu_ps(p + 8, _mm256_castps256_ps128(r25));
+			_mm_storeu_ps(p + 12, _mm256_extractf128_ps(r03, 1));
+			_mm_storeu_ps(p + 16, _mm256_extractf128_ps(r14, 1));
+			_mm_storeu_ps(p + 20, _mm256_extractf128_ps(r25, 1));
+		}
+
+		// The rows of the upper 3x4 block of m, each element broadcast
+		struct Rows8
+		{
+			__m256 m[3][4];
+
+			APEX_TARGET_AVX2 Rows8(Matrix4x4 const& matrix, bool is_point)
+			{
+				for (size_t r = 0; r < 3; r++)
+				{
+					for (size_t c = 0; c < 4; c++)
+					{
+						m[r][c] = _mm256_set1_ps(c < 3 || is_point ? matrix[c][r] : 0.f);
+					}
+				}
+			}
+
+			APEX_TARGET_AVX2 __m256 Row(size_t r, __m256 x, __m256 y, __m256 z) const
+			{
+				return _mm256_fmadd_ps(m[r][0], x, _mm256_fmadd_ps(m[r][1], y, _mm256_fmadd_ps(m[r][2], z, m[r][3])));
+			}
+		};
+
+		template <bool IsPoint>
+		APEX_TARGET_AVX2 void TransformVector3AVX2(Matrix4x4 const& m, const Vector3* in, Vector3* out, size_t count)
+		{
+			const Rows8 rows { m, IsPoint };
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x, y, z;
+				LoadXYZ8(in[i].m_values, x, y, z);
+				StoreXYZ8(out[i].m_values, rows.Row(0, x, y, z), rows.Row(1, x, y, z), rows.Row(2, x, y, z));
+			}
+			TransformVector3Generic<IsPoint>(m, in + i, out + i, count - i);
+		}
+
+		APEX_TARGET_AVX2 void TransformPointColumnsAVX2(Matrix4x4 const& m, const f32* const in[3], f32* const out[3], size_t count)
+		{
+			const Rows8 rows { m, true };
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 x = _mm256_loadu_ps(in[0] + i);
+				const __m256 y = _mm256_loadu_ps(in[1] + i);
+				const __m256 z = _mm256_loadu_ps(in[2] + i);
+				const __m256 rx = rows.Row(0, x, y, z);
+				const __m256 ry = rows.Row(1, x, y, z);
+				const __m256 rz = rows.Row(2, x, y, z);
+				_mm256_storeu_ps(out[0] + i, rx);
+				_mm256_storeu_ps(out[1] + i, ry);
+				_mm256_storeu_ps(out[2] + i, rz);
+			}
+
+			const f32* const inTail[3] = { in[0] + i, in[1] + i, in[2] + i };
+			f32* const outTail[3] = { out[0] + i, out[1] + i, out[2] + i };
+			TransformPointColumnsGeneric(m, inTail, outTail, count - i);
+		}
+
+		// The columns of m, each repeated in both 128-bit lanes
+		struct Columns8
+		{
+			__m256 c[4];
+
+			APEX_TARGET_AVX2 explicit Columns8(Matrix4x4 const& matrix)
+			{
+				for (size_t i = 0; i < 4; i++)
+				{
+					c[i] = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.m_columns[i].m_values));
+				}
+			}
+
+			// Multiplies two Vector4 (one per lane)
+			APEX_TARGET_AVX2 __m256 Transform(__m256 v) const
+			{
+				__m256 res = _mm256_mul_ps(c[0], _mm256_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+				res = _mm256_fmadd_ps(c[1], _mm256_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), res);
+				res = _mm256_fmadd_ps(c[2], _mm256_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), res);
+				return _mm256_fmadd_ps(c[3], _mm256_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), res);
+			}
+		};
+
+		APEX_TARGET_AVX2 void TransformVector4AVX2(Matrix4x4 const& m, const Vector4* in, Vector4* out, size_t count)
+		{
+			const Columns8 columns { m };
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m256 v0 = _mm256_loadu_ps(in[i].m_values);
+				const __m256 v1 = _mm256_loadu_ps(in[i + 2].m_values);
+				_mm256_storeu_ps(out[i].m_values, columns.Transform(v0));
+				_mm256_storeu_ps(out[i + 2].m_values, columns.Transform(v1));
+			}
+			TransformVector4Generic(m, in + i, out + i, count - i);
+		}
+
+		APEX_TARGET_AVX2 inline void MultiplyAVX2(Matrix4x4 const& lhs, Matrix4x4 const& rhs, Matrix4x4& out)
+		{
+			const Columns8 columns { lhs };
+			const __m256 r01 = _mm256_loadu_ps(rhs.m_columns[0].m_values);
+			const __m256 r23 = _mm256_loadu_ps(rhs.m_columns[2].m_values);
+			_mm256_storeu_ps(out.m_columns[0].m_values, columns.Transform(r01));
+			_mm256_storeu_ps(out.m_columns[2].m_values, columns.Transform(r23));
+		}
+
+		APEX_TARGET_AVX2 void MultiplyKernelAVX2(const Matrix4x4* lhs, size_t lhsStride, const Matrix4x4* rhs, Matrix4x4* out, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				MultiplyAVX2(lhs[i * lhsStride], rhs[i], out[i]);
+			}
+		}
+
+		APEX_TARGET_AVX2 void WorldFromLocalAVX2(const Matrix4x4* local, const u32* parents, Matrix4x4* world, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				if (parents[i] == kRootParent)
+					world[i] = local[i];
+				else
+					MultiplyAVX2(world[parents[i]], local[i], world[i]);
+			}
+		}
+
+		/**************************************************************
+		 * AVX-512 : 16 Vector3 per iteration through two-step permutes, 4 Vector4 per register
+		 *************************************************************/
+
+		struct PermuteIndices
+		{
+			alignas(64) s32 first[3][16];  // gathers from the first two registers
+			alignas(64) s32 second[3][16]; // completes with the third register
+		};
+
+		// Indices that split 16 xyz triples held in three registers into x, y and z
+		constexpr PermuteIndices MakeDeinterleaveIndices()
+		{
+			PermuteIndices idx {};
+			for (s32 comp = 0; comp < 3; comp++)
+			{
+				for (s32 k = 0; k < 16; k++)
+				{
+					const s32 g = 3 * k + comp;
+					idx.first[comp][k] = g < 32 ? g : 0;
+					idx.second[comp][k] = g < 32 ? k : 16 + (g - 32);
+				}
+			}
+			return idx;
+		}
+
+		// Indices that merge x, y and z back into three registers of triples. first combines x and y, second adds z
+		constexpr PermuteIndices MakeInterleaveIndices()
+		{
+			PermuteIndices idx {};
+			for (s32 block = 0; block < 3; block++)
+			{
+				for (s32 l = 0; l < 16; l++)
+				{
+					const s32 j = 16 * block + l;
+					const s32 comp = j % 3, k = j / 3;
+					idx.first[block][l] = comp == 0 ? k : comp == 1 ? 16 + k : 0;
+					idx.second[block][l] = comp == 2 ? 16 + k : l;
+				}
+			}
+			return idx;
+		}
+
+		constexpr PermuteIndices kDeinterleave = MakeDeinterleaveIndices();
+		constexpr PermuteIndices kInterleave = MakeInterleaveIndices();
+
+		APEX_TARGET_AVX512 inline __m512i LoadIndices(const s32* idx)
+		{
+			return _mm512_load_si512(idx);
+		}
+
+		template <bool IsPoint>
+		APEX_TARGET_AVX512 void TransformVector3AVX512(Matrix4x4 const& m, const Vector3* in, Vector3* out, size_t count)
+		{
+			__m512 rows[3][4];
+			for (size_t r = 0; r < 3; r++)
+			{
+				for (size_t c = 0; c < 4; c++)
+				{
+					rows[r][c] = _mm512_set1_ps(c < 3 || IsPoint ? m[c][r] : 0.f);
+				}
+			}
+
+			__m512i deinterleave[2][3], interleave[2][3];
+			for (size_t i = 0; i < 3; i++)
+			{
+				deinterleave[0][i] = LoadIndices(kDeinterleave.first[i]);
+				deinterleave[1][i] = LoadIndices(kDeinterleave.second[i]);
+				interleave[0][i] = LoadIndices(kInterleave.first[i]);
+				interleave[1][i] = LoadIndices(kInterleave.second[i]);
+			}
+
+			size_t i = 0;
+			for (; i + 16 <= count; i += 16)
+			{
+				const f32* src = in[i].m_values;
+				const __m512 a = _mm512_loadu_ps(src);
+				const __m512 b = _mm512_loadu_ps(src + 16);
+				const __m512 c = _mm512_loadu_ps(src + 32);
+
+				__m512 xyz[3];
+				for (size_t comp = 0; comp < 3; comp++)
+				{
+					xyz[comp] = _mm512_permutex2var_ps(_mm512_permutex2var_ps(a, deinterleave[0][comp], b), deinterleave[1][comp], c);
+				}
+
+				__m512 res[3];
+				for (size_t r = 0; r < 3; r++)
+				{
+					res[r] = _mm512_fmadd_ps(rows[r][0], xyz[0], _mm512_fmadd_ps(rows[r][1], xyz[1], _mm512_fmadd_ps(rows[r][2], xyz[2], rows[r][3])));
+				}
+
+				f32* dst = out[i].m_values;
+				for (size_t block = 0; block < 3; block++)
+				{
+					const __m512 xy = _mm512_permutex2var_ps(res[0], interleave[0][block], res[1]);
+					_mm512_storeu_ps(dst + 16 * block, _mm512_permutex2var_ps(xy, interleave[1][block], res[2]));
+				}
+			}
+			TransformVector3Generic<IsPoint>(m, in + i, out + i, count - i);
+		}
+
+		APEX_TARGET_AVX512 void TransformPointColumnsAVX512(Matrix4x4 const& m, const f32* const in[3], f32* const out[3], size_t count)
+		{
+			__m512 rows[3][4];
+			for (size_t r = 0; r < 3; r++)
+			{
+				for (size_t c = 0; c < 4; c++)
+				{
+					rows[r][c] = _mm512_set1_ps(m[c][r]);
+				}
+			}
+
+			for (size_t i = 0; i < count; i += 16)
+			{
+				// The tail is handled with masked loads and stores
+				const __mmask16 mask = count - i >= 16 ? __mmask16(0xffff) : __mmask16((1u << (count - i)) - 1);
+				const __m512 x = _mm512_maskz_loadu_ps(mask, in[0] + i);
+				const __m512 y = _mm512_maskz_loadu_ps(mask, in[1] + i);
+				const __m512 z = _mm512_maskz_loadu_ps(mask, in[2] + i);
+				for (size_t r = 0; r < 3; r++)
+				{
+					const __m512 res = _mm512_fmadd_ps(rows[r][0], x, _mm512_fmadd_ps(rows[r][1], y, _mm512_fmadd_ps(rows[r][2], z, rows[r][3])));
+					_mm512_mask_storeu_ps(out[r] + i, mask, res);
+				}
+			}
+		}
+
+		// The columns of m, each repeated in all four 128-bit lanes
+		struct Columns16
+		{
+			__m512 c[4];
+
+			APEX_TARGET_AVX512 explicit Columns16(Matrix4x4 const& matrix)
+			{
+				for (size_t i = 0; i < 4; i++)
+				{
+					c[i] = _mm512_broadcast_f32x4(_mm_loadu_ps(matrix.m_columns[i].m_values));
+				}
+			}
+
+			// Multiplies four Vector4 (one per lane)
+			APEX_TARGET_AVX512 __m512 Transform(__m512 v) const
+			{
+				__m512 res = _mm512_mul_ps(c[0], _mm512_permute_ps(v, _MM_SHUFFLE(0, 0, 0, 0)));
+				res = _mm512_fmadd_ps(c[1], _mm512_permute_ps(v, _MM_SHUFFLE(1, 1, 1, 1)), res);
+				res = _mm512_fmadd_ps(c[2], _mm512_permute_ps(v, _MM_SHUFFLE(2, 2, 2, 2)), res);
+				return _mm512_fmadd_ps(c[3], _mm512_permute_ps(v, _MM_SHUFFLE(3, 3, 3, 3)), res);
+			}
+		};
+
+		APEX_TARGET_AVX512 void TransformVector4AVX512(Matrix4x4 const& m, const Vector4* in, Vector4* out, size_t count)
+		{
+			const Columns16 columns { m };
+
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m512 v0 = _mm512_loadu_ps(in[i].m_values);
+				const __m512 v1 = _mm512_loadu_ps(in[i + 4].m_values);
+				_mm512_storeu_ps(out[i].m_values, columns.Transform(v0));
+				_mm512_storeu_ps(out[i + 4].m_values, columns.Transform(v1));
+			}
+			for (; i < count; i += 4)
+			{
+				const __mmask16 mask = count - i >= 4 ? __mmask16(0xffff) : __mmask16((1u << (4 * (count - i))) - 1);
+				const __m512 v = _mm512_maskz_loadu_ps(mask, in[i].m_values);
+				_mm512_mask_storeu_ps(out[i].m_values, mask, columns.Transform(v));
+			}
+		}
+
+		// A whole matrix per register
+		APEX_TARGET_AVX512 inline void MultiplyAVX512(Matrix4x4 const& lhs, Matrix4x4 const& rhs, Matrix4x4& out)
+		{
+			const Columns16 columns { lhs };
+			_mm512_storeu_ps(out.m_columns[0].m_values, columns.Transform(_mm512_loadu_ps(rhs.m_columns[0].m_values)));
+		}
+
+		APEX_TARGET_AVX512 void MultiplyKernelAVX512(const Matrix4x4* lhs, size_t lhsStride, const Matrix4x4* rhs, Matrix4x4* out, size_t count)
+		{
+			if (lhsStride == 0)
+			{
+				const Columns16 columns { *lhs };
+				for (size_t i = 0; i < count; i++)
+				{
+					_mm512_storeu_ps(out[i].m_columns[0].m_values, columns.Transform(_mm512_loadu_ps(rhs[i].m_columns[0].m_values)));
+				}
+				return;
+			}
+
+			for (size_t i = 0; i < count; i++)
+			{
+				MultiplyAVX512(lhs[i], rhs[i], out[i]);
+			}
+		}
+
+		APEX_TARGET_AVX512 void WorldFromLocalAVX512(const Matrix4x4* local, const u32* parents, Matrix4x4* world, size_t count)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				if (parents[i] == kRootParent)
+					world[i] = local[i];
+				else
+					MultiplyAVX512(world[parents[i]], local[i], world[i]);
+			}
+		}
+
+	#elif defined(APEX_ARCH_ARM64)
+
+		/**************************************************************
+		 * NEON : 4 Vector3 per iteration with the structure loads and stores
+		 *************************************************************/
+
+		template <bool IsPoint>
+		void TransformVector3NEON(Matrix4x4 const& m, const Vector3* in, Vector3* out, size_t count)
+		{
+			const float32x4_t c0 = vld1q_f32(m.m_columns[0].m_values);
+			const float32x4_t c1 = vld1q_f32(m.m_columns[1].m_values);
+			const float32x4_t c2 = vld1q_f32(m.m_columns[2].m_values);
+			const float32x4_t c3 = IsPoint ? vld1q_f32(m.m_columns[3].m_values) : vdupq_n_f32(0.f);
+
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32x4x3_t v = vld3q_f32(in[i].m_values);
+				float32x4x3_t res;
+				res.val[0] = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(vdupq_laneq_f32(c3, 0), v.val[2], c2, 0), v.val[1], c1, 0), v.val[0], c0, 0);
+				res.val[1] = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(vdupq_laneq_f32(c3, 1), v.val[2], c2, 1), v.val[1], c1, 1), v.val[0], c0, 1);
+				res.val[2] = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(vdupq_laneq_f32(c3, 2), v.val[2], c2, 2), v.val[1], c1, 2), v.val[0], c0, 2);
+				vst3q_f32(out[i].m_values, res);
+			}
+			TransformVector3Generic<IsPoint>(m, in + i, out + i, count - i);
+		}
+
+		void TransformPointColumnsNEON(Matrix4x4 const& m, const f32* const in[3], f32* const out[3], size_t count)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const float32x4_t x = vld1q_f32(in[0] + i);
+				const float32x4_t y = vld1q_f32(in[1] + i);
+				const float32x4_t z = vld1q_f32(in[2] + i);
+				for (size_t r = 0; r < 3; r++)
+				{
+					const float32x4_t res = vfmaq_n_f32(vfmaq_n_f32(vfmaq_n_f32(vdupq_n_f32(m[3][r]), z, m[2][r]), y, m[1][r]), x, m[0][r]);
+					vst1q_f32(out[r] + i, res);
+				}
+			}
+
+			const f32* const inTail[3] = { in[0] + i, in[1] + i, in[2] + i };
+			f32* const outTail[3] = { out[0] + i, out[1] + i, out[2] + i };
+			TransformPointColumnsGeneric(m, inTail, outTail, count - i);
+		}
+
+	#endif
+
+		Kernels SelectKernels()
+		{
+			Kernels kernels {
+				TransformVector3Generic<true>,
+				TransformVector3Generic<false>,
+				TransformPointColumnsGeneric,
+				TransformVector4Generic,
+				MultiplyGeneric,
+				WorldFromLocalGeneric,
+			};
+
+		#if defined(APEX_ARCH_X86)
+			switch (CpuInfo::GetSimdLevel())
+			{
+			case SimdLevel::eAVX512:
+				kernels = {
+					TransformVector3AVX512<true>,
+					TransformVector3AVX512<false>,
+					TransformPointColumnsAVX512,
+					TransformVector4AVX512,
+					MultiplyKernelAVX512,
+					WorldFromLocalAVX512,
+				};
+				break;
+			case SimdLevel::eAVX2:
+				kernels = {
+					TransformVector3AVX2<true>,
+					TransformVector3AVX2<false>,
+					TransformPointColumnsAVX2,
+					TransformVector4AVX2,
+					MultiplyKernelAVX2,
+					WorldFromLocalAVX2,
+				};
+				break;
+			default:
+				break;
+			}
+		#elif defined(APEX_ARCH_ARM64)
+			// NEON is part of the ARM64 baseline, the Vector4 and matrix kernels already use it through Math/Simd.h
+			kernels.transformPoints = TransformVector3NEON<true>;
+			kernels.transformDirections = TransformVector3NEON<false>;
+			kernels.transformPointColumns = TransformPointColumnsNEON;
+		#endif
+
+			return kernels;
+		}
+
+		Kernels const& GetKernels()
+		{
+			static const Kernels kernels = SelectKernels();
+			return kernels;
+		}
+	}
+
+	void transformPoints(Matrix4x4 const& m, AxArrayRef<const Vector3> in, AxArrayRef<Vector3> out)
+	{
+		axAssert(out.size() >= in.size());
+		GetKernels().transformPoints(m, in.data(), out.data(), in.size());
+	}
+
+	void transformPoints(Matrix4x4 const& m, const f32* in_x, const f32* in_y, const f32* in_z, f32* out_x, f32* out_y, f32* out_z, size_t count)
+	{
+		const f32* const in[3] = { in_x, in_y, in_z };
+		f32* const out[3] = { out_x, out_y, out_z };
+		GetKernels().transformPointColumns(m, in, out, count);
+	}
+
+	void transformDirections(Matrix4x4 const& m, AxArrayRef<const Vector3> in, AxArrayRef<Vector3> out)
+	{
+		axAssert(out.size() >= in.size());
+		GetKernels().transformDirections(m, in.data(), out.data(), in.size());
+	}
+
+	void transformVectors(Matrix4x4 const& m, AxArrayRef<const Vector4> in, AxArrayRef<Vector4> out)
+	{
+		axAssert(out.size() >= in.size());
+		GetKernels().transformVectors(m, in.data(), out.data(), in.size());
+	}
+
+	void multiplyMatrices(Matrix4x4 const& lhs, AxArrayRef<const Matrix4x4> rhs, AxArrayRef<Matrix4x4> out)
+	{
+		axAssert(out.size() >= rhs.size());
+		GetKernels().multiply(&lhs, 0, rhs.data(), out.data(), rhs.size());
+	}
+
+	void multiplyMatrices(AxArrayRef<const Matrix4x4> lhs, AxArrayRef<const Matrix4x4> rhs, AxArrayRef<Matrix4x4> out)
+	{
+		axAssert(lhs.size() == rhs.size() && out.size() >= rhs.size());
+		GetKernels().multiply(lhs.data(), 1, rhs.data(), out.data(), rhs.size());
+	}
+
+	void computeWorldFromLocal(AxArrayRef<const Matrix4x4> local, AxArrayRef<const u32> parents, AxArrayRef<Matrix4x4> world)
+	{
+		axAssert(parents.size() == local.size() && world.size() >= local.size());
+	#if APEX_ENABLE_ASSERTS >= 1
+		for (size_t i = 0; i < parents.size(); i++)
+		{
+			axAssertFmt(parents[i] == kRootParent || parents[i] < i, "Parent {} of node {} must come before it", parents[i], i);
+		}
+	#endif
+		GetKernels().worldFromLocal(local.data(), parents.data(), world.data(), local.size());
+	}
+
+}
+}
@@ -2,6 +2,10 @@
 #include "Core/Asserts.h"
 #include "Core/Platform.h"
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 namespace apex {
 namespace concurrency {
 
@@ -220,5 +224,49 @@ namespace concurrency {
 
 	}
 
+	void parallelFor(size_t count, size_t min_batch, u32 num_threads, parallel_fn fn, void* ctx)
+	{
+		if (count == 0)
+			return;
+
+		if (num_threads == 0)
+		{
+			num_threads = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		const size_t numBatches = std::min<size_t>(num_threads, (count + std::max<size_t>(min_batch, 1) - 1) / std::max<size_t>(min_batch, 1));
+		if (numBatches <= 1)
+		{
+			fn(ctx, 0, count);
+			return;
+		}
+
+		const size_t batchSize = count / numBatches;
+		const size_t remainder = count % numBatches;
+
+		std::vector<std::thread> workers;
+		workers.reserve(numBatches - 1);
+
+		size_t begin = 0;
+		for (size_t i = 0; i < numBatches; i++)
+		{
+			const size_t end = begin + batchSize + (i < remainder ? 1 : 0);
+			if (i + 1 < numBatches)
+			{
+				workers.emplace_back(fn, ctx, begin, end);
+			}
+			else
+			{
+				fn(ctx, begin, end); // the last batch runs on the calling thread
+			}
+			begin = end;
+		}
+
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+	}
+
 }
 }
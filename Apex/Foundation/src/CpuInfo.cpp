@@ -0,0 +1,561 @@
+#include "Core/CpuInfo.h"
+
+#include "Core/Asserts.h"
+#include "Core/Platform.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#if APEX_PLATFORM_WIN32
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <windows.h>
+#elif defined(__linux__)
+#	include <pthread.h>
+#	include <sched.h>
+#endif
+
+#if APEX_ARCH_X86
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#	else
+#		include <cpuid.h>
+#	endif
+#endif
+
+namespace apex {
+
+	namespace
+	{
+		struct CpuInfoState
+		{
+			CpuTopology     topology {};
+			CpuFeatureFlags features {};
+			SimdLevel       simdLevel { SimdLevel::eScalar };
+		};
+
+	#pragma region Feature detection
+
+	#if APEX_ARCH_X86
+		void cpuid(u32 leaf, u32 subleaf, u32 (&regs)[4])
+		{
+		#if defined(_MSC_VER)
+			int r[4];
+			__cpuidex(r, static_cast<int>(leaf), static_cast<int>(subleaf));
+			for (int i = 0; i < 4; i++) regs[i] = static_cast<u32>(r[i]);
+		#else
+			__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+		#endif
+		}
+
+		u64 xgetbv0()
+		{
+		#if defined(_MSC_VER)
+			return _xgetbv(0);
+		#else
+			u32 eax, edx;
+			__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+			return (static_cast<u64>(edx) << 32) | eax;
+		#endif
+		}
+	#endif
+
+		CpuFeatureFlags DetectFeatures()
+		{
+			CpuFeatureFlags features {};
+
+		#if APEX_ARCH_X86
+			constexpr u32 EAX = 0, EBX = 1, ECX = 2, EDX = 3;
+			u32 regs[4] {};
+
+			cpuid(0, 0, regs);
+			const u32 maxLeaf = regs[EAX];
+
+			cpuid(1, 0, regs);
+			const u32 ecx1 = regs[ECX];
+			const u32 edx1 = regs[EDX];
+
+			if (edx1 & (1u << 26)) features |= CpuFeature::eSSE2;
+			if (ecx1 & (1u << 0))  features |= CpuFeature::eSSE3;
+			if (ecx1 & (1u << 9))  features |= CpuFeature::eSSSE3;
+			if (ecx1 & (1u << 19)) features |= CpuFeature::eSSE41;
+			if (ecx1 & (1u << 20)) features |= CpuFeature::eSSE42;
+			if (ecx1 & (1u << 23)) features |= CpuFeature::ePOPCNT;
+
+			// AVX state must also be enabled by the OS (XCR0), not just supported by the CPU
+			const bool osxsave = ecx1 & (1u << 27);
+			const u64 xcr0 = osxsave ? xgetbv0() : 0;
+			const bool osAvx = (xcr0 & 0x6) == 0x6;
+			const bool osAvx512 = (xcr0 & 0xE6) == 0xE6;
+
+			if (osAvx && (ecx1 & (1u << 28))) features |= CpuFeature::eAVX;
+			if (osAvx && (ecx1 & (1u << 12))) features |= CpuFeature::eFMA;
+
+			if (maxLeaf >= 7)
+			{
+				cpuid(7, 0, regs);
+				const u32 ebx7 = regs[EBX];
+
+				if (osAvx && (ebx7 & (1u << 5)))     features |= CpuFeature::eAVX2;
+				if (ebx7 & (1u << 8))                features |= CpuFeature::eBMI2;
+				if (osAvx512 && (ebx7 & (1u << 16))) features |= CpuFeature::eAVX512F;
+				if (osAvx512 && (ebx7 & (1u << 30))) features |= CpuFeature::eAVX512BW;
+				if (osAvx512 && (ebx7 & (1u << 31))) features |= CpuFeature::eAVX512VL;
+			}
+		#elif APEX_ARCH_ARM64
+			features |= CpuFeature::eNEON; // NEON is mandatory on AArch64
+		#endif
+
+			return features;
+		}
+
+		SimdLevel SelectSimdLevel(CpuFeatureFlags features)
+		{
+			auto has = [features](CpuFeatureFlags required) { return (features.mask & required.mask) == required.mask; };
+
+			if (has(CpuFeature::eNEON))
+				return SimdLevel::eNEON;
+			if (has(CpuFeature::eAVX512F | CpuFeature::eAVX512BW | CpuFeature::eAVX512VL | CpuFeature::eAVX2 | CpuFeature::eFMA))
+				return SimdLevel::eAVX512;
+			if (has(CpuFeature::eAVX2 | CpuFeature::eFMA))
+				return SimdLevel::eAVX2;
+			if (has(CpuFeature::eSSE42 | CpuFeature::ePOPCNT))
+				return SimdLevel::eSSE42;
+			return SimdLevel::eScalar;
+		}
+
+	#pragma endregion
+
+	#pragma region Topology detection
+
+		// Maps sparse OS identifiers (core ids, cache domains, ...) to dense indices
+		struct DenseIdMap
+		{
+			u64 keys[CpuTopology::kMaxLogicalCores];
+			u32 count = 0;
+
+			u16 getOrAdd(u64 key)
+			{
+				for (u32 i = 0; i < count; i++)
+				{
+					if (keys[i] == key)
+						return static_cast<u16>(i);
+				}
+				axAssert(count < CpuTopology::kMaxLogicalCores);
+				keys[count] = key;
+				return static_cast<u16>(count++);
+			}
+		};
+
+		void FinalizeTopology(CpuTopology& topology)
+		{
+			// smtIndex is the rank of each logical core among the cores sharing its physical core
+			for (u32 i = 0; i < topology.numLogicalCores; i++)
+			{
+				u8 smtIndex = 0;
+				for (u32 j = 0; j < i; j++)
+				{
+					if (topology.cores[j].physicalCore == topology.cores[i].physicalCore)
+						++smtIndex;
+				}
+				topology.cores[i].smtIndex = smtIndex;
+			}
+
+			topology.numPhysicalCores = topology.numPackages = topology.numL3Groups = topology.numNumaNodes = 0;
+			for (u32 i = 0; i < topology.numLogicalCores; i++)
+			{
+				LogicalCore const& core = topology.cores[i];
+				topology.numPhysicalCores = std::max<u32>(topology.numPhysicalCores, core.physicalCore + 1u);
+				topology.numPackages = std::max<u32>(topology.numPackages, core.package + 1u);
+				topology.numL3Groups = std::max<u32>(topology.numL3Groups, core.l3Group + 1u);
+				topology.numNumaNodes = std::max<u32>(topology.numNumaNodes, core.numaNode + 1u);
+			}
+		}
+
+		void DetectFallbackTopology(CpuTopology& topology)
+		{
+			const u32 numThreads = std::max(1u, std::thread::hardware_concurrency());
+			topology.numLogicalCores = std::min<u32>(numThreads, CpuTopology::kMaxLogicalCores);
+			for (u32 i = 0; i < topology.numLogicalCores; i++)
+			{
+				topology.cores[i] = { .osIndex = static_cast<u16>(i), .physicalCore = static_cast<u16>(i) };
+			}
+			topology.caches.lineSize = 64;
+		}
+
+	#if APEX_PLATFORM_WIN32
+		bool DetectTopology(CpuTopology& topology)
+		{
+			DWORD length = 0;
+			(void)GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+			if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+				return false;
+
+			u8* buffer = static_cast<u8*>(::malloc(length));
+			if (!GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer), &length))
+			{
+				::free(buffer);
+				return false;
+			}
+
+			auto forEachCpu = [](GROUP_AFFINITY const& group_mask, auto&& fn)
+			{
+				for (u32 bit = 0; bit < 64; bit++)
+				{
+					if (group_mask.Mask & (KAFFINITY(1) << bit))
+						fn(static_cast<u32>(group_mask.Group) * 64 + bit);
+				}
+			};
+
+			auto findCore = [&topology](u32 os_index) -> LogicalCore*
+			{
+				for (u32 i = 0; i < topology.numLogicalCores; i++)
+				{
+					if (topology.cores[i].osIndex == os_index)
+						return &topology.cores[i];
+				}
+				return nullptr;
+			};
+
+			// Processor cores come first so that the other relations can refer to them
+			u32 numPhysical = 0;
+			for (DWORD offset = 0; offset < length;)
+			{
+				auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer + offset);
+				if (info->Relationship == RelationProcessorCore)
+				{
+					for (WORD g = 0; g < info->Processor.GroupCount; g++)
+					{
+						forEachCpu(info->Processor.GroupMask[g], [&](u32 os_index)
+						{
+							if (topology.numLogicalCores < CpuTopology::kMaxLogicalCores)
+								topology.cores[topology.numLogicalCores++] = { .osIndex = static_cast<u16>(os_index), .physicalCore = static_cast<u16>(numPhysical) };
+						});
+					}
+					++numPhysical;
+				}
+				offset += info->Size;
+			}
+
+			u16 package = 0, l3Group = 0;
+			for (DWORD offset = 0; offset < length;)
+			{
+				auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer + offset);
+				switch (info->Relationship)
+				{
+				case RelationProcessorPackage:
+					for (WORD g = 0; g < info->Processor.GroupCount; g++)
+						forEachCpu(info->Processor.GroupMask[g], [&](u32 os_index) { if (LogicalCore* core = findCore(os_index)) core->package = package; });
+					++package;
+					break;
+
+				case RelationNumaNode:
+					forEachCpu(info->NumaNode.GroupMask, [&](u32 os_index) { if (LogicalCore* core = findCore(os_index)) core->numaNode = static_cast<u16>(info->NumaNode.NodeNumber); });
+					break;
+
+				case RelationCache:
+				{
+					CACHE_RELATIONSHIP const& cache = info->Cache;
+					topology.caches.lineSize = cache.LineSize;
+					if (cache.Level == 1 && cache.Type == CacheData)
+						topology.caches.l1DataSize = cache.CacheSize;
+					else if (cache.Level == 2)
+						topology.caches.l2Size = cache.CacheSize;
+					else if (cache.Level == 3)
+					{
+						topology.caches.l3Size = cache.CacheSize;
+						forEachCpu(cache.GroupMask, [&](u32 os_index) { if (LogicalCore* core = findCore(os_index)) core->l3Group = l3Group; });
+						++l3Group;
+					}
+					break;
+				}
+
+				default:
+					break;
+				}
+				offset += info->Size;
+			}
+
+			::free(buffer);
+			return topology.numLogicalCores > 0;
+		}
+
+	#elif defined(__linux__)
+		bool ReadSysfsLine(char* buffer, size_t size, const char* format, u32 arg0, u32 arg1 = 0)
+		{
+			char path[256];
+			(void)snprintf(path, sizeof(path), format, arg0, arg1);
+
+			FILE* file = fopen(path, "r");
+			if (!file)
+				return false;
+
+			const bool ok = fgets(buffer, static_cast<int>(size), file) != nullptr;
+			fclose(file);
+			return ok;
+		}
+
+		bool ReadSysfsU32(u32& value, const char* format, u32 arg0, u32 arg1 = 0)
+		{
+			char buffer[64];
+			if (!ReadSysfsLine(buffer, sizeof(buffer), format, arg0, arg1))
+				return false;
+			value = static_cast<u32>(strtoul(buffer, nullptr, 10));
+			return true;
+		}
+
+		// Parses sysfs cpu lists of the form "0-3,8,10-11"
+		template <typename Fn>
+		void ForEachInCpuList(const char* list, Fn&& fn)
+		{
+			const char* p = list;
+			while (*p >= '0' && *p <= '9')
+			{
+				char* end;
+				const u32 first = static_cast<u32>(strtoul(p, &end, 10));
+				u32 last = first;
+				if (*end == '-')
+				{
+					last = static_cast<u32>(strtoul(end + 1, &end, 10));
+				}
+				for (u32 cpu = first; cpu <= last; cpu++)
+				{
+					fn(cpu);
+				}
+				p = (*end == ',') ? end + 1 : end;
+			}
+		}
+
+		u32 ParseCacheSize(const char* str)
+		{
+			char* end;
+			u32 size = static_cast<u32>(strtoul(str, &end, 10));
+			if (*end == 'K') size <<= 10;
+			else if (*end == 'M') size <<= 20;
+			return size;
+		}
+
+		bool DetectTopology(CpuTopology& topology)
+		{
+			char list[1024];
+			if (!ReadSysfsLine(list, sizeof(list), "/sys/devices/system/cpu/online", 0))
+				return false;
+
+			ForEachInCpuList(list, [&topology](u32 cpu)
+			{
+				if (topology.numLogicalCores < CpuTopology::kMaxLogicalCores)
+					topology.cores[topology.numLogicalCores++].osIndex = static_cast<u16>(cpu);
+			});
+
+			DenseIdMap physicalIds, l3Ids;
+			for (u32 i = 0; i < topology.numLogicalCores; i++)
+			{
+				LogicalCore& core = topology.cores[i];
+
+				u32 coreId = i, packageId = 0;
+				(void)ReadSysfsU32(coreId, "/sys/devices/system/cpu/cpu%u/topology/core_id", core.osIndex);
+				(void)ReadSysfsU32(packageId, "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", core.osIndex);
+
+				core.package = static_cast<u16>(packageId);
+				core.physicalCore = physicalIds.getOrAdd((static_cast<u64>(packageId) << 32) | coreId);
+
+				// Cores sharing an L3 are keyed by the first cpu in the cache's shared_cpu_list
+				u64 l3Key = packageId;
+				for (u32 index = 0; index < 8; index++)
+				{
+					u32 level;
+					if (!ReadSysfsU32(level, "/sys/devices/system/cpu/cpu%u/cache/index%u/level", core.osIndex, index))
+						break;
+					if (level == 3 && ReadSysfsLine(list, sizeof(list), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", core.osIndex, index))
+					{
+						l3Key = (1ull << 32) | strtoul(list, nullptr, 10);
+						break;
+					}
+				}
+				core.l3Group = l3Ids.getOrAdd(l3Key);
+			}
+
+			// NUMA node ids may be sparse, probe a reasonable range
+			for (u32 node = 0; node < 64; node++)
+			{
+				if (!ReadSysfsLine(list, sizeof(list), "/sys/devices/system/node/node%u/cpulist", node))
+					continue;
+
+				ForEachInCpuList(list, [&topology, node](u32 cpu)
+				{
+					for (u32 i = 0; i < topology.numLogicalCores; i++)
+					{
+						if (topology.cores[i].osIndex == cpu)
+							topology.cores[i].numaNode = static_cast<u16>(node);
+					}
+				});
+			}
+
+			const u32 cpu0 = topology.cores[0].osIndex;
+			for (u32 index = 0; index < 8; index++)
+			{
+				u32 level;
+				char type[32], size[32];
+				if (!ReadSysfsU32(level, "/sys/devices/system/cpu/cpu%u/cache/index%u/level", cpu0, index)
+					|| !ReadSysfsLine(type, sizeof(type), "/sys/devices/system/cpu/cpu%u/cache/index%u/type", cpu0, index)
+					|| !ReadSysfsLine(size, sizeof(size), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", cpu0, index))
+				{
+					break;
+				}
+
+				(void)ReadSysfsU32(topology.caches.lineSize, "/sys/devices/system/cpu/cpu%u/cache/index%u/coherency_line_size", cpu0, index);
+
+				const u32 bytes = ParseCacheSize(size);
+				if (level == 1 && type[0] == 'D')
+					topology.caches.l1DataSize = bytes;
+				else if (level == 2)
+					topology.caches.l2Size = bytes;
+				else if (level == 3)
+					topology.caches.l3Size = bytes;
+			}
+
+			return topology.numLogicalCores > 0;
+		}
+
+	#else
+		bool DetectTopology(CpuTopology&)
+		{
+			return false;
+		}
+	#endif
+
+	#pragma endregion
+
+		CpuInfoState& GetState()
+		{
+			// Function-local static gives thread-safe one-time detection
+			static CpuInfoState s_state = []
+			{
+				CpuInfoState state;
+				if (!DetectTopology(state.topology))
+				{
+					state.topology = {};
+					DetectFallbackTopology(state.topology);
+				}
+				FinalizeTopology(state.topology);
+
+				state.features = DetectFeatures();
+				state.simdLevel = SelectSimdLevel(state.features);
+				return state;
+			}();
+			return s_state;
+		}
+	}
+
+	void CpuInfo::Init()
+	{
+		(void)GetState();
+	}
+
+	CpuTopology const& CpuInfo::GetTopology()
+	{
+		return GetState().topology;
+	}
+
+	CpuFeatureFlags CpuInfo::GetFeatures()
+	{
+		return GetState().features;
+	}
+
+	SimdLevel CpuInfo::GetSimdLevel()
+	{
+		return GetState().simdLevel;
+	}
+
+	bool CpuInfo::HasFeature(CpuFeature feature)
+	{
+		return (GetState().features.mask & static_cast<u32>(feature)) != 0;
+	}
+
+	ThreadPlacement CpuInfo::PlanThreadPlacement(u32 num_dedicated, u32 max_workers, bool use_smt)
+	{
+		CpuTopology const& topology = GetTopology();
+
+		ThreadPlacement placement {};
+		placement.numDedicated = std::min(num_dedicated, ThreadPlacement::kMaxDedicatedThreads);
+		if (max_workers == 0)
+			max_workers = CpuTopology::kMaxLogicalCores;
+
+		// Visit physical cores grouped by L3 domain so that neighbouring workers share a cache
+		u16 physicalOrder[CpuTopology::kMaxLogicalCores];
+		u32 numPhysical = 0;
+		for (u32 group = 0; group < topology.numL3Groups; group++)
+		{
+			for (u32 i = 0; i < topology.numLogicalCores; i++)
+			{
+				LogicalCore const& core = topology.cores[i];
+				if (core.l3Group == group && core.smtIndex == 0)
+					physicalOrder[numPhysical++] = core.physicalCore;
+			}
+		}
+
+		auto logicalFor = [&topology](u32 physical_core, u32 smt_index) -> s32
+		{
+			for (u32 i = 0; i < topology.numLogicalCores; i++)
+			{
+				if (topology.cores[i].physicalCore == physical_core && topology.cores[i].smtIndex == smt_index)
+					return static_cast<s32>(topology.cores[i].osIndex);
+			}
+			return -1;
+		};
+
+		// Dedicated threads each get a whole physical core. On machines with fewer cores
+		// than dedicated threads they have to double up.
+		for (u32 i = 0; i < placement.numDedicated; i++)
+		{
+			placement.dedicatedCores[i] = static_cast<u16>(logicalFor(physicalOrder[i % numPhysical], 0));
+		}
+
+		const u32 firstWorkerCore = std::min(placement.numDedicated, numPhysical);
+		const u32 maxSmt = use_smt ? 255 : 1;
+		for (u32 smt = 0; smt < maxSmt && placement.numWorkers < max_workers; smt++)
+		{
+			bool anyAtThisLevel = false;
+			for (u32 p = firstWorkerCore; p < numPhysical && placement.numWorkers < max_workers; p++)
+			{
+				const s32 logical = logicalFor(physicalOrder[p], smt);
+				if (logical >= 0)
+				{
+					placement.workerCores[placement.numWorkers++] = static_cast<u16>(logical);
+					anyAtThisLevel = true;
+				}
+			}
+			if (!anyAtThisLevel)
+				break;
+		}
+
+		// Always leave room for at least one worker, sharing the last physical core if necessary
+		if (placement.numWorkers == 0)
+		{
+			placement.workerCores[placement.numWorkers++] = static_cast<u16>(logicalFor(physicalOrder[numPhysical - 1], 0));
+		}
+
+		return placement;
+	}
+
+	bool CpuInfo::SetCurrentThreadAffinity(u32 os_index)
+	{
+	#if APEX_PLATFORM_WIN32
+		GROUP_AFFINITY affinity {};
+		affinity.Group = static_cast<WORD>(os_index / 64);
+		affinity.Mask = KAFFINITY(1) << (os_index % 64);
+		return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+	#elif defined(__linux__)
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(os_index, &set);
+		return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+	#else
+		(void)os_index;
+		return false;
+	#endif
+	}
+
+}
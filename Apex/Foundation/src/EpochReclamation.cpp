@@ -0,0 +1,297 @@
+#include "Concurrency/EpochReclamation.h"
+
+#include "Core/Asserts.h"
+#include "Core/Platform.h"
+
+namespace apex {
+namespace concurrency {
+
+	namespace
+	{
+		u32 acquire_slot(auto& records, std::atomic<u32>& high_water_mark, u32 max_threads)
+		{
+			for (u32 i = 0; i < max_threads; i++)
+			{
+				bool expected = false;
+				if (records[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					// Raise the high water mark so scans never have to look past the last used slot
+					u32 mark = high_water_mark.load(std::memory_order_relaxed);
+					while (mark < i + 1 && !high_water_mark.compare_exchange_weak(mark, i + 1, std::memory_order_release, std::memory_order_relaxed))
+					{
+					}
+					return i;
+				}
+			}
+			return Constants::u32_MAX;
+		}
+
+		void reclaim_all(detail::RetiredPtr* retired, u32& count)
+		{
+			for (u32 i = 0; i < count; i++)
+			{
+				retired[i].reclaim(retired[i].ptr);
+			}
+			count = 0;
+		}
+	}
+
+	EpochManager::~EpochManager()
+	{
+		drain();
+	}
+
+	u32 EpochManager::registerThread()
+	{
+		u32 slot = acquire_slot(m_records, m_highWaterMark, kMaxThreads);
+		axAssertFmt(slot != kInvalidSlot, "EpochManager ran out of thread slots!");
+
+		// Retired pointers left behind by the previous owner of this slot are kept and collected later
+		m_records[slot].nesting = 0;
+		m_records[slot].localEpoch.store(0, std::memory_order_relaxed);
+		return slot;
+	}
+
+	void EpochManager::unregisterThread(u32 slot)
+	{
+		axAssert(slot < kMaxThreads);
+		ThreadRecord& record = m_records[slot];
+		axAssertFmt(record.nesting == 0, "Cannot unregister a thread that is still inside an epoch!");
+
+		(void)tryAdvance();
+		(void)collect(slot);
+
+		record.inUse.store(false, std::memory_order_release);
+	}
+
+	void EpochManager::enter(u32 slot)
+	{
+		axAssert(slot < kMaxThreads);
+		ThreadRecord& record = m_records[slot];
+
+		if (record.nesting++ == 0)
+		{
+			const u64 epoch = m_globalEpoch.load(std::memory_order_relaxed);
+			record.localEpoch.store(epoch | kActiveBit, std::memory_order_relaxed);
+
+			// The announcement must be visible to reclaimers before any shared node is read
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+		}
+	}
+
+	void EpochManager::exit(u32 slot)
+	{
+		axAssert(slot < kMaxThreads);
+		ThreadRecord& record = m_records[slot];
+		axAssertFmt(record.nesting > 0, "Unbalanced EpochManager::exit!");
+
+		if (--record.nesting == 0)
+		{
+			// Release ensures all reads of shared nodes complete before the thread is seen as quiescent
+			record.localEpoch.store(0, std::memory_order_release);
+		}
+	}
+
+	void EpochManager::retire(u32 slot, void* ptr, reclaim_fn reclaim)
+	{
+		axAssert(slot < kMaxThreads);
+		axAssert(reclaim != nullptr);
+		ThreadRecord& record = m_records[slot];
+
+		while (record.retiredCount == kMaxRetiredPerThread)
+		{
+			(void)tryAdvance();
+			if (collect(slot) > 0)
+				break;
+
+			// Entries retired in the calling thread's own epoch can never be reclaimed while it is pinned,
+			// so waiting on other threads only helps if at least one entry is older than that
+			const u64 local = record.localEpoch.load(std::memory_order_relaxed);
+			if (local & kActiveBit)
+			{
+				const u64 ownEpoch = local & ~kActiveBit;
+				bool canProgress = false;
+				for (u32 i = 0; i < record.retiredCount && !canProgress; i++)
+				{
+					canProgress = record.retired[i].epoch < ownEpoch;
+				}
+				axCriticalAssertFmt(canProgress, "EpochManager limbo list is full. Exit the epoch more often!");
+			}
+
+			_THREAD_PAUSE();
+		}
+
+		record.retired[record.retiredCount++] = { ptr, reclaim, m_globalEpoch.load(std::memory_order_acquire) };
+
+		if (record.retiredCount % kCollectThreshold == 0)
+		{
+			(void)tryAdvance();
+			(void)collect(slot);
+		}
+	}
+
+	bool EpochManager::tryAdvance()
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		u64 epoch = m_globalEpoch.load(std::memory_order_acquire);
+		const u32 highWaterMark = m_highWaterMark.load(std::memory_order_acquire);
+
+		for (u32 i = 0; i < highWaterMark; i++)
+		{
+			const u64 local = m_records[i].localEpoch.load(std::memory_order_acquire);
+			if ((local & kActiveBit) && (local & ~kActiveBit) != epoch)
+			{
+				return false; // a thread is still lagging behind in an older epoch
+			}
+		}
+
+		// Losing the race is fine, it means another thread has already advanced the epoch
+		(void)m_globalEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel, std::memory_order_relaxed);
+		return true;
+	}
+
+	size_t EpochManager::collect(u32 slot)
+	{
+		axAssert(slot < kMaxThreads);
+		ThreadRecord& record = m_records[slot];
+
+		// Anything retired two or more epochs ago cannot be referenced by any thread
+		const u64 epoch = m_globalEpoch.load(std::memory_order_acquire);
+
+		size_t numReclaimed = 0;
+		u32 kept = 0;
+		for (u32 i = 0; i < record.retiredCount; i++)
+		{
+			detail::RetiredPtr& retired = record.retired[i];
+			if (retired.epoch + 2 <= epoch)
+			{
+				retired.reclaim(retired.ptr);
+				++numReclaimed;
+			}
+			else
+			{
+				record.retired[kept++] = retired;
+			}
+		}
+		record.retiredCount = kept;
+
+		return numReclaimed;
+	}
+
+	void EpochManager::drain()
+	{
+		const u32 highWaterMark = m_highWaterMark.load(std::memory_order_acquire);
+		for (u32 i = 0; i < highWaterMark; i++)
+		{
+			axAssertFmt((m_records[i].localEpoch.load(std::memory_order_acquire) & kActiveBit) == 0, "Cannot drain EpochManager while a thread is inside an epoch!");
+			reclaim_all(m_records[i].retired, m_records[i].retiredCount);
+		}
+	}
+
+	HazardPointerDomain::~HazardPointerDomain()
+	{
+		const u32 highWaterMark = m_highWaterMark.load(std::memory_order_acquire);
+		for (u32 i = 0; i < highWaterMark; i++)
+		{
+			reclaim_all(m_records[i].retired, m_records[i].retiredCount);
+		}
+	}
+
+	u32 HazardPointerDomain::registerThread()
+	{
+		u32 slot = acquire_slot(m_records, m_highWaterMark, kMaxThreads);
+		axAssertFmt(slot != kInvalidSlot, "HazardPointerDomain ran out of thread slots!");
+		return slot;
+	}
+
+	void HazardPointerDomain::unregisterThread(u32 slot)
+	{
+		axAssert(slot < kMaxThreads);
+		ThreadRecord& record = m_records[slot];
+
+		for (std::atomic<void*>& hazard : record.hazards)
+		{
+			hazard.store(nullptr, std::memory_order_release);
+		}
+		(void)scan(slot);
+
+		record.inUse.store(false, std::memory_order_release);
+	}
+
+	void HazardPointerDomain::clear(u32 slot, u32 index)
+	{
+		axAssert(slot < kMaxThreads && index < kHazardsPerThread);
+		m_records[slot].hazards[index].store(nullptr, std::memory_order_release);
+	}
+
+	void HazardPointerDomain::retire(u32 slot, void* ptr, reclaim_fn reclaim)
+	{
+		axAssert(slot < kMaxThreads);
+		axAssert(reclaim != nullptr);
+		ThreadRecord& record = m_records[slot];
+
+		// Other threads eventually drop their hazards, so spinning here cannot livelock
+		while (record.retiredCount == kMaxRetiredPerThread)
+		{
+			if (scan(slot) == 0)
+				_THREAD_PAUSE();
+		}
+
+		record.retired[record.retiredCount++] = { ptr, reclaim, 0 };
+
+		if (record.retiredCount == kMaxRetiredPerThread)
+		{
+			(void)scan(slot);
+		}
+	}
+
+	size_t HazardPointerDomain::scan(u32 slot)
+	{
+		axAssert(slot < kMaxThreads);
+		ThreadRecord& record = m_records[slot];
+
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		size_t numReclaimed = 0;
+		u32 kept = 0;
+		for (u32 i = 0; i < record.retiredCount; i++)
+		{
+			detail::RetiredPtr& retired = record.retired[i];
+			if (!IsHazardous(retired.ptr))
+			{
+				retired.reclaim(retired.ptr);
+				++numReclaimed;
+			}
+			else
+			{
+				record.retired[kept++] = retired;
+			}
+		}
+		record.retiredCount = kept;
+
+		return numReclaimed;
+	}
+
+	void HazardPointerDomain::SetHazard(u32 slot, u32 index, void* ptr)
+	{
+		axAssert(slot < kMaxThreads && index < kHazardsPerThread);
+		m_records[slot].hazards[index].store(ptr, std::memory_order_seq_cst);
+	}
+
+	bool HazardPointerDomain::IsHazardous(void* ptr) const
+	{
+		const u32 highWaterMark = m_highWaterMark.load(std::memory_order_acquire);
+		for (u32 i = 0; i < highWaterMark; i++)
+		{
+			for (std::atomic<void*> const& hazard : m_records[i].hazards)
+			{
+				if (hazard.load(std::memory_order_acquire) == ptr)
+					return true;
+			}
+		}
+		return false;
+	}
+
+}
+}
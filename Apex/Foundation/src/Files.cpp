@@ -1,5 +1,7 @@
 ﻿#include "Core/Files.h"
 
+#include <algorithm>
+
 
 #ifdef APEX_PLATFORM_WIN32
 #	include <windows.h>
@@ -100,11 +102,15 @@ namespace apex {
 	File& File::operator=(File&& other) noexcept
 	{
 		m_handle = other.m_handle;
+		m_mappedHandle = other.m_mappedHandle;
 		m_size = other.m_size;
 		m_filename = other.m_filename;
+		m_flags = other.m_flags;
 		other.m_handle = nullptr;
+		other.m_mappedHandle = nullptr;
 		other.m_size = 0;
 		other.m_filename = nullptr;
+		other.m_flags = 0;
 		return *this;
 	}
 
@@ -204,4 +210,40 @@ namespace apex {
 		#error Not implemented!
 	#endif
 	}
+
+	size_t File::ReadAt(u64 offset, void* buffer, size_t buffer_size) const
+	{
+		axAssert(m_flags & FileAccessMode::eRead);
+	#if APEX_PLATFORM_WIN32
+		OVERLAPPED ol {};
+		ol.Offset = static_cast<DWORD>(offset);
+		ol.OffsetHigh = static_cast<DWORD>(offset >> 32);
+		DWORD dwBytesRead = 0;
+		if (!ReadFile(m_handle, buffer, static_cast<DWORD>(buffer_size), &dwBytesRead, &ol))
+		{
+			// Reading at or past the end of the file is not an error, it just returns no data
+			axAssertFmt(GetLastError() == ERROR_HANDLE_EOF, "Could not read from file : {}", m_filename);
+			return 0;
+		}
+		return dwBytesRead;
+	#else
+		#error Not implemented!
+	#endif
+	}
+
+	size_t File::WriteAt(u64 offset, const void* buffer, size_t buffer_size)
+	{
+		axAssert(m_flags & FileAccessMode::eWrite);
+	#if APEX_PLATFORM_WIN32
+		OVERLAPPED ol {};
+		ol.Offset = static_cast<DWORD>(offset);
+		ol.OffsetHigh = static_cast<DWORD>(offset >> 32);
+		DWORD dwBytesWritten = 0;
+		axVerifyFmt(WriteFile(m_handle, buffer, static_cast<DWORD>(buffer_size), &dwBytesWritten, &ol), "Could not write to file : {}", m_filename);
+		m_size = std::max<size_t>(m_size, offset + dwBytesWritten);
+		return dwBytesWritten;
+	#else
+		#error Not implemented!
+	#endif
+	}
 }
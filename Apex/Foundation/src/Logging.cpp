@@ -1,6 +1,8 @@
 #include "Core/Logging.h"
+#include "Core/RingBufferSink.h"
 #include "Core/Types.h"
 #include "Core/Console.h"
+#include "String/AxStringBuilder.h"
 
 #ifdef _WIN32
 #define WINDOWS_LEAN_AND_MEAN
@@ -12,9 +14,12 @@ namespace logging {
 
 	namespace detail
 	{
-		constexpr const char* LOG_MSG_ANSI_FORMAT = "%s[%s::(%s):%d] <%s> :: %s\n\033[0m";
-		constexpr const char* LOG_MSG_FORMAT = "[%s::(%s):%d] <%s> :: %s\n";
-		char MSG_BUF[2048] {};
+		constexpr size_t kMaxLogMsgSize = 2048;
+
+		// Per thread, and separate for the plain and ANSI text so that formatting for the console does not overwrite
+		// the LogMsg::formatted text other sinks still read
+		thread_local AxStringBuilder<kMaxLogMsgSize> t_formattedMsg { StringBuilderMode::eTruncate };
+		thread_local AxStringBuilder<kMaxLogMsgSize> t_ansiMsg { StringBuilderMode::eTruncate };
 
 		const char* LOG_LEVEL_STR[static_cast<u64>(LogLevel::_MAX_ENUM_)] =
 		{
@@ -28,13 +33,14 @@ namespace logging {
 
 		const char* format_log_msg(const LogMsg& log_msg)
 		{
-			(void)snprintf(MSG_BUF, sizeof(MSG_BUF), LOG_MSG_FORMAT,
+			t_formattedMsg.clear();
+			t_formattedMsg.format("[{}::({}):{}] <{}> :: {}\n",
 				log_msg.filename, log_msg.funcsig, log_msg.lineno,
 				LOG_LEVEL_STR[static_cast<u64>(log_msg.level)],
 				log_msg.msg
 			);
 
-			return MSG_BUF;
+			return t_formattedMsg.c_str();
 		}
 
 		const char* get_ansi_color_for_level(LogLevel level)
@@ -54,13 +60,14 @@ namespace logging {
 
 		const char* format_log_message_ansi(const LogMsg& log_msg)
 		{
-			(void)snprintf(MSG_BUF, sizeof(MSG_BUF), LOG_MSG_ANSI_FORMAT, get_ansi_color_for_level(log_msg.level),
+			t_ansiMsg.clear();
+			t_ansiMsg.format("{}[{}::({}):{}] <{}> :: {}\n\033[0m", get_ansi_color_for_level(log_msg.level),
 				log_msg.filename, log_msg.funcsig, log_msg.lineno,
 				LOG_LEVEL_STR[static_cast<u64>(log_msg.level)],
 				log_msg.msg
 			);
 
-			return MSG_BUF;
+			return t_ansiMsg.c_str();
 		}
 
 		Logger s_logger;
@@ -143,6 +150,32 @@ namespace logging {
 		}
 	}
 
+	void IRingBufferSink::log(const LogMsg& log_msg)
+	{
+		const char* msg = log_msg.formatted;
+		const size_t len = strlen(msg);
+		const size_t capacity = m_buffer.capacity();
+
+		if (len >= capacity)
+		{
+			m_buffer.clear();
+			m_buffer.push_back_n(msg + len - capacity, capacity);
+			return;
+		}
+
+		// Drop whole messages from the front until the new one fits
+		if (m_buffer.size() + len > capacity)
+		{
+			size_t drop = m_buffer.size() + len - capacity;
+			while (drop < m_buffer.size() && m_buffer[drop - 1] != '\n')
+			{
+				drop++;
+			}
+			m_buffer.pop_front_n(drop);
+		}
+		m_buffer.push_back_n(msg, len);
+	}
+
 	bool DisplayErrorMessageBox(const LogMsg& log_msg)
 	{
 	#ifdef _WIN32
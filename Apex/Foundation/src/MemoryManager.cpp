@@ -65,6 +65,8 @@ namespace mem {
 
 	void MemoryManagerImpl::setUpMemoryPools()
 	{
+		static_assert(std::size(g_memoryPoolSizes) <= kMaxMemoryPools);
+
 		u32 i = 0;
 		u8 *pMemItr = m_pBase; // malloc'd memory is 16 byte aligned
 
@@ -101,6 +103,7 @@ namespace mem {
 		}
 		axAssert(poolIdx < m_poolAllocators.size());
 
+		concurrency::LockGuard lock(m_poolLocks[poolIdx]);
 		void* mem = m_poolAllocators[poolIdx].allocate(allocSize);
 
 		return { poolIdx, mem };
@@ -110,13 +113,15 @@ namespace mem {
 	{
 		if (mem == nullptr)
 			return;
-		getMemoryPoolFromPointer(mem).free(mem);
+		PoolAllocator& pool = getMemoryPoolFromPointer(mem);
+		freeFromMemoryPool(static_cast<u32>(&pool - m_poolAllocators.data()), mem);
 	}
 
 	void MemoryManagerImpl::freeFromMemoryPool(u32 poolIdx, void* mem)
 	{
 		axAssert(poolIdx < m_poolAllocators.size());
 
+		concurrency::LockGuard lock(m_poolLocks[poolIdx]);
 		m_poolAllocators[poolIdx].free(mem);
 	}
 
@@ -0,0 +1,363 @@
+#include "Algorithms/RadixSort.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <thread>
+
+#include "Concurrency/Concurrency.h"
+#include "Core/Asserts.h"
+#include "Core/Platform.h"
+#include "Memory/MemoryManager.h"
+
+#if defined(APEX_ARCH_ARM64)
+#	include <arm_neon.h>
+#endif
+
+namespace apex {
+
+	namespace
+	{
+		constexpr u32 kDigitBits = 8;
+		constexpr size_t kNumBuckets = size_t(1) << kDigitBits;
+		constexpr size_t kInsertionSortThreshold = 64;
+		constexpr size_t kMinParallelChunk = 64 * 1024;
+
+		template <typename Key>
+		constexpr u32 kNumPasses = sizeof(Key) * 8 / kDigitBits;
+
+		using Histogram = u32[kNumBuckets];
+
+		template <typename Key>
+		u32 Digit(Key key, u32 pass)
+		{
+			return static_cast<u32>(key >> (pass * kDigitBits)) & (kNumBuckets - 1);
+		}
+
+		template <typename Key>
+		void InsertionSort(Key* keys, u32* values, size_t count)
+		{
+			for (size_t i = 1; i < count; i++)
+			{
+				const Key key = keys[i];
+				const u32 value = values ? values[i] : 0;
+
+				size_t j = i;
+				for (; j > 0 && keys[j - 1] > key; j--)
+				{
+					keys[j] = keys[j - 1];
+					if (values) values[j] = values[j - 1];
+				}
+				keys[j] = key;
+				if (values) values[j] = value;
+			}
+		}
+
+		// Counts the digits of every pass with a single read of the keys
+		template <typename Key>
+		void BuildHistograms(const Key* keys, size_t count, Histogram* histograms)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				const Key key = keys[i];
+				for (u32 pass = 0; pass < kNumPasses<Key>; pass++)
+				{
+					histograms[pass][Digit(key, pass)]++;
+				}
+			}
+		}
+
+		// Turns the counts into exclusive prefix sums. Returns false if every key falls in one bucket, the pass can be skipped
+		bool PrefixSum(Histogram& histogram, size_t count)
+		{
+			u32 sum = 0;
+			for (u32& bucket : histogram)
+			{
+				if (bucket == count)
+					return false;
+
+				const u32 bucketCount = bucket;
+				bucket = sum;
+				sum += bucketCount;
+			}
+			return true;
+		}
+
+		template <typename Key>
+		void Scatter(const Key* src_keys, Key* dst_keys, const u32* src_values, u32* dst_values, size_t begin, size_t end, u32 pass, Histogram& offsets)
+		{
+			for (size_t i = begin; i < end; i++)
+			{
+				const u32 pos = offsets[Digit(src_keys[i], pass)]++;
+				dst_keys[pos] = src_keys[i];
+				if (src_values) dst_values[pos] = src_values[i];
+			}
+		}
+
+		// Holds the ping-pong buffers of a sort. The sorted result ends up back in the caller's arrays
+		template <typename Key>
+		struct SortBuffers
+		{
+			SortBuffers(Key* keys, u32* values, size_t count)
+			: keys(keys), values(values), count(count)
+			{
+				const size_t scratchSize = count * sizeof(Key) + (values ? count * sizeof(u32) : 0);
+				scratch = mem::MemoryManager::allocate(scratchSize);
+				dstKeys = static_cast<Key*>(scratch);
+				dstValues = values ? reinterpret_cast<u32*>(dstKeys + count) : nullptr;
+				srcKeys = keys;
+				srcValues = values;
+			}
+
+			~SortBuffers()
+			{
+				if (srcKeys != keys)
+				{
+					std::memcpy(keys, srcKeys, count * sizeof(Key));
+					if (values) std::memcpy(values, srcValues, count * sizeof(u32));
+				}
+				mem::MemoryManager::free(scratch);
+			}
+
+			NON_COPYABLE(SortBuffers);
+
+			void Swap()
+			{
+				std::swap(srcKeys, dstKeys);
+				std::swap(srcValues, dstValues);
+			}
+
+			Key* keys;
+			u32* values;
+			size_t count;
+			void* scratch;
+
+			Key* srcKeys;
+			Key* dstKeys;
+			u32* srcValues;
+			u32* dstValues;
+		};
+
+		template <typename Key>
+		void RadixSortImpl(Key* keys, u32* values, size_t count)
+		{
+			axAssertFmt(count <= Constants::u32_MAX, "Radix sort supports at most 2^32 - 1 elements");
+
+			if (count <= kInsertionSortThreshold)
+			{
+				InsertionSort(keys, values, count);
+				return;
+			}
+
+			Histogram histograms[kNumPasses<Key>] {};
+			BuildHistograms(keys, count, histograms);
+
+			SortBuffers<Key> buffers(keys, values, count);
+			for (u32 pass = 0; pass < kNumPasses<Key>; pass++)
+			{
+				if (!PrefixSum(histograms[pass], count))
+					continue;
+
+				Scatter(buffers.srcKeys, buffers.dstKeys, buffers.srcValues, buffers.dstValues, 0, count, pass, histograms[pass]);
+				buffers.Swap();
+			}
+		}
+
+		template <typename Key>
+		struct ParallelSortContext
+		{
+			SortBuffers<Key>* buffers;
+			Histogram* chunkHistograms;
+			size_t chunkSize;
+			u32 pass;
+
+			size_t ChunkBegin(size_t chunk) const { return chunk * chunkSize; }
+			size_t ChunkEnd(size_t chunk) const { return std::min(buffers->count, (chunk + 1) * chunkSize); }
+		};
+
+		template <typename Key>
+		void CountChunks(void* ctx, size_t begin, size_t end)
+		{
+			auto& context = *static_cast<ParallelSortContext<Key>*>(ctx);
+			const Key* keys = context.buffers->srcKeys;
+			for (size_t chunk = begin; chunk < end; chunk++)
+			{
+				Histogram& histogram = context.chunkHistograms[chunk];
+				std::fill(std::begin(histogram), std::end(histogram), 0u);
+				for (size_t i = context.ChunkBegin(chunk); i < context.ChunkEnd(chunk); i++)
+				{
+					histogram[Digit(keys[i], context.pass)]++;
+				}
+			}
+		}
+
+		template <typename Key>
+		void ScatterChunks(void* ctx, size_t begin, size_t end)
+		{
+			auto& context = *static_cast<ParallelSortContext<Key>*>(ctx);
+			SortBuffers<Key>& buffers = *context.buffers;
+			for (size_t chunk = begin; chunk < end; chunk++)
+			{
+				Scatter(buffers.srcKeys, buffers.dstKeys, buffers.srcValues, buffers.dstValues,
+					context.ChunkBegin(chunk), context.ChunkEnd(chunk), context.pass, context.chunkHistograms[chunk]);
+			}
+		}
+
+		template <typename Key>
+		void ParallelRadixSortImpl(Key* keys, u32* values, size_t count, u32 num_threads)
+		{
+			if (num_threads == 0)
+			{
+				num_threads = std::max(1u, std::thread::hardware_concurrency());
+			}
+
+			const size_t numChunks = std::min<size_t>(num_threads, count / kMinParallelChunk);
+			if (numChunks <= 1)
+			{
+				RadixSortImpl(keys, values, count);
+				return;
+			}
+
+			axAssertFmt(count <= Constants::u32_MAX, "Radix sort supports at most 2^32 - 1 elements");
+
+			SortBuffers<Key> buffers(keys, values, count);
+			Histogram* chunkHistograms = static_cast<Histogram*>(mem::MemoryManager::allocate(numChunks * sizeof(Histogram)));
+
+			ParallelSortContext<Key> context { &buffers, chunkHistograms, (count + numChunks - 1) / numChunks, 0 };
+			for (u32 pass = 0; pass < kNumPasses<Key>; pass++)
+			{
+				context.pass = pass;
+				concurrency::parallelFor(numChunks, 1, static_cast<u32>(numChunks), &CountChunks<Key>, &context);
+
+				// Bucket b of chunk c starts after all smaller buckets, and after bucket b of every earlier chunk
+				bool trivialPass = false;
+				u32 sum = 0;
+				for (size_t bucket = 0; bucket < kNumBuckets && !trivialPass; bucket++)
+				{
+					const u32 bucketStart = sum;
+					for (size_t chunk = 0; chunk < numChunks; chunk++)
+					{
+						const u32 chunkCount = chunkHistograms[chunk][bucket];
+						chunkHistograms[chunk][bucket] = sum;
+						sum += chunkCount;
+					}
+					trivialPass = sum - bucketStart == count;
+				}
+				if (trivialPass)
+					continue;
+
+				concurrency::parallelFor(numChunks, 1, static_cast<u32>(numChunks), &ScatterChunks<Key>, &context);
+				buffers.Swap();
+			}
+
+			mem::MemoryManager::free(chunkHistograms);
+		}
+
+		// Maps floats to unsigned integers with the same ordering: flip every bit of negative values, only the sign of positive ones
+		u32 FloatToKey(u32 bits) { return bits ^ ((0u - (bits >> 31)) | 0x80000000u); }
+		u32 KeyToFloat(u32 bits) { return bits ^ (((bits >> 31) - 1) | 0x80000000u); }
+
+		template <bool ToKey>
+		void TransformFloats(float* data, size_t count)
+		{
+			size_t i = 0;
+
+		#if defined(__AVX2__)
+			const __m256i signBit = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+			const __m256i allOnes = _mm256_set1_epi32(-1);
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+				__m256i sign = _mm256_srai_epi32(bits, 31);
+				if constexpr (!ToKey) sign = _mm256_xor_si256(sign, allOnes);
+				const __m256i mask = _mm256_or_si256(sign, signBit);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_xor_si256(bits, mask));
+			}
+		#elif defined(APEX_ARCH_X86)
+			const __m128i signBit = _mm_set1_epi32(static_cast<int>(0x80000000u));
+			const __m128i allOnes = _mm_set1_epi32(-1);
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				__m128i sign = _mm_srai_epi32(bits, 31);
+				if constexpr (!ToKey) sign = _mm_xor_si128(sign, allOnes);
+				const __m128i mask = _mm_or_si128(sign, signBit);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_xor_si128(bits, mask));
+			}
+		#elif defined(APEX_ARCH_ARM64)
+			const uint32x4_t signBit = vdupq_n_u32(0x80000000u);
+			for (; i + 4 <= count; i += 4)
+			{
+				const uint32x4_t bits = vld1q_u32(reinterpret_cast<const uint32_t*>(data + i));
+				uint32x4_t sign = vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(bits), 31));
+				if constexpr (!ToKey) sign = vmvnq_u32(sign);
+				vst1q_u32(reinterpret_cast<uint32_t*>(data + i), veorq_u32(bits, vorrq_u32(sign, signBit)));
+			}
+		#endif
+
+			for (; i < count; i++)
+			{
+				u32 bits;
+				std::memcpy(&bits, data + i, sizeof(bits));
+				bits = ToKey ? FloatToKey(bits) : KeyToFloat(bits);
+				std::memcpy(data + i, &bits, sizeof(bits));
+			}
+		}
+
+		u32* ValuesFor(AxArrayRef<u32> values, size_t count)
+		{
+			axAssertFmt(values.size() == 0 || values.size() == count, "Values must be empty or have one entry per key");
+			return values.size() ? values.data() : nullptr;
+		}
+	}
+
+	void radixSort(AxArrayRef<u32> keys)
+	{
+		RadixSortImpl(keys.data(), nullptr, keys.size());
+	}
+
+	void radixSort(AxArrayRef<u64> keys)
+	{
+		RadixSortImpl(keys.data(), nullptr, keys.size());
+	}
+
+	void radixSort(AxArrayRef<float> keys)
+	{
+		radixSort(keys, {});
+	}
+
+	void radixSort(AxArrayRef<u32> keys, AxArrayRef<u32> values)
+	{
+		RadixSortImpl(keys.data(), ValuesFor(values, keys.size()), keys.size());
+	}
+
+	void radixSort(AxArrayRef<u64> keys, AxArrayRef<u32> values)
+	{
+		RadixSortImpl(keys.data(), ValuesFor(values, keys.size()), keys.size());
+	}
+
+	void radixSort(AxArrayRef<float> keys, AxArrayRef<u32> values)
+	{
+		TransformFloats<true>(keys.data(), keys.size());
+		RadixSortImpl(reinterpret_cast<u32*>(keys.data()), ValuesFor(values, keys.size()), keys.size());
+		TransformFloats<false>(keys.data(), keys.size());
+	}
+
+	void parallelRadixSort(AxArrayRef<u32> keys, AxArrayRef<u32> values, u32 num_threads)
+	{
+		ParallelRadixSortImpl(keys.data(), ValuesFor(values, keys.size()), keys.size(), num_threads);
+	}
+
+	void parallelRadixSort(AxArrayRef<u64> keys, AxArrayRef<u32> values, u32 num_threads)
+	{
+		ParallelRadixSortImpl(keys.data(), ValuesFor(values, keys.size()), keys.size(), num_threads);
+	}
+
+	void parallelRadixSort(AxArrayRef<float> keys, AxArrayRef<u32> values, u32 num_threads)
+	{
+		TransformFloats<true>(keys.data(), keys.size());
+		ParallelRadixSortImpl(reinterpret_cast<u32*>(keys.data()), ValuesFor(values, keys.size()), keys.size(), num_threads);
+		TransformFloats<false>(keys.data(), keys.size());
+	}
+
+}
@@ -1,101 +1,122 @@
 ﻿#include "Math/Random.h"
 
 #include "Core/Asserts.h"
+#include "Core/CpuInfo.h"
+#include "Core/Platform.h"
+#include "Math/Vector2.h"
 #include "Math/Vector3.h"
 #include "Math/Vector4.h"
 
+#include <atomic>
+#include <cstring>
+#include <ctime>
 #include <random>
 
-namespace apex::math {
+#if defined(APEX_ARCH_ARM64)
+#	include <arm_neon.h>
+#endif
 
-	using mt_engine = std::mt19937;
+namespace apex::math {
 
 	namespace detail
 	{
-		static mt_engine s_engine;
-		static std::uniform_int_distribution<mt_engine::result_type> s_distribution;
+		// Seed of the thread local streams, and the index handed to the next thread that creates one
+		static std::atomic<u64> s_rootSeed { 0x853c49e6748fea9bull };
+		static std::atomic<u64> s_nextStreamIndex {};
+
+		inline f32 toUnitFloat32(u32 bits)
+		{
+			// The top 24 bits fit the mantissa exactly
+			return static_cast<f32>(bits >> 8) * 0x1p-24f;
+		}
+
+		inline s32 toRange(u32 bits, s32 min, s32 max)
+		{
+			// Unsigned arithmetic, max - min overflows s32 for ranges wider than half the type
+			const u64 range = static_cast<u32>(max) - static_cast<u32>(min);
+			const u32 offset = static_cast<u32>((bits * range) >> 32);
+			return static_cast<s32>(static_cast<u32>(min) + offset);
+		}
 	}
 
 	#pragma region SlowRandom implementation
 
-	inline void Random::init()
+	void Random::init()
 	{
+		u64 seed;
 		if (std::random_device().entropy() > 0)
 		{
-			detail::s_engine.seed(std::random_device()());
+			std::random_device device;
+			seed = (static_cast<u64>(device()) << 32) | device();
 		}
 		else
 		{
 			axWarn("True random device NOT available");
-			detail::s_engine.seed(static_cast<mt_engine::result_type>(std::time(nullptr)));
+			seed = static_cast<u64>(std::time(nullptr));
 		}
+
+		detail::s_rootSeed.store(seed, std::memory_order_relaxed);
+		RandomStream::threadLocal() = RandomStream(seed, detail::s_nextStreamIndex.fetch_add(1, std::memory_order_relaxed));
 	}
 
-	inline s32 Random::randomInt32()
+	s32 Random::randomInt32()
 	{
-		return static_cast<s32>(detail::s_distribution(detail::s_engine));
+		return static_cast<s32>(RandomStream::threadLocal().nextU32());
 	}
 
-	inline f32 Random::randomFloat32()
+	f32 Random::randomFloat32()
 	{
-		return static_cast<f32>(detail::s_distribution(detail::s_engine)) / static_cast<f32>(detail::s_distribution.max());
+		return RandomStream::threadLocal().nextFloat32();
 	}
 
 	Vector2 Random::randomVector2()
 	{
-		return { randomFloat32(), randomFloat32() };
+		return RandomStream::threadLocal().nextVector2(0.f, 1.f);
 	}
 
 	Vector3 Random::randomVector3()
 	{
-		return { randomFloat32(), randomFloat32(), randomFloat32() };
+		return RandomStream::threadLocal().nextVector3(0.f, 1.f);
 	}
 
 	Vector4 Random::randomVector4()
 	{
-		return { randomFloat32(), randomFloat32(), randomFloat32(), randomFloat32() };
+		return RandomStream::threadLocal().nextVector4(0.f, 1.f);
 	}
 
 	Vector3 Random::randomUnitSphereVector3()
 	{
-		while (true)
-		{
-			Vector3 p = randomVector3(-1, 1);
-			if (p.lengthSquared() >= 1) continue;
-			return p;
-		}
+		return RandomStream::threadLocal().nextUnitSphereVector3();
 	}
 
 	Vector3 Random::randomUnitVector3()
 	{
-		return randomUnitSphereVector3().normalize_();
+		return RandomStream::threadLocal().nextUnitVector3();
 	}
 
-	inline s32 Random::randomInt32(s32 min, s32 max)
+	s32 Random::randomInt32(s32 min, s32 max)
 	{
-		axAssert(min < max);
-		return min + randomInt32() % (max - min);
+		return RandomStream::threadLocal().nextInt32(min, max);
 	}
 
-	inline f32 Random::randomFloat32(f32 min, f32 max)
+	f32 Random::randomFloat32(f32 min, f32 max)
 	{
-		axAssert(min < max);
-		return min + randomFloat32() * (max - min);
+		return RandomStream::threadLocal().nextFloat32(min, max);
 	}
 
 	Vector2 Random::randomVector2(f32 min, f32 max)
 	{
-		return { randomFloat32(min, max), randomFloat32(min, max) };
+		return RandomStream::threadLocal().nextVector2(min, max);
 	}
 
 	Vector3 Random::randomVector3(f32 min, f32 max)
 	{
-		return { randomFloat32(min, max), randomFloat32(min, max), randomFloat32(min, max) };
+		return RandomStream::threadLocal().nextVector3(min, max);
 	}
 
 	Vector4 Random::randomVector4(f32 min, f32 max)
 	{
-		return { randomFloat32(min, max), randomFloat32(min, max), randomFloat32(min, max), randomFloat32(min, max) };
+		return RandomStream::threadLocal().nextVector4(min, max);
 	}
 
 #pragma endregion
@@ -110,39 +131,47 @@ namespace apex::math {
 		    u32 word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
 		    return (word >> 22u) ^ word;
 		}
+
+		// Vector components hash the previous component's hash, hashing the same seed again would make them all equal
+		inline f32 nextHashFloat32(u32& hash, f32 min, f32 max)
+		{
+			hash = pcg_hash(hash);
+			return min + toUnitFloat32(hash) * (max - min);
+		}
 	}
 
-	inline s32 FastRandom::randomInt32(u32 seed)
+	s32 FastRandom::randomInt32(u32 seed)
 	{
 		return static_cast<s32>(detail::pcg_hash(seed));
 	}
 	
-	inline f32 FastRandom::randomFloat32(u32 seed)
+	f32 FastRandom::randomFloat32(u32 seed)
 	{
-		return static_cast<f32>(detail::pcg_hash(seed));
+		return detail::toUnitFloat32(detail::pcg_hash(seed));
 	}
 
 	Vector2 FastRandom::randomVector2(u32 seed)
 	{
-		return { randomFloat32(seed), randomFloat32(seed) };
+		return randomVector2(seed, 0.f, 1.f);
 	}
 
 	Vector3 FastRandom::randomVector3(u32 seed)
 	{
-		return { randomFloat32(seed), randomFloat32(seed), randomFloat32(seed) };
+		return randomVector3(seed, 0.f, 1.f);
 	}
 
 	Vector4 FastRandom::randomVector4(u32 seed)
 	{
-		return { randomFloat32(seed), randomFloat32(seed), randomFloat32(seed), randomFloat32(seed) };
+		return randomVector4(seed, 0.f, 1.f);
 	}
 
 	Vector3 FastRandom::randomUnitSphereVector3(u32 seed)
 	{
+		u32 hash = seed;
 		while (true)
 		{
-			Vector3 p = randomVector3(seed, -1, 1);
-			if (p.lengthSquared() >= 1) continue;
+			Vector3 p { detail::nextHashFloat32(hash, -1.f, 1.f), detail::nextHashFloat32(hash, -1.f, 1.f), detail::nextHashFloat32(hash, -1.f, 1.f) };
+			if (p.lengthSquared() >= 1 || p.lengthSquared() == 0) continue;
 			return p;
 		}
 	}
@@ -152,13 +181,13 @@ namespace apex::math {
 		return randomUnitSphereVector3(seed).normalize_();
 	}
 
-	inline s32 FastRandom::randomInt32(u32 seed, s32 min, s32 max)
+	s32 FastRandom::randomInt32(u32 seed, s32 min, s32 max)
 	{
 		axAssert(min < max);
-		return min + randomInt32(seed) % (max - min);
+		return detail::toRange(detail::pcg_hash(seed), min, max);
 	}
 
-	inline f32 FastRandom::randomFloat32(u32 seed, f32 min, f32 max)
+	f32 FastRandom::randomFloat32(u32 seed, f32 min, f32 max)
 	{
 		axAssert(min < max);
 		return min + randomFloat32(seed) * (max - min);
@@ -166,16 +195,499 @@ namespace apex::math {
 
 	Vector2 FastRandom::randomVector2(u32 seed, f32 min, f32 max)
 	{
-		return { randomFloat32(seed, min, max), randomFloat32(seed, min, max) };
+		u32 hash = seed;
+		return { detail::nextHashFloat32(hash, min, max), detail::nextHashFloat32(hash, min, max) };
 	}
 
 	Vector3 FastRandom::randomVector3(u32 seed, f32 min, f32 max)
 	{
-		return { randomFloat32(seed, min, max), randomFloat32(seed, min, max), randomFloat32(seed, min, max) };
+		u32 hash = seed;
+		return { detail::nextHashFloat32(hash, min, max), detail::nextHashFloat32(hash, min, max), detail::nextHashFloat32(hash, min, max) };
 	}
 
 	Vector4 FastRandom::randomVector4(u32 seed, f32 min, f32 max)
 	{
-		return { randomFloat32(seed, min, max), randomFloat32(seed, min, max), randomFloat32(seed, min, max), randomFloat32(seed, min, max) };
+		u32 hash = seed;
+		return { detail::nextHashFloat32(hash, min, max), detail::nextHashFloat32(hash, min, max), detail::nextHashFloat32(hash, min, max), detail::nextHashFloat32(hash, min, max) };
 	}
+
+#pragma endregion
+
+	#pragma region RandomStream implementation
+
+	namespace
+	{
+		constexpr size_t kLanes = RandomStream::kLanes;
+
+		// Writes blocks * kLanes outputs, lane by lane within each block. Floats are unit * scale + min
+		using GenerateU32Fn = void (*)(u32 (*state)[kLanes], u32* out, size_t blocks);
+		using GenerateFloat32Fn = void (*)(u32 (*state)[kLanes], f32* out, size_t blocks, f32 min, f32 scale);
+
+		struct Kernels
+		{
+			GenerateU32Fn     generateU32;
+			GenerateFloat32Fn generateFloat32;
+		};
+
+		inline u32 Rotl(u32 x, int k)
+		{
+			return (x << k) | (x >> (32 - k));
+		}
+
+		// One xoshiro128** step of every lane
+		inline void StepGeneric(u32 (*state)[kLanes], u32 (&result)[kLanes])
+		{
+			for (size_t lane = 0; lane < kLanes; lane++)
+			{
+				u32& s0 = state[0][lane];
+				u32& s1 = state[1][lane];
+				u32& s2 = state[2][lane];
+				u32& s3 = state[3][lane];
+
+				result[lane] = Rotl(s1 * 5, 7) * 9;
+				const u32 t = s1 << 9;
+				s2 ^= s0;
+				s3 ^= s1;
+				s1 ^= s2;
+				s0 ^= s3;
+				s2 ^= t;
+				s3 = Rotl(s3, 11);
+			}
+		}
+
+		void GenerateU32Generic(u32 (*state)[kLanes], u32* out, size_t blocks)
+		{
+			for (size_t b = 0; b < blocks; b++)
+			{
+				u32 result[kLanes];
+				StepGeneric(state, result);
+				for (size_t lane = 0; lane < kLanes; lane++)
+				{
+					out[b * kLanes + lane] = result[lane];
+				}
+			}
+		}
+
+		void GenerateFloat32Generic(u32 (*state)[kLanes], f32* out, size_t blocks, f32 min, f32 scale)
+		{
+			for (size_t b = 0; b < blocks; b++)
+			{
+				u32 result[kLanes];
+				StepGeneric(state, result);
+				for (size_t lane = 0; lane < kLanes; lane++)
+				{
+					out[b * kLanes + lane] = detail::toUnitFloat32(result[lane]) * scale + min;
+				}
+			}
+		}
+
+	#if defined(APEX_ARCH_X86)
+
+		/**************************************************************
+		 * AVX2 : 16 lanes as two registers per state word
+		 *************************************************************/
+
+		template <int K>
+		APEX_TARGET_AVX2 inline __m256i RotlAVX2(__m256i x)
+		{
+			return _mm256_or_si256(_mm256_slli_epi32(x, K), _mm256_srli_epi32(x, 32 - K));
+		}
+
+		// Multiplications by 5 and 9 as shifts and adds, which are cheaper than _mm256_mullo_epi32
+		APEX_TARGET_AVX2 inline __m256i StepAVX2(__m256i (&s)[4])
+		{
+			const __m256i s1x5 = _mm256_add_epi32(_mm256_slli_epi32(s[1], 2), s[1]);
+			const __m256i r = RotlAVX2<7>(s1x5);
+			const __m256i result = _mm256_add_epi32(_mm256_slli_epi32(r, 3), r);
+
+			const __m256i t = _mm256_slli_epi32(s[1], 9);
+			s[2] = _mm256_xor_si256(s[2], s[0]);
+			s[3] = _mm256_xor_si256(s[3], s[1]);
+			s[1] = _mm256_xor_si256(s[1], s[2]);
+			s[0] = _mm256_xor_si256(s[0], s[3]);
+			s[2] = _mm256_xor_si256(s[2], t);
+			s[3] = RotlAVX2<11>(s[3]);
+			return result;
+		}
+
+		APEX_TARGET_AVX2 inline void LoadStateAVX2(u32 (*state)[kLanes], __m256i (&lo)[4], __m256i (&hi)[4])
+		{
+			for (size_t w = 0; w < 4; w++)
+			{
+				lo[w] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[w]));
+				hi[w] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[w] + 8));
+			}
+		}
+
+		APEX_TARGET_AVX2 inline void StoreStateAVX2(u32 (*state)[kLanes], __m256i (&lo)[4], __m256i (&hi)[4])
+		{
+			for (size_t w = 0; w < 4; w++)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[w]), lo[w]);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(state[w] + 8), hi[w]);
+			}
+		}
+
+		APEX_TARGET_AVX2 inline __m256 ToFloatAVX2(__m256i bits, __m256 min, __m256 scale)
+		{
+			const __m256 unit = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8)), _mm256_set1_ps(0x1p-24f));
+			return _mm256_add_ps(_mm256_mul_ps(unit, scale), min);
+		}
+
+		APEX_TARGET_AVX2 void GenerateU32AVX2(u32 (*state)[kLanes], u32* out, size_t blocks)
+		{
+			__m256i lo[4], hi[4];
+			LoadStateAVX2(state, lo, hi);
+			for (size_t b = 0; b < blocks; b++)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + b * kLanes), StepAVX2(lo));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + b * kLanes + 8), StepAVX2(hi));
+			}
+			StoreStateAVX2(state, lo, hi);
+		}
+
+		APEX_TARGET_AVX2 void GenerateFloat32AVX2(u32 (*state)[kLanes], f32* out, size_t blocks, f32 min, f32 scale)
+		{
+			const __m256 vmin = _mm256_set1_ps(min);
+			const __m256 vscale = _mm256_set1_ps(scale);
+
+			__m256i lo[4], hi[4];
+			LoadStateAVX2(state, lo, hi);
+			for (size_t b = 0; b < blocks; b++)
+			{
+				_mm256_storeu_ps(out + b * kLanes, ToFloatAVX2(StepAVX2(lo), vmin, vscale));
+				_mm256_storeu_ps(out + b * kLanes + 8, ToFloatAVX2(StepAVX2(hi), vmin, vscale));
+			}
+			StoreStateAVX2(state, lo, hi);
+		}
+
+		/**************************************************************
+		 * AVX-512 : 16 lanes as one register per state word
+		 *************************************************************/
+
+		APEX_TARGET_AVX512 inline __m512i StepAVX512(__m512i (&s)[4])
+		{
+			const __m512i s1x5 = _mm512_add_epi32(_mm512_slli_epi32(s[1], 2), s[1]);
+			const __m512i r = _mm512_rol_epi32(s1x5, 7);
+			const __m512i result = _mm512_add_epi32(_mm512_slli_epi32(r, 3), r);
+
+			const __m512i t = _mm512_slli_epi32(s[1], 9);
+			s[2] = _mm512_xor_si512(s[2], s[0]);
+			s[3] = _mm512_xor_si512(s[3], s[1]);
+			s[1] = _mm512_xor_si512(s[1], s[2]);
+			s[0] = _mm512_xor_si512(s[0], s[3]);
+			s[2] = _mm512_xor_si512(s[2], t);
+			s[3] = _mm512_rol_epi32(s[3], 11);
+			return result;
+		}
+
+		APEX_TARGET_AVX512 void GenerateU32AVX512(u32 (*state)[kLanes], u32* out, size_t blocks)
+		{
+			__m512i s[4];
+			for (size_t w = 0; w < 4; w++)
+				s[w] = _mm512_loadu_si512(state[w]);
+
+			for (size_t b = 0; b < blocks; b++)
+			{
+				_mm512_storeu_si512(out + b * kLanes, StepAVX512(s));
+			}
+
+			for (size_t w = 0; w < 4; w++)
+				_mm512_storeu_si512(state[w], s[w]);
+		}
+
+		APEX_TARGET_AVX512 void GenerateFloat32AVX512(u32 (*state)[kLanes], f32* out, size_t blocks, f32 min, f32 scale)
+		{
+			const __m512 vmin = _mm512_set1_ps(min);
+			const __m512 vscale = _mm512_set1_ps(scale);
+			const __m512 unitScale = _mm512_set1_ps(0x1p-24f);
+
+			__m512i s[4];
+			for (size_t w = 0; w < 4; w++)
+				s[w] = _mm512_loadu_si512(state[w]);
+
+			for (size_t b = 0; b < blocks; b++)
+			{
+				const __m512 unit = _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(StepAVX512(s), 8)), unitScale);
+				_mm512_storeu_ps(out + b * kLanes, _mm512_add_ps(_mm512_mul_ps(unit, vscale), vmin));
+			}
+
+			for (size_t w = 0; w < 4; w++)
+				_mm512_storeu_si512(state[w], s[w]);
+		}
+
+	#elif defined(APEX_ARCH_ARM64)
+
+		/**************************************************************
+		 * NEON : 16 lanes as four registers per state word
+		 *************************************************************/
+
+		template <int K>
+		inline uint32x4_t RotlNEON(uint32x4_t x)
+		{
+			return vsriq_n_u32(vshlq_n_u32(x, K), x, 32 - K);
+		}
+
+		inline uint32x4_t StepNEON(uint32x4_t (&s)[4])
+		{
+			const uint32x4_t r = RotlNEON<7>(vmulq_n_u32(s[1], 5));
+			const uint32x4_t result = vmulq_n_u32(r, 9);
+
+			const uint32x4_t t = vshlq_n_u32(s[1], 9);
+			s[2] = veorq_u32(s[2], s[0]);
+			s[3] = veorq_u32(s[3], s[1]);
+			s[1] = veorq_u32(s[1], s[2]);
+			s[0] = veorq_u32(s[0], s[3]);
+			s[2] = veorq_u32(s[2], t);
+			s[3] = RotlNEON<11>(s[3]);
+			return result;
+		}
+
+		template <typename Store>
+		inline void GenerateNEON(u32 (*state)[kLanes], size_t blocks, Store store)
+		{
+			uint32x4_t s[4][4];
+			for (size_t w = 0; w < 4; w++)
+				for (size_t q = 0; q < 4; q++)
+					s[q][w] = vld1q_u32(state[w] + 4 * q);
+
+			for (size_t b = 0; b < blocks; b++)
+				for (size_t q = 0; q < 4; q++)
+					store(b * kLanes + 4 * q, StepNEON(s[q]));
+
+			for (size_t w = 0; w < 4; w++)
+				for (size_t q = 0; q < 4; q++)
+					vst1q_u32(state[w] + 4 * q, s[q][w]);
+		}
+
+		void GenerateU32NEON(u32 (*state)[kLanes], u32* out, size_t blocks)
+		{
+			GenerateNEON(state, blocks, [out](size_t i, uint32x4_t v) { vst1q_u32(out + i, v); });
+		}
+
+		void GenerateFloat32NEON(u32 (*state)[kLanes], f32* out, size_t blocks, f32 min, f32 scale)
+		{
+			const float32x4_t vmin = vdupq_n_f32(min);
+			const float32x4_t vscale = vdupq_n_f32(scale);
+			GenerateNEON(state, blocks, [=](size_t i, uint32x4_t v)
+			{
+				const float32x4_t unit = vmulq_n_f32(vcvtq_f32_u32(vshrq_n_u32(v, 8)), 0x1p-24f);
+				vst1q_f32(out + i, vaddq_f32(vmulq_f32(unit, vscale), vmin));
+			});
+		}
+
+	#endif
+
+		Kernels SelectKernels()
+		{
+		#if defined(APEX_ARCH_X86)
+			switch (CpuInfo::GetSimdLevel())
+			{
+			case SimdLevel::eAVX512: return { GenerateU32AVX512, GenerateFloat32AVX512 };
+			case SimdLevel::eAVX2:   return { GenerateU32AVX2, GenerateFloat32AVX2 };
+			default:                 break;
+			}
+		#elif defined(APEX_ARCH_ARM64)
+			return { GenerateU32NEON, GenerateFloat32NEON };
+		#endif
+			return { GenerateU32Generic, GenerateFloat32Generic };
+		}
+
+		Kernels const& GetKernels()
+		{
+			static const Kernels kernels = SelectKernels();
+			return kernels;
+		}
+
+		u64 SplitMix64(u64& state)
+		{
+			u64 z = (state += 0x9e3779b97f4a7c15ull);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+			return z ^ (z >> 31);
+		}
+	}
+
+	RandomStream::RandomStream(u64 seed, u64 stream_index)
+	{
+		// Every lane gets its own splitmix64 seed, as recommended for the xoshiro generators
+		u64 index = stream_index;
+		u64 mix = seed ^ SplitMix64(index);
+		for (size_t lane = 0; lane < kLanes; lane++)
+		{
+			const u64 a = SplitMix64(mix);
+			const u64 b = SplitMix64(mix);
+			m_state[0][lane] = static_cast<u32>(a);
+			m_state[1][lane] = static_cast<u32>(a >> 32);
+			m_state[2][lane] = static_cast<u32>(b);
+			m_state[3][lane] = static_cast<u32>(b >> 32) | (a == 0 && b == 0); // the all zero state never leaves 0
+		}
+	}
+
+	RandomStream& RandomStream::threadLocal()
+	{
+		thread_local RandomStream t_stream {
+			detail::s_rootSeed.load(std::memory_order_relaxed),
+			detail::s_nextStreamIndex.fetch_add(1, std::memory_order_relaxed)
+		};
+		return t_stream;
+	}
+
+	RandomStream RandomStream::split()
+	{
+		RandomStream child = *this;
+		LongJump();
+		return child;
+	}
+
+	void RandomStream::jump()
+	{
+		static constexpr u32 kJump[4] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+		ApplyJump(kJump);
+	}
+
+	void RandomStream::LongJump()
+	{
+		static constexpr u32 kLongJump[4] = { 0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662 };
+		ApplyJump(kLongJump);
+	}
+
+	void RandomStream::ApplyJump(const u32 (&polynomial)[4])
+	{
+		u32 jumped[4][kLanes] {};
+		for (u32 word : polynomial)
+		{
+			for (u32 bit = 0; bit < 32; bit++)
+			{
+				if (word & (1u << bit))
+				{
+					for (size_t w = 0; w < 4; w++)
+						for (size_t lane = 0; lane < kLanes; lane++)
+							jumped[w][lane] ^= m_state[w][lane];
+				}
+
+				u32 discard[kLanes];
+				StepGeneric(m_state, discard);
+			}
+		}
+
+		memcpy(m_state, jumped, sizeof(m_state));
+		m_bufferPos = kLanes;
+	}
+
+	void RandomStream::Refill()
+	{
+		GetKernels().generateU32(m_state, m_buffer, 1);
+		m_bufferPos = 0;
+	}
+
+	u32 RandomStream::nextU32()
+	{
+		if (m_bufferPos == kLanes)
+			Refill();
+		return m_buffer[m_bufferPos++];
+	}
+
+	f32 RandomStream::nextFloat32()
+	{
+		return detail::toUnitFloat32(nextU32());
+	}
+
+	f32 RandomStream::nextFloat32(f32 min, f32 max)
+	{
+		axAssert(min < max);
+		return detail::toUnitFloat32(nextU32()) * (max - min) + min;
+	}
+
+	s32 RandomStream::nextInt32(s32 min, s32 max)
+	{
+		axAssert(min < max);
+		return detail::toRange(nextU32(), min, max);
+	}
+
+	Vector2 RandomStream::nextVector2(f32 min, f32 max)
+	{
+		return { nextFloat32(min, max), nextFloat32(min, max) };
+	}
+
+	Vector3 RandomStream::nextVector3(f32 min, f32 max)
+	{
+		return { nextFloat32(min, max), nextFloat32(min, max), nextFloat32(min, max) };
+	}
+
+	Vector4 RandomStream::nextVector4(f32 min, f32 max)
+	{
+		return { nextFloat32(min, max), nextFloat32(min, max), nextFloat32(min, max), nextFloat32(min, max) };
+	}
+
+	Vector3 RandomStream::nextUnitSphereVector3()
+	{
+		while (true)
+		{
+			Vector3 p = nextVector3(-1.f, 1.f);
+			if (p.lengthSquared() >= 1 || p.lengthSquared() == 0) continue;
+			return p;
+		}
+	}
+
+	Vector3 RandomStream::nextUnitVector3()
+	{
+		return nextUnitSphereVector3().normalize_();
+	}
+
+	void RandomStream::fillU32(AxArrayRef<u32> out)
+	{
+		u32* dst = out.data();
+		size_t count = out.size();
+
+		// Values left over from single draws come first, so the sequence does not depend on how it is consumed
+		for (; count > 0 && m_bufferPos < kLanes; count--)
+		{
+			*dst++ = m_buffer[m_bufferPos++];
+		}
+
+		const size_t blocks = count / kLanes;
+		GetKernels().generateU32(m_state, dst, blocks);
+		dst += blocks * kLanes;
+		count -= blocks * kLanes;
+
+		for (; count > 0; count--)
+		{
+			*dst++ = nextU32();
+		}
+	}
+
+	void RandomStream::fillFloat32(AxArrayRef<f32> out, f32 min, f32 max)
+	{
+		axAssert(min < max);
+		f32* dst = out.data();
+		size_t count = out.size();
+
+		for (; count > 0 && m_bufferPos < kLanes; count--)
+		{
+			*dst++ = nextFloat32(min, max);
+		}
+
+		const size_t blocks = count / kLanes;
+		GetKernels().generateFloat32(m_state, dst, blocks, min, max - min);
+		dst += blocks * kLanes;
+		count -= blocks * kLanes;
+
+		for (; count > 0; count--)
+		{
+			*dst++ = nextFloat32(min, max);
+		}
+	}
+
+	void RandomStream::fillVector3(AxArrayRef<Vector3> out, f32 min, f32 max)
+	{
+		fillFloat32({ reinterpret_cast<f32*>(out.data()), out.size() * 3 }, min, max);
+	}
+
+	void RandomStream::fillVector4(AxArrayRef<Vector4> out, f32 min, f32 max)
+	{
+		fillFloat32({ reinterpret_cast<f32*>(out.data()), out.size() * 4 }, min, max);
+	}
+
+#pragma endregion
 }
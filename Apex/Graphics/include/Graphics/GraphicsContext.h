@@ -9,6 +9,7 @@
 // ApexGraphics includes
 #include "Factory.h"
 #include "Containers/AxArray.h"
+#include "Containers/AxSmallArray.h"
 #include "Math/Vector4.h"
 
 namespace apex::plat
@@ -116,7 +117,7 @@ namespace gfx {
 
 		virtual CommandBuffer* AllocateCommandBuffer(QueueType queue, u32 frame, u32 thread) const = 0;
 
-		virtual AxArray<DescriptorSet> AllocateDescriptorSets(GraphicsPipeline* pipeline) const = 0;
+		virtual AxSmallArray<DescriptorSet, 4> AllocateDescriptorSets(GraphicsPipeline* pipeline) const = 0;
 		virtual void UpdateDescriptorSet(DescriptorSet const& descriptor_set) const = 0;
 		virtual void BindSampledImage(ImageView* image_view) = 0;
 		virtual void BindStorageImage(ImageView* image_view) = 0;
@@ -319,12 +320,6 @@ namespace gfx {
 
 		void Add(Descriptor const& descriptor)
 		{
-			if (m_descriptors.capacity() == 0)
-				m_descriptors.reserve(2);
-
-			if (m_descriptors.capacity() < m_descriptors.size() + 1)
-				m_descriptors.reserve(m_descriptors.capacity() * 2);
-
 			m_descriptors.append(descriptor);
 		}
 		void Clear() { m_descriptors.clear(); }
@@ -7,6 +7,8 @@
 #include <vma.h>
 
 #include "Containers/AxArray.h"
+#include "Containers/AxSmallArray.h"
+#include "Containers/AxStaticArray.h"
 #include "Graphics/GraphicsContext.h"
 
 namespace apex::plat
@@ -177,7 +179,7 @@ namespace gfx {
 		VmaAllocation       m_allocation;
 		VmaAllocationInfo   m_allocationInfo;
 		VkBufferUsageFlags	m_usage;
-		u32					m_bindlessIndices[2] { (u32)-1, (u32)-1 }; // 0 - UniformBuffer, 1 - StorageBuffer
+		AxStaticArray<u32, 2>	m_bindlessIndices { (u32)-1, (u32)-1 }; // 0 - UniformBuffer, 1 - StorageBuffer
 
 		friend class VulkanDevice;
 	};
@@ -268,7 +270,7 @@ namespace gfx {
 	private:
 		VkImageView         m_view;
 		VulkanImage*        m_owner;
-		u32					m_bindlessIndices[2] { (u32)-1, (u32)-1 }; // 0 - SampledImage, 1 - StorageImage
+		AxStaticArray<u32, 2>	m_bindlessIndices { (u32)-1, (u32)-1 }; // 0 - SampledImage, 1 - StorageImage
 
 		friend class VulkanDevice;
 		friend class VulkanImage;
@@ -314,9 +316,9 @@ namespace gfx {
         {
         }
 
-        VulkanGraphicsPipeline(VulkanDevice const* device, VkPipeline pipeline, VkPipelineLayout pipelineLayout, AxArray<VkDescriptorSetLayout> const& descriptorSetLayouts)
+        VulkanGraphicsPipeline(VulkanDevice const* device, VkPipeline pipeline, VkPipelineLayout pipelineLayout, AxSmallArray<VkDescriptorSetLayout, 4> descriptorSetLayouts)
 	        : m_device(device), m_pipeline(pipeline), m_pipelineLayout(pipelineLayout),
-	          m_descriptorSetLayouts(descriptorSetLayouts)
+	          m_descriptorSetLayouts(std::move(descriptorSetLayouts))
         {
         }
 
@@ -326,13 +328,13 @@ namespace gfx {
 
 		VkPipeline GetNativeHandle() const { return m_pipeline; }
 		VkPipelineLayout GetPipelineLayout() const { return m_pipelineLayout; }
-		AxArray<VkDescriptorSetLayout> const& GetDescriptorSetLayouts() const { return m_descriptorSetLayouts; }
+		AxSmallArray<VkDescriptorSetLayout, 4> const& GetDescriptorSetLayouts() const { return m_descriptorSetLayouts; }
 
     private:
 		VulkanDevice const*            m_device {};
         VkPipeline                     m_pipeline {};
         VkPipelineLayout               m_pipelineLayout {};
-        AxArray<VkDescriptorSetLayout> m_descriptorSetLayouts;
+        AxSmallArray<VkDescriptorSetLayout, 4> m_descriptorSetLayouts;
 
         friend class VulkanDevice;
     };
@@ -349,9 +351,9 @@ namespace gfx {
         {
         }
 
-		VulkanComputePipeline(VulkanDevice const* device, VkPipeline pipeline, VkPipelineLayout pipelineLayout, AxArray<VkDescriptorSetLayout> const& descriptorSetLayouts)
+		VulkanComputePipeline(VulkanDevice const* device, VkPipeline pipeline, VkPipelineLayout pipelineLayout, AxSmallArray<VkDescriptorSetLayout, 4> descriptorSetLayouts)
 	        : m_device(device), m_pipeline(pipeline), m_pipelineLayout(pipelineLayout),
-	          m_descriptorSetLayouts(descriptorSetLayouts)
+	          m_descriptorSetLayouts(std::move(descriptorSetLayouts))
         {
         }
 
@@ -361,13 +363,13 @@ namespace gfx {
 
 		VkPipeline GetNativeHandle() const { return m_pipeline; }
 		VkPipelineLayout GetPipelineLayout() const { return m_pipelineLayout; }
-		AxArray<VkDescriptorSetLayout> const& GetDescriptorSetLayouts() const { return m_descriptorSetLayouts; }
+		AxSmallArray<VkDescriptorSetLayout, 4> const& GetDescriptorSetLayouts() const { return m_descriptorSetLayouts; }
 
 	private:
 		VulkanDevice const*            m_device {};
         VkPipeline                     m_pipeline {};
         VkPipelineLayout               m_pipelineLayout {};
-        AxArray<VkDescriptorSetLayout> m_descriptorSetLayouts;
+        AxSmallArray<VkDescriptorSetLayout, 4> m_descriptorSetLayouts;
 
 		friend class VulkanDevice;
 	};
@@ -512,7 +514,7 @@ namespace gfx {
 		//void SubmitImmediateCommandBuffer(QueueType queue, CommandBuffer* command_buffer) const override;
 		//void Submit(QueueType queue, AxArrayRef<CommandBuffer> command_buffers) const;
 
-		AxArray<DescriptorSet> AllocateDescriptorSets(GraphicsPipeline* pipeline) const override;
+		AxSmallArray<DescriptorSet, 4> AllocateDescriptorSets(GraphicsPipeline* pipeline) const override;
 		void UpdateDescriptorSet(DescriptorSet const& descriptor_set) const override;
 
 		ShaderModule* CreateShaderModule(const char* name, const char* filepath) const override;
@@ -920,7 +920,7 @@ namespace apex::gfx {
 		vkDeviceWaitIdle(m_logicalDevice);
 	}
 
-	AxArray<DescriptorSet> VulkanDevice::AllocateDescriptorSets(GraphicsPipeline* pipeline) const
+	AxSmallArray<DescriptorSet, 4> VulkanDevice::AllocateDescriptorSets(GraphicsPipeline* pipeline) const
 	{
 	#if GFX_USE_BINDLESS_DESCRIPTORS
 		return {};
@@ -934,11 +934,11 @@ namespace apex::gfx {
 			.pSetLayouts = vkpipeline->m_descriptorSetLayouts.data(),
 		};
 
-		AxArray<VkDescriptorSet> vkDescriptorSets;
+		AxSmallArray<VkDescriptorSet, 4> vkDescriptorSets;
 		vkDescriptorSets.resize(vkpipeline->m_descriptorSetLayouts.size());
 		vkAllocateDescriptorSets(m_logicalDevice, &allocateInfo, vkDescriptorSets.dataMutable());
 
-		AxArray<DescriptorSet> descriptorSets(vkDescriptorSets.size());
+		AxSmallArray<DescriptorSet, 4> descriptorSets(vkDescriptorSets.size());
 		for (VkDescriptorSet vkDescriptorSet : vkDescriptorSets)
 		{
 			descriptorSets.emplace_back(vkDescriptorSet);
@@ -1144,7 +1144,7 @@ namespace apex::gfx {
 	#if GFX_USE_BINDLESS_DESCRIPTORS
 		VkPipelineLayout pipelineLayout = m_bindlessPipelineLayout;
 	#else
-		AxArray<VkDescriptorSetLayout> descriptorSetLayouts;
+		AxSmallArray<VkDescriptorSetLayout, 4> descriptorSetLayouts;
 		descriptorSetLayouts.reserve(1 + vertexModule->m_reflect.descriptor_set_count + fragmentModule->m_reflect.descriptor_set_count);
 		for (u32 i = 0; i < vertexModule->m_reflect.descriptor_set_count; i++)
 		{
@@ -1229,7 +1229,7 @@ namespace apex::gfx {
 		return apex_new VulkanGraphicsPipeline(this, pipeline, pipelineLayout
 	#if GFX_USE_BINDLESS_DESCRIPTORS
 	#else
-			, descriptorSetLayouts
+			, std::move(descriptorSetLayouts)
 	#endif
 			);
 	}
@@ -1263,7 +1263,7 @@ namespace apex::gfx {
 		return apex_new VulkanComputePipeline(this, pipeline, pipelineLayout
 	#if GFX_USE_BINDLESS_DESCRIPTORS
 	#else
-			, descriptorSetLayouts
+			, std::move(descriptorSetLayouts)
 	#endif
 			);
 	}
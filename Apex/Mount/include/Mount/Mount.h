@@ -117,6 +117,17 @@ namespace mnt {
 	public:
 		MountManager() = default;
 
+		/**
+		 * \brief Reserves room for mount_count mounts up front, so registering them never rehashes the mount table
+		 */
+		void ReserveMounts(size_t mount_count);
+
+		/**
+		 * \brief Call once every mount is registered. The mount table is only read from afterwards, so it is shrunk to
+		 * the smallest size that holds the mounts
+		 */
+		void FinishMounting();
+
 		void MountDirectory(AxHashString mnt, const char* path);
 		void MountArchive(AxHashString mnt, const char* path);
 		void MountVirtual(AxHashString mnt);
@@ -126,7 +137,7 @@ namespace mnt {
 		Mount GetMount(AxHashString mnt) const;
 
 	private:
-		AxDenseHashMap<AxHashString, UniquePtr<IMount>> m_mounts;
+		AxHashMap<AxHashString, UniquePtr<IMount>> m_mounts;
 	};
 
 	class DirectoryMount : public IMount
@@ -78,12 +78,22 @@ namespace apex::mnt {
 		return true;
 	}
 
+	void MountManager::ReserveMounts(size_t mount_count)
+	{
+		m_mounts.reserve(mount_count);
+	}
+
+	void MountManager::FinishMounting()
+	{
+		m_mounts.shrink_to_fit();
+	}
+
 	void MountManager::MountDirectory(AxHashString mnt, const char* path)
 	{
-		auto it = m_mounts.find(mnt);
-		if (axVerifyFmt(it == m_mounts.end(), "Mount '{}' already exists!", mnt.GetStr()))
+		const u64 hash = m_mounts.hash_function()(mnt);
+		if (axVerifyFmt(!m_mounts.contains(mnt, hash), "Mount '{}' already exists!", mnt.GetStr()))
 		{
-			m_mounts.emplace_hint(it, mnt, apex_new DirectoryMount(mnt.GetStr(), path));
+			m_mounts.try_emplace_hashed(hash, mnt, apex_new DirectoryMount(mnt.GetStr(), path));
 		}
 	}
 
@@ -154,11 +164,6 @@ namespace apex::mnt {
 			flags |= ~((findData.dwFileAttributes & FILE_ATTRIBUTE_COMPRESSED) - 1) & Entry::eCompressed;
 			flags |= ~((findData.dwFileAttributes & FILE_ATTRIBUTE_ENCRYPTED) - 1) & Entry::eEncrypted;
 
-			if (entries.size() == entries.capacity())
-			{
-				entries.reserve(entries.capacity() * 2);
-			}
-
 			if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
 			{
 				fmt::println("    <DIR>  {}", findData.cFileName);
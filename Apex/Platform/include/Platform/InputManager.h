@@ -1,6 +1,6 @@
 ﻿#pragma once
 
-#include "Containers/AxArray.h"
+#include "Containers/AxStaticArray.h"
 #include "Math/Vector2.h"
 
 namespace apex {
@@ -3,6 +3,7 @@
 
 #include "Apex/ECS/Registry.h"
 #include "Containers/AxList.h"
+#include "Containers/AxStaticArray.h"
 #include "Core/Delegate.h"
 #include "Math/Vector3.h"
 #include "Memory/MemoryManager.h"
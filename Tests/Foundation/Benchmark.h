@@ -0,0 +1,33 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <ratio>
+
+// Timing helpers for the Benchmark* tests. The benchmarks are registered with a DISABLED_ prefix so they are skipped in
+// normal test runs, run them with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+
+namespace apex::bench {
+
+	/**
+	 * \brief Calls fn repeats times and returns the average duration of one call in Period units (milliseconds by default)
+	 */
+	template <typename Period = std::milli, typename Func>
+	double measure(Func&& fn, int repeats = 1)
+	{
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < repeats; i++)
+			fn();
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, Period>(end - start).count() / repeats;
+	}
+
+	/**
+	 * \brief Average duration in nanoseconds per item of a kernel that processes item_count items on every call
+	 */
+	template <typename Func>
+	double measurePerItem(size_t item_count, int repeats, Func&& fn)
+	{
+		return measure<std::nano>(fn, repeats) / static_cast<double>(item_count);
+	}
+
+}
@@ -0,0 +1,155 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "Algorithms/RadixSort.h"
+#include "Benchmark.h"
+#include "Containers/AxArray.h"
+#include "Memory/MemoryManager.h"
+
+namespace apex {
+
+	class RadixSortTest : public testing::Test
+	{
+	public:
+		void SetUp() override
+		{
+			mem::MemoryManager::initialize({ 0, 0 });
+		}
+
+		void TearDown() override
+		{
+			EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+			mem::MemoryManager::shutdown();
+		}
+
+		template <typename Key>
+		static std::vector<Key> randomKeys(size_t count, u64 range, u32 seed = 42)
+		{
+			std::mt19937_64 rng(seed);
+			std::vector<Key> keys(count);
+			for (Key& key : keys)
+			{
+				if constexpr (std::is_floating_point_v<Key>)
+					key = std::uniform_real_distribution<Key>(-1000, 1000)(rng);
+				else
+					key = static_cast<Key>(rng() % range);
+			}
+			return keys;
+		}
+
+		// Sorts (key, index) pairs with the radix sort and checks the result against std::stable_sort
+		template <typename Key, typename SortFn>
+		static void checkSortWithValues(std::vector<Key> keys, SortFn&& sort)
+		{
+			std::vector<u32> values(keys.size());
+			std::iota(values.begin(), values.end(), 0);
+
+			std::vector<u32> expected = values;
+			std::stable_sort(expected.begin(), expected.end(), [&keys](u32 a, u32 b) { return keys[a] < keys[b]; });
+
+			sort(make_array_ref<Key>(keys.data(), keys.size()), make_array_ref<u32>(values.data(), values.size()));
+
+			EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+			EXPECT_EQ(values, expected);
+		}
+	};
+
+	TEST_F(RadixSortTest, TestKeys)
+	{
+		for (size_t count : { 0, 1, 10, 64, 65, 1000, 100000 })
+		{
+			std::vector<u32> keys32 = randomKeys<u32>(count, Constants::u32_MAX);
+			std::vector<u32> expected32 = keys32;
+			std::sort(expected32.begin(), expected32.end());
+			radixSort(make_array_ref<u32>(keys32.data(), keys32.size()));
+			EXPECT_EQ(keys32, expected32);
+
+			std::vector<u64> keys64 = randomKeys<u64>(count, Constants::u64_MAX);
+			std::vector<u64> expected64 = keys64;
+			std::sort(expected64.begin(), expected64.end());
+			radixSort(make_array_ref<u64>(keys64.data(), keys64.size()));
+			EXPECT_EQ(keys64, expected64);
+		}
+
+		AxArray<u32> arr;
+		for (u32 i = 0; i < 1000; i++)
+		{
+			arr.append((i * 7919) % 1000);
+		}
+		radixSort(arr);
+		for (u32 i = 0; i < 1000; i++)
+		{
+			EXPECT_EQ(arr[i], i);
+		}
+	}
+
+	TEST_F(RadixSortTest, TestFloatKeys)
+	{
+		std::vector<float> keys = randomKeys<float>(10000, 0);
+		keys.insert(keys.end(), { 0.f, -0.f, 1e-30f, -1e-30f, 3.4e38f, -3.4e38f });
+
+		std::vector<float> expected = keys;
+		std::sort(expected.begin(), expected.end());
+		radixSort(make_array_ref<float>(keys.data(), keys.size()));
+
+		// -0 and 0 compare equal, so compare values instead of bits
+		EXPECT_EQ(keys, expected);
+		EXPECT_TRUE(std::signbit(keys[std::find(keys.begin(), keys.end(), 0.f) - keys.begin()]));
+	}
+
+	TEST_F(RadixSortTest, TestKeyValuePairs)
+	{
+		auto sort = [](auto keys, AxArrayRef<u32> values) { radixSort(keys, values); };
+
+		// Small key ranges produce lots of duplicates, which checks stability and the skipped passes
+		checkSortWithValues(randomKeys<u32>(50000, 100), sort);
+		checkSortWithValues(randomKeys<u32>(50000, Constants::u32_MAX), sort);
+		checkSortWithValues(randomKeys<u64>(50000, u64(1) << 40), sort);
+		checkSortWithValues(randomKeys<float>(50000, 0), sort);
+		checkSortWithValues(randomKeys<u32>(40, 10), sort);
+	}
+
+	TEST_F(RadixSortTest, TestParallel)
+	{
+		auto sort = [](auto keys, AxArrayRef<u32> values) { parallelRadixSort(keys, values, 4); };
+
+		checkSortWithValues(randomKeys<u32>(600000, 1000), sort);
+		checkSortWithValues(randomKeys<u64>(600000, Constants::u64_MAX), sort);
+		checkSortWithValues(randomKeys<float>(600000, 0), sort);
+
+		std::vector<u32> keys = randomKeys<u32>(300000, Constants::u32_MAX);
+		std::vector<u32> expected = keys;
+		std::sort(expected.begin(), expected.end());
+		parallelRadixSort(make_array_ref<u32>(keys.data(), keys.size()));
+		EXPECT_EQ(keys, expected);
+	}
+
+	TEST_F(RadixSortTest, DISABLED_BenchmarkRadixSort)
+	{
+		for (size_t count : { 10'000, 100'000, 1'000'000, 10'000'000 })
+		{
+			const std::vector<u32> keys32 = randomKeys<u32>(count, Constants::u32_MAX);
+			const std::vector<u64> keys64 = randomKeys<u64>(count, Constants::u64_MAX);
+
+			std::vector<u32> a32 = keys32, b32 = keys32, c32 = keys32;
+			const double stdSort32 = bench::measure([&] { std::sort(a32.begin(), a32.end()); });
+			const double radix32 = bench::measure([&] { radixSort(make_array_ref<u32>(b32.data(), b32.size())); });
+			const double parallel32 = bench::measure([&] { parallelRadixSort(make_array_ref<u32>(c32.data(), c32.size())); });
+			EXPECT_EQ(a32, b32);
+			EXPECT_EQ(a32, c32);
+
+			std::vector<u64> a64 = keys64, b64 = keys64;
+			const double stdSort64 = bench::measure([&] { std::sort(a64.begin(), a64.end()); });
+			const double radix64 = bench::measure([&] { radixSort(make_array_ref<u64>(b64.data(), b64.size())); });
+			EXPECT_EQ(a64, b64);
+
+			printf("sort x%-9zu u32 : std::sort %9.2f ms | radixSort %9.2f ms | parallelRadixSort %9.2f ms\n", count, stdSort32, radix32, parallel32);
+			printf("sort x%-9zu u64 : std::sort %9.2f ms | radixSort %9.2f ms\n", count, stdSort64, radix64);
+		}
+	}
+
+}
@@ -1,6 +1,12 @@
 ﻿#include <gtest/gtest.h>
 #include "Concurrency/Concurrency.h"
+#include "Concurrency/EpochReclamation.h"
+#include "Containers/AxConcurrentHashMap.h"
+#include "Containers/AxHashMap.h"
+#include "Memory/MemoryManager.h"
 
+#include <chrono>
+#include <memory>
 #include <queue>
 
 TEST(TestConcurrency, TestSpinLock)
@@ -58,3 +64,320 @@ TEST(TestConcurrency, TestReentrantLock)
 
 	lambda_B();
 }
+
+namespace {
+	std::atomic<uint32_t> g_numReclaimed { 0 };
+
+	// EpochManager holds the retired lists of every thread record inline and is several hundred KB, too large for
+	// the test thread's stack
+	std::unique_ptr<apex::concurrency::EpochManager> MakeEpochManager()
+	{
+		return std::make_unique<apex::concurrency::EpochManager>();
+	}
+
+	void CountingReclaim(void* ptr)
+	{
+		delete static_cast<int*>(ptr);
+		++g_numReclaimed;
+	}
+}
+
+TEST(TestConcurrency, TestEpochReclamation)
+{
+	g_numReclaimed = 0;
+
+	auto epochManagerStorage = MakeEpochManager();
+	apex::concurrency::EpochManager& epochManager = *epochManagerStorage;
+	const uint32_t reader = epochManager.registerThread();
+	const uint32_t writer = epochManager.registerThread();
+
+	epochManager.enter(reader);
+	{
+		apex::concurrency::EpochGuard guard(epochManager, writer);
+		epochManager.retire(writer, new int(42), &CountingReclaim);
+	}
+
+	// The reader is still pinned to an old epoch, so nothing may be reclaimed
+	for (int i = 0; i < 4; i++)
+	{
+		(void)epochManager.tryAdvance();
+		(void)epochManager.collect(writer);
+	}
+	EXPECT_EQ(g_numReclaimed, 0);
+	EXPECT_EQ(epochManager.getRetiredCount(writer), 1);
+
+	epochManager.exit(reader);
+
+	(void)epochManager.tryAdvance();
+	(void)epochManager.tryAdvance();
+	EXPECT_EQ(epochManager.collect(writer), 1);
+	EXPECT_EQ(g_numReclaimed, 1);
+
+	epochManager.unregisterThread(reader);
+	epochManager.unregisterThread(writer);
+}
+
+TEST(TestConcurrency, TestEpochReclamationMultiThreaded)
+{
+	g_numReclaimed = 0;
+
+	uint32_t numThreads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+	constexpr static uint32_t NUM_ITERATIONS = 4096;
+
+	std::atomic<uint32_t> numRetired { 0 };
+	{
+		auto epochManagerStorage = MakeEpochManager();
+		apex::concurrency::EpochManager& epochManager = *epochManagerStorage;
+		std::vector<std::thread> threads(numThreads);
+
+		for (uint32_t t = 0; t < numThreads; t++)
+		{
+			threads[t] = std::thread([&epochManager, &numRetired]
+			{
+				const uint32_t slot = epochManager.registerThread();
+				for (uint32_t i = 0; i < NUM_ITERATIONS; i++)
+				{
+					apex::concurrency::EpochGuard guard(epochManager, slot);
+					epochManager.retire(slot, new int(i), &CountingReclaim);
+					++numRetired;
+				}
+				epochManager.unregisterThread(slot);
+			});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	EXPECT_EQ(numRetired, numThreads * NUM_ITERATIONS);
+	EXPECT_EQ(g_numReclaimed, numThreads * NUM_ITERATIONS);
+}
+
+TEST(TestConcurrency, TestHazardPointers)
+{
+	g_numReclaimed = 0;
+
+	apex::concurrency::HazardPointerDomain domain;
+	const uint32_t reader = domain.registerThread();
+	const uint32_t writer = domain.registerThread();
+
+	std::atomic<int*> shared { new int(7) };
+
+	int* protectedPtr = domain.protect(reader, 0, shared);
+	EXPECT_EQ(*protectedPtr, 7);
+
+	int* old = shared.exchange(new int(8));
+	domain.retire(writer, old, &CountingReclaim);
+
+	EXPECT_EQ(domain.scan(writer), 0);
+	EXPECT_EQ(*protectedPtr, 7);
+
+	domain.clear(reader, 0);
+	EXPECT_EQ(domain.scan(writer), 1);
+	EXPECT_EQ(g_numReclaimed, 1);
+
+	delete shared.load();
+	domain.unregisterThread(reader);
+	domain.unregisterThread(writer);
+}
+
+TEST(TestConcurrency, TestConcurrentHashMap)
+{
+	apex::mem::MemoryManager::initialize({ 0, 0 });
+
+	{
+		auto epochManagerStorage = MakeEpochManager();
+		apex::concurrency::EpochManager& epochManager = *epochManagerStorage;
+		const uint32_t slot = epochManager.registerThread();
+		{
+			apex::AxConcurrentHashMap<uint32_t, uint64_t> map(epochManager);
+			const size_t initialBuckets = map.bucketCount();
+
+			auto [first, inserted] = map.find_or_emplace(slot, 7u, 49ull);
+			EXPECT_TRUE(inserted);
+			EXPECT_EQ(*first, 49);
+
+			// Growing relinks nodes without moving them
+			for (uint32_t i = 0; i < 1000; i++)
+			{
+				map.find_or_emplace(slot, i, uint64_t(i) * i);
+			}
+			EXPECT_GT(map.bucketCount(), initialBuckets);
+			EXPECT_EQ(map.size(), 1000);
+			EXPECT_EQ(map.find(slot, 7u), first);
+
+			for (uint32_t i = 0; i < 1000; i++)
+			{
+				const uint64_t* value = map.find(slot, i);
+				ASSERT_NE(value, nullptr);
+				EXPECT_EQ(*value, uint64_t(i) * i);
+			}
+			EXPECT_EQ(map.find(slot, 1000u), nullptr);
+
+			EXPECT_TRUE(map.erase(slot, 7u));
+			EXPECT_FALSE(map.erase(slot, 7u));
+			EXPECT_FALSE(map.contains(slot, 7u));
+			EXPECT_EQ(map.size(), 999);
+
+			uint64_t sum = 0;
+			map.forEach([&sum](uint32_t key, uint64_t value) { sum += value; });
+			EXPECT_EQ(sum, 332833500ull - 49);
+		}
+		{
+			apex::AxConcurrentHashMap<apex::AxHashString, uint32_t> strings(epochManager);
+			strings.find_or_emplace(slot, apex::AxHashString("pipelines/opaque"), 1u);
+
+			// Lookups by view never construct a key
+			EXPECT_EQ(*strings.find(slot, apex::AxStringView("pipelines/opaque")), 1);
+			EXPECT_EQ(strings.find(slot, apex::AxStringView("pipelines/transparent")), nullptr);
+		}
+		epochManager.unregisterThread(slot);
+	}
+	EXPECT_EQ(apex::mem::MemoryManager::getAllocatedSize(), 0);
+
+	apex::mem::MemoryManager::shutdown();
+}
+
+TEST(TestConcurrency, TestConcurrentHashMapConstructOnce)
+{
+	apex::mem::MemoryManager::initialize({ 0, 0 });
+
+	const uint32_t numThreads = std::max(4u, std::min(8u, std::thread::hardware_concurrency()));
+	constexpr static uint32_t NUM_KEYS = 4096;
+
+	{
+		auto epochManagerStorage = MakeEpochManager();
+		apex::concurrency::EpochManager& epochManager = *epochManagerStorage;
+		apex::AxConcurrentHashMap<uint32_t, uint64_t> map(epochManager);
+
+		std::atomic<uint32_t> numConstructed { 0 };
+		std::vector<std::vector<uint64_t*>> results(numThreads);
+		std::vector<std::thread> threads(numThreads);
+
+		for (uint32_t t = 0; t < numThreads; t++)
+		{
+			threads[t] = std::thread([&, t]
+			{
+				const uint32_t slot = epochManager.registerThread();
+				results[t].resize(NUM_KEYS);
+
+				// Every thread races for every key, starting at a different offset
+				for (uint32_t i = 0; i < NUM_KEYS; i++)
+				{
+					const uint32_t key = (i + t * 97) % NUM_KEYS;
+					auto [value, inserted] = map.find_or_insert(slot, key, [&numConstructed, key]
+					{
+						++numConstructed;
+						return uint64_t(key) + 1;
+					});
+					results[t][key] = value;
+				}
+				epochManager.unregisterThread(slot);
+			});
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		EXPECT_EQ(numConstructed, NUM_KEYS);
+		EXPECT_EQ(map.size(), NUM_KEYS);
+		for (uint32_t key = 0; key < NUM_KEYS; key++)
+		{
+			EXPECT_EQ(*results[0][key], uint64_t(key) + 1);
+			for (uint32_t t = 1; t < numThreads; t++)
+			{
+				EXPECT_EQ(results[t][key], results[0][key]);
+			}
+		}
+	}
+	EXPECT_EQ(apex::mem::MemoryManager::getAllocatedSize(), 0);
+
+	apex::mem::MemoryManager::shutdown();
+}
+
+TEST(TestConcurrency, DISABLED_BenchmarkConcurrentHashMap)
+{
+	apex::mem::MemoryManager::initialize({ 0, 0 });
+
+	const uint32_t numThreads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+	constexpr static uint32_t NUM_KEYS = 8192;
+	constexpr static uint32_t NUM_OPS = 200000;
+
+	// Runs NUM_OPS operations per thread; writePercent of them insert or erase, the rest look up
+	auto measure = [numThreads](uint32_t writePercent, auto&& lookup, auto&& insert, auto&& erase)
+	{
+		std::vector<std::thread> threads(numThreads);
+		const auto start = std::chrono::high_resolution_clock::now();
+		for (uint32_t t = 0; t < numThreads; t++)
+		{
+			threads[t] = std::thread([&, t]
+			{
+				uint32_t state = 0x9E3779B9u * (t + 1);
+				uint64_t found = 0;
+				for (uint32_t i = 0; i < NUM_OPS; i++)
+				{
+					state = state * 1664525u + 1013904223u;
+					const uint32_t key = (state >> 8) % NUM_KEYS;
+					if ((state >> 24) % 100 >= writePercent)
+						found += lookup(t, key);
+					else if (state & 0x10)
+						insert(t, key);
+					else
+						erase(t, key);
+				}
+				EXPECT_LE(found, NUM_OPS);
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		const auto end = std::chrono::high_resolution_clock::now();
+		return std::chrono::duration<double, std::milli>(end - start).count();
+	};
+
+	for (const uint32_t writePercent : { 5u, 50u })
+	{
+		double concurrentTime, lockedTime;
+		{
+			auto epochManagerStorage = MakeEpochManager();
+			apex::concurrency::EpochManager& epochManager = *epochManagerStorage;
+			std::vector<uint32_t> slots(numThreads);
+			for (uint32_t& slot : slots)
+				slot = epochManager.registerThread();
+			{
+				apex::AxConcurrentHashMap<uint32_t, uint64_t> map(epochManager);
+				for (uint32_t key = 0; key < NUM_KEYS; key += 2)
+					map.find_or_emplace(slots[0], key, uint64_t(key));
+
+				concurrentTime = measure(writePercent,
+					[&](uint32_t t, uint32_t key) { return map.find(slots[t], key) != nullptr; },
+					[&](uint32_t t, uint32_t key) { map.find_or_emplace(slots[t], key, uint64_t(key)); },
+					[&](uint32_t t, uint32_t key) { map.erase(slots[t], key); });
+			}
+			for (uint32_t slot : slots)
+				epochManager.unregisterThread(slot);
+		}
+		{
+			apex::concurrency::SpinLock lock;
+			apex::AxDenseHashMap<uint32_t, uint64_t> map;
+			for (uint32_t key = 0; key < NUM_KEYS; key += 2)
+				map.try_emplace(key, uint64_t(key));
+
+			lockedTime = measure(writePercent,
+				[&](uint32_t, uint32_t key) { apex::concurrency::LockGuard guard(lock); return map.find(key) != map.end(); },
+				[&](uint32_t, uint32_t key) { apex::concurrency::LockGuard guard(lock); map.try_emplace(key, uint64_t(key)); },
+				[&](uint32_t, uint32_t key) { apex::concurrency::LockGuard guard(lock); map.erase(key); });
+		}
+
+		printf("%u threads x%u ops, %2u%% writes : AxConcurrentHashMap %8.2f ms | SpinLock + AxDenseHashMap %8.2f ms\n",
+			numThreads, NUM_OPS, writePercent, concurrentTime, lockedTime);
+	}
+	EXPECT_EQ(apex::mem::MemoryManager::getAllocatedSize(), 0);
+
+	apex::mem::MemoryManager::shutdown();
+}
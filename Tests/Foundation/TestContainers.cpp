@@ -1,12 +1,32 @@
-﻿#include <array>
+﻿#include <algorithm>
+#include <array>
+#include <bit>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 #include <gtest/gtest.h>
 
+#include "Benchmark.h"
 #include "Containers/AxArray.h"
+#include "Containers/AxBitSet.h"
+#include "Containers/AxBTreeMap.h"
+#include "Containers/AxBTreeSet.h"
 #include "Containers/AxHashMap.h"
+#include "Containers/AxHashSet.h"
+#include "Containers/AxIntrusiveList.h"
 #include "Containers/AxList.h"
 #include "Containers/AxRange.h"
+#include "Containers/AxRingBuffer.h"
+#include "Containers/AxSoA.h"
+#include "Containers/AxSlotMap.h"
+#include "Containers/AxSmallArray.h"
 #include "Containers/AxSparseMap.h"
+#include "Containers/AxSparseSet.h"
+#include "Containers/AxStaticArray.h"
+#include "Memory/ArenaAllocator.h"
 #include "Memory/UniquePtr.h"
 #include "Math/Vector3.h"
 #include "Memory/MemoryManager.h"
@@ -69,6 +89,11 @@ namespace apex {
 		inline static u32 moveAssignCount = 0;
 	};
 
+	struct RelocatableMovableType : NonTrivialMovableType {};
+
+	template <>
+	struct is_trivially_relocatable<RelocatableMovableType> : std::true_type {};
+
 	class AxArrayTest : public testing::Test
 	{
 	public:
@@ -243,15 +268,16 @@ namespace apex {
 
 			elements.resize(16);
 
+			// old elements are move constructed into the new buffer and then destroyed
 			EXPECT_EQ(NonTrivialMovableType::ctorCount,       16);
-			EXPECT_EQ(NonTrivialMovableType::dtorCount,       0);
-			EXPECT_EQ(NonTrivialMovableType::moveCtorCount,   0);
-			EXPECT_EQ(NonTrivialMovableType::moveAssignCount, 8);
+			EXPECT_EQ(NonTrivialMovableType::dtorCount,       8);
+			EXPECT_EQ(NonTrivialMovableType::moveCtorCount,   8);
+			EXPECT_EQ(NonTrivialMovableType::moveAssignCount, 0);
 		}
 		EXPECT_EQ(NonTrivialMovableType::ctorCount,       16);
-		EXPECT_EQ(NonTrivialMovableType::dtorCount,       16);
-		EXPECT_EQ(NonTrivialMovableType::moveCtorCount,   0);
-		EXPECT_EQ(NonTrivialMovableType::moveAssignCount, 8);
+		EXPECT_EQ(NonTrivialMovableType::dtorCount,       24);
+		EXPECT_EQ(NonTrivialMovableType::moveCtorCount,   8);
+		EXPECT_EQ(NonTrivialMovableType::moveAssignCount, 0);
 	}
 
 	TEST_F(AxArrayTest, TestInsert)
@@ -351,6 +377,374 @@ namespace apex {
 		printf("Allocated size: %llu\n", mem::MemoryManager::getAllocatedSize());
 	}
 
+	TEST_F(AxArrayTest, TestAutoGrow)
+	{
+		AxArray<int> arr;
+		EXPECT_EQ(arr.capacity(), 0);
+
+		size_t numReallocations = 0;
+		size_t lastCapacity = arr.capacity();
+		for (int i = 0; i < 10000; i++)
+		{
+			arr.emplace_back(i);
+			if (arr.capacity() != lastCapacity)
+			{
+				// capacity always covers the whole pool block
+				EXPECT_EQ(arr.capacity() * sizeof(int) % 16, 0);
+				lastCapacity = arr.capacity();
+				numReallocations++;
+			}
+		}
+
+		EXPECT_EQ(arr.size(), 10000);
+		EXPECT_LE(numReallocations, 20);
+		for (int i = 0; i < 10000; i++)
+		{
+			EXPECT_EQ(arr[i], i);
+		}
+
+		AxArray<int> appended;
+		for (int i = 0; i < 100; i++)
+		{
+			appended.append(i);
+			appended.insert(0, -i);
+		}
+		EXPECT_EQ(appended.size(), 200);
+		EXPECT_EQ(appended.front(), -99);
+		EXPECT_EQ(appended.back(), 99);
+	}
+
+	TEST_F(AxArrayTest, TestAutoGrowSelfReference)
+	{
+		AxArray<AxString> arr;
+		arr.emplace_back("a long string that does not fit in the small string buffer");
+		while (arr.size() < arr.capacity())
+		{
+			arr.emplace_back("x");
+		}
+
+		// the next element references storage that is freed by the reallocation
+		arr.emplace_back(arr[0]);
+		EXPECT_EQ(AxStringView(arr.back()), AxStringView(arr.front()));
+
+		arr.insert(1, arr[0]);
+		EXPECT_EQ(AxStringView(arr[1]), AxStringView(arr[0]));
+	}
+
+	TEST_F(AxArrayTest, TestRelocateTriviallyRelocatable)
+	{
+		static_assert(is_trivially_relocatable_v<AxString>);
+		static_assert(is_trivially_relocatable_v<UniquePtr<int>>);
+		static_assert(is_trivially_relocatable_v<AxArray<AxString>>);
+		static_assert(!is_trivially_relocatable_v<NonTrivialMovableType>);
+
+		NonTrivialMovableType::ctorCount = NonTrivialMovableType::dtorCount = 0;
+		NonTrivialMovableType::moveCtorCount = NonTrivialMovableType::moveAssignCount = 0;
+		{
+			AxArray<RelocatableMovableType> elements;
+			elements.resize(8);
+			elements.resize(64);
+			elements.insert(3, RelocatableMovableType{});
+			elements.remove(0);
+
+			// growth and shifting relocate the bytes, no move constructor or destructor runs
+			EXPECT_EQ(NonTrivialMovableType::ctorCount,       65);
+			EXPECT_EQ(NonTrivialMovableType::moveCtorCount,   2); // moving the inserted temporary into place
+			EXPECT_EQ(NonTrivialMovableType::moveAssignCount, 0);
+			EXPECT_EQ(NonTrivialMovableType::dtorCount,       3); // the two temporaries and the removed element
+		}
+		EXPECT_EQ(NonTrivialMovableType::dtorCount, 67);
+		NonTrivialMovableType::ctorCount = NonTrivialMovableType::dtorCount = 0;
+		NonTrivialMovableType::moveCtorCount = NonTrivialMovableType::moveAssignCount = 0;
+	}
+
+	TEST_F(AxArrayTest, TestCopyNonTrivial)
+	{
+		AxArray<AxString> strings;
+		for (int i = 0; i < 20; i++)
+		{
+			char buf[64];
+			snprintf(buf, sizeof(buf), "a string long enough to live on the heap #%d", i);
+			strings.emplace_back(buf);
+		}
+
+		AxArray<AxString> copy = strings;
+		ASSERT_EQ(copy.size(), strings.size());
+		for (size_t i = 0; i < copy.size(); i++)
+		{
+			EXPECT_NE(copy[i].c_str(), strings[i].c_str());
+			EXPECT_EQ(AxStringView(copy[i]), AxStringView(strings[i]));
+		}
+
+		strings.remove(5);
+		strings.insert(0, AxString("first"));
+		EXPECT_EQ(strings.size(), 20);
+		EXPECT_EQ(AxStringView(strings[0]), "first");
+		EXPECT_EQ(AxStringView(strings[5]), AxStringView(copy[4]));
+		EXPECT_EQ(AxStringView(strings[6]), AxStringView(copy[6]));
+
+		copy = strings;
+		ASSERT_EQ(copy.size(), strings.size());
+		for (size_t i = 0; i < copy.size(); i++)
+		{
+			EXPECT_EQ(AxStringView(copy[i]), AxStringView(strings[i]));
+		}
+
+		AxArray<AxString> fromList { AxString("a"), AxString("b") };
+		EXPECT_EQ(AxStringView(fromList[1]), "b");
+	}
+
+	TEST_F(AxArrayTest, DISABLED_BenchmarkPushBack)
+	{
+		static constexpr int kNumElements = 100000;
+		static constexpr int kNumRuns = 20;
+
+		auto measure = [](auto&& fn) { return bench::measure<std::micro>(fn, kNumRuns); };
+
+		const double axArrayTime = measure([]
+		{
+			AxArray<u64> arr;
+			for (int i = 0; i < kNumElements; i++)
+				arr.emplace_back(i);
+			EXPECT_EQ(arr.size(), kNumElements);
+		});
+
+		const double stdVectorTime = measure([]
+		{
+			std::vector<u64> vec;
+			for (int i = 0; i < kNumElements; i++)
+				vec.push_back(i);
+			EXPECT_EQ(vec.size(), kNumElements);
+		});
+
+		const double axArrayStringTime = measure([]
+		{
+			AxArray<AxString> arr;
+			for (int i = 0; i < kNumElements / 10; i++)
+				arr.emplace_back("some string");
+		});
+
+		const double stdVectorStringTime = measure([]
+		{
+			std::vector<AxString> vec;
+			for (int i = 0; i < kNumElements / 10; i++)
+				vec.emplace_back("some string");
+		});
+
+		printf("push_back x%d u64      : AxArray %8.2f us | std::vector %8.2f us\n", kNumElements, axArrayTime, stdVectorTime);
+		printf("push_back x%d AxString : AxArray %8.2f us | std::vector %8.2f us\n", kNumElements / 10, axArrayStringTime, stdVectorStringTime);
+	}
+
+	size_t sumSmallArray(AxArrayBase<int, Small> const& arr)
+	{
+		size_t sum = 0;
+		for (int i : arr)
+			sum += i;
+		return sum;
+	}
+
+	TEST_F(AxArrayTest, TestSmallArrayInline)
+	{
+		const size_t allocatedSize = mem::MemoryManager::getAllocatedSize();
+
+		AxSmallArray<int, 8> arr;
+		EXPECT_TRUE(arr.isInline());
+		EXPECT_EQ(arr.capacity(), 8);
+
+		for (int i = 0; i < 7; i++)
+		{
+			arr.emplace_back(i);
+		}
+		arr.insert(0, -1);
+		arr.remove(0);
+		arr.append(7);
+
+		EXPECT_TRUE(arr.isInline());
+		EXPECT_EQ(arr.size(), 8);
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), allocatedSize);
+		EXPECT_EQ(sumSmallArray(arr), 28);
+
+		// spill to the heap
+		arr.emplace_back(8);
+		EXPECT_FALSE(arr.isInline());
+		EXPECT_GE(arr.capacity(), 9);
+		EXPECT_GT(mem::MemoryManager::getAllocatedSize(), allocatedSize);
+		for (int i = 0; i < 9; i++)
+		{
+			EXPECT_EQ(arr[i], i);
+		}
+
+		arr.reset();
+		EXPECT_TRUE(arr.isInline());
+		EXPECT_EQ(arr.size(), 0);
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), allocatedSize);
+	}
+
+	TEST_F(AxArrayTest, TestSmallArrayCopyMove)
+	{
+		AxSmallArray<AxString, 2> inlineArr { AxString("first"), AxString("second") };
+		EXPECT_TRUE(inlineArr.isInline());
+
+		AxSmallArray<AxString, 2> copy = inlineArr;
+		EXPECT_TRUE(copy.isInline());
+		EXPECT_EQ(AxStringView(copy[1]), "second");
+
+		AxSmallArray<AxString, 2> moved = std::move(inlineArr);
+		EXPECT_TRUE(moved.isInline());
+		EXPECT_EQ(moved.size(), 2);
+		EXPECT_EQ(AxStringView(moved[0]), "first");
+		EXPECT_TRUE(inlineArr.empty());
+
+		moved.emplace_back("third");
+		EXPECT_FALSE(moved.isInline());
+		const AxString* heapData = moved.data();
+
+		// heap buffers are stolen, the source falls back to its inline storage
+		AxSmallArray<AxString, 2> stolen = std::move(moved);
+		EXPECT_EQ(stolen.data(), heapData);
+		EXPECT_EQ(AxStringView(stolen[2]), "third");
+		EXPECT_TRUE(moved.isInline());
+		EXPECT_TRUE(moved.empty());
+
+		moved.emplace_back("reused");
+		EXPECT_TRUE(moved.isInline());
+
+		copy = stolen;
+		EXPECT_FALSE(copy.isInline());
+		EXPECT_EQ(copy.size(), 3);
+		EXPECT_EQ(AxStringView(copy[2]), "third");
+	}
+
+	constexpr auto makeSquares()
+	{
+		AxStaticArray<int, 8> squares;
+		squares.clear();
+		for (int i = 0; i < 5; i++)
+		{
+			squares.emplace_back(i * i);
+		}
+		squares.remove(0);
+		return squares;
+	}
+
+	TEST(AxStaticArrayTest, TestConstexpr)
+	{
+		constexpr AxStaticArray<int, 8> squares = makeSquares();
+		static_assert(squares.size() == 4);
+		static_assert(squares.capacity() == 8);
+		static_assert(squares[0] == 1 && squares.back() == 16);
+
+		constexpr AxStaticArray<u32, 2> indices { (u32)-1, (u32)-1 };
+		static_assert(indices.full() && indices[1] == (u32)-1);
+
+		static_assert(std::is_standard_layout_v<AxStaticArray<float, 4>>);
+		static_assert(sizeof(AxStaticArray<float, 4>) == sizeof(float) * 4 + sizeof(u32));
+	}
+
+	TEST(AxStaticArrayTest, TestSizeTracking)
+	{
+		AxStaticArray<AxString, 4> arr;
+		EXPECT_EQ(arr.size(), 4);
+
+		arr.clear();
+		EXPECT_TRUE(arr.empty());
+
+		arr.emplace_back("b");
+		arr.emplace_back("d");
+		arr.insert(0, AxString("a"));
+		arr.insert(2, AxString("c"));
+		EXPECT_TRUE(arr.full());
+
+		const char* expected[] = { "a", "b", "c", "d" };
+		size_t i = 0;
+		for (AxString const& str : arr)
+		{
+			EXPECT_EQ(AxStringView(str), expected[i++]);
+		}
+		EXPECT_EQ(i, 4);
+
+		arr.remove(1);
+		EXPECT_EQ(arr.size(), 3);
+		EXPECT_EQ(AxStringView(arr[1]), "c");
+
+		arr.pop_back();
+		EXPECT_EQ(AxStringView(arr.back()), "c");
+
+		AxArrayRef<AxString> ref = make_array_ref(arr);
+		EXPECT_EQ(ref.size(), 2);
+
+		EXPECT_DEATH((void)arr[2], "");
+	}
+
+	TEST_F(AxArrayTest, TestSlotMap)
+	{
+		AxSlotMap<AxString> map;
+		AxSlotHandle a = map.emplace("a");
+		AxSlotHandle b = map.emplace("b");
+		AxSlotHandle c = map.insert(AxString("c"));
+
+		EXPECT_EQ(map.size(), 3);
+		EXPECT_TRUE(map.contains(a) && map.contains(b) && map.contains(c));
+		EXPECT_EQ(AxStringView(map[b]), "b");
+		EXPECT_FALSE(map.contains(AxSlotHandle{}));
+
+		// erasing from the middle moves the last element into the hole
+		EXPECT_TRUE(map.erase(a));
+		EXPECT_FALSE(map.erase(a));
+		EXPECT_FALSE(map.contains(a));
+		EXPECT_EQ(map.get(a), nullptr);
+		EXPECT_EQ(map.size(), 2);
+		EXPECT_EQ(AxStringView(map.data()[0]), "c");
+		EXPECT_EQ(AxStringView(map[c]), "c");
+		EXPECT_EQ(map.getHandle(0), c);
+
+		// the freed slot is reused with a new generation
+		AxSlotHandle d = map.emplace("d");
+		EXPECT_EQ(d.index, a.index);
+		EXPECT_NE(d.generation, a.generation);
+		EXPECT_FALSE(map.contains(a));
+		EXPECT_EQ(AxStringView(*map.get(d)), "d");
+
+		size_t count = 0;
+		for (AxString const& str : map)
+		{
+			EXPECT_FALSE(AxStringView(str).empty());
+			count++;
+		}
+		EXPECT_EQ(count, 3);
+
+		map.clear();
+		EXPECT_TRUE(map.empty());
+		EXPECT_FALSE(map.contains(b) || map.contains(c) || map.contains(d));
+	}
+
+	TEST_F(AxArrayTest, TestSlotMapChurn)
+	{
+		AxSlotMap<u64> map;
+		AxArray<AxSlotHandle> handles;
+
+		for (u64 i = 0; i < 1000; i++)
+		{
+			handles.emplace_back(map.emplace(i));
+		}
+		for (size_t i = 0; i < handles.size(); i += 2)
+		{
+			EXPECT_TRUE(map.erase(handles[i]));
+		}
+		EXPECT_EQ(map.size(), 500);
+
+		for (size_t i = 1; i < handles.size(); i += 2)
+		{
+			ASSERT_TRUE(map.contains(handles[i]));
+			EXPECT_EQ(map[handles[i]], i);
+		}
+
+		for (size_t i = 0; i < map.size(); i++)
+		{
+			EXPECT_EQ(map[map.getHandle(i)], map.data()[i]);
+		}
+	}
+
 	TEST(AxStringRefTest, TestAxStringRef)
 	{
 		AxStringRef strRefArr[2];
@@ -452,6 +846,198 @@ namespace apex {
 		mem::MemoryManager::shutdown();
 	}
 
+	TEST(AxSparseMapTest, TestSparsePages)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			using set_type = AxSparseSet<u32>;
+			set_type set;
+			EXPECT_EQ(set.pageCount(), 0);
+			EXPECT_FALSE(set.contains(0));
+			EXPECT_FALSE(set.contains(Constants::u32_MAX - 1));
+
+			// A single high key only allocates the page that covers it
+			const u32 highKey = 3'000'000;
+			set.add(highKey);
+			set.add(1);
+			EXPECT_EQ(set.pageCount(), 2);
+			EXPECT_TRUE(set.contains(highKey));
+			EXPECT_TRUE(set.contains(1));
+			EXPECT_FALSE(set.contains(highKey + 1));
+			EXPECT_FALSE(set.contains(highKey - set_type::kPageSize));
+			EXPECT_EQ(set.getIndex(highKey), 0);
+			EXPECT_EQ(set.getIndex(1), 1);
+
+			for (u32 key = 2; key < set_type::kPageSize; key++)
+			{
+				set.add(key);
+			}
+			EXPECT_EQ(set.pageCount(), 2);
+			EXPECT_EQ(set.count(), set_type::kPageSize);
+
+			EXPECT_TRUE(set.try_remove(highKey));
+			EXPECT_FALSE(set.try_remove(highKey));
+			EXPECT_FALSE(set.contains(highKey));
+			EXPECT_EQ(set.getIndex(set_type::kPageSize - 1), 0);
+
+			set.clear();
+			EXPECT_EQ(set.count(), 0);
+			EXPECT_FALSE(set.contains(1));
+			EXPECT_FALSE(set.try_getIndex(5).has_value());
+
+			set_type moved = std::move(set);
+			moved.add(7);
+			EXPECT_TRUE(moved.contains(7));
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		{
+			// Elements only exist for present keys and are destroyed on removal
+			AxSparseMap<u32, AxString> map;
+			map.emplace(100'000, "far");
+			map.emplace(3, "near");
+			EXPECT_EQ(map.count(), 2);
+			EXPECT_EQ(AxStringView(map.getElement(100'000)), "far");
+
+			map.remove(100'000);
+			EXPECT_EQ(map.count(), 1);
+			EXPECT_EQ(AxStringView(map.getElement(3)), "near");
+			EXPECT_FALSE(map.try_get(100'000).has_value());
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxBitSetTest, TestBitSet)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxBitSet bits(10'000);
+			EXPECT_EQ(bits.size(), 10'000);
+			EXPECT_TRUE(bits.none());
+			EXPECT_EQ(bits.findFirst(), AxBitSet::kNpos);
+
+			bits.set(3);
+			bits.set(64);
+			bits.set(4095);
+			bits.set(4096);
+			bits.set(9'999);
+			EXPECT_EQ(bits.count(), 5);
+			EXPECT_TRUE(bits.test(4096));
+			EXPECT_FALSE(bits.test(4097));
+			EXPECT_FALSE(bits.test(20'000));
+
+			const size_t expected[] = { 3, 64, 4095, 4096, 9'999 };
+			size_t i = 0;
+			for (size_t bit : bits)
+			{
+				EXPECT_EQ(bit, expected[i++]);
+			}
+			EXPECT_EQ(i, 5);
+
+			i = 0;
+			bits.forEach([&](size_t bit) { EXPECT_EQ(bit, expected[i++]); });
+			EXPECT_EQ(i, 5);
+
+			bits.reset(4096);
+			EXPECT_EQ(bits.findNext(4000), 4095);
+			EXPECT_EQ(bits.findNext(4096), 9'999);
+
+			bits.resize(100);
+			EXPECT_EQ(bits.count(), 2);
+			EXPECT_EQ(bits.findNext(65), AxBitSet::kNpos);
+
+			bits.setAll();
+			EXPECT_EQ(bits.count(), 100);
+			bits.clear();
+			EXPECT_TRUE(bits.none());
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxBitSetTest, TestBitSetOperations)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			constexpr size_t kNumBits = 20'000;
+
+			// Reference results computed bit by bit
+			std::vector<bool> refA(kNumBits), refB(kNumBits);
+			AxBitSet a(kNumBits), b(kNumBits / 2);
+
+			u32 state = 12345;
+			auto next = [&state] { state = state * 1664525u + 1013904223u; return state >> 8; };
+			for (size_t i = 0; i < kNumBits; i++)
+			{
+				// Dense at the start, sparse towards the end
+				const u32 density = i < 5000 ? 2 : 97;
+				if (next() % density == 0) { refA[i] = true; a.set(i); }
+				if (i < kNumBits / 2 && next() % density == 0) { refB[i] = true; b.set(i); }
+			}
+
+			auto checkEqual = [](AxBitSet const& bits, std::vector<bool> const& ref)
+			{
+				size_t numSet = 0;
+				for (size_t i = 0; i < ref.size(); i++)
+				{
+					EXPECT_EQ(bits.test(i), ref[i]) << "bit " << i;
+					numSet += ref[i];
+				}
+				EXPECT_EQ(bits.count(), numSet);
+			};
+
+			size_t intersection = 0;
+			for (size_t i = 0; i < kNumBits; i++)
+				intersection += refA[i] && refB[i];
+			EXPECT_EQ(a.countIntersection(b), intersection);
+			EXPECT_EQ(b.countIntersection(a), intersection);
+			EXPECT_TRUE(a.intersects(b));
+
+			AxBitSet andSet = a;
+			andSet &= b;
+			std::vector<bool> refAnd(kNumBits);
+			for (size_t i = 0; i < kNumBits; i++)
+				refAnd[i] = refA[i] && refB[i];
+			checkEqual(andSet, refAnd);
+
+			AxBitSet orSet = b;
+			orSet |= a;
+			EXPECT_EQ(orSet.size(), kNumBits);
+			std::vector<bool> refOr(kNumBits);
+			for (size_t i = 0; i < kNumBits; i++)
+				refOr[i] = refA[i] || refB[i];
+			checkEqual(orSet, refOr);
+
+			AxBitSet andNotSet = a;
+			andNotSet.andNot(b);
+			std::vector<bool> refAndNot(kNumBits);
+			for (size_t i = 0; i < kNumBits; i++)
+				refAndNot[i] = refA[i] && !refB[i];
+			checkEqual(andNotSet, refAndNot);
+
+			EXPECT_FALSE(andSet.intersects(andNotSet));
+
+			size_t prev = 0, numVisited = 0;
+			andNotSet.forEach([&](size_t bit)
+			{
+				EXPECT_TRUE(numVisited == 0 || bit > prev);
+				EXPECT_TRUE(refAndNot[bit]);
+				prev = bit;
+				numVisited++;
+			});
+			EXPECT_EQ(numVisited, andNotSet.count());
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
 	TEST(AxListTest, TestAxList)
 	{
 		mem::MemoryManager::initialize({ 0, 0 });
@@ -570,6 +1156,132 @@ namespace apex {
 		mem::MemoryManager::shutdown();
 	}
 
+	TEST(AxListTest, TestInsertAndSplice)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxList<int> a;
+			AxList<int> b;
+			for (int i = 0; i < 4; i++)
+			{
+				a.append(i);      // 0 1 2 3
+				b.append(10 + i); // 10 11 12 13
+			}
+
+			auto it = a.insert(a.begin().next(), 5); // 0 5 1 2 3
+			EXPECT_EQ(*it, 5);
+			a.prepend(-1);                           // -1 0 5 1 2 3
+			EXPECT_EQ(a.front(), -1);
+
+			a.splice(it, b); // -1 0 10 11 12 13 5 1 2 3
+			EXPECT_TRUE(b.empty());
+			EXPECT_EQ(a.size(), 10);
+
+			b.splice(b.end(), a, a.begin()); // moves -1
+			EXPECT_EQ(b.size(), 1);
+			EXPECT_EQ(b.front(), -1);
+			EXPECT_EQ(a.size(), 9);
+
+			a.splice(a.end(), a, a.begin()); // rotate 0 to the back
+			a.pop_front();                   // drops 10
+
+			const int expected[] = { 11, 12, 13, 5, 1, 2, 3, 0 };
+			int i = 0;
+			for (auto& e : a)
+			{
+				EXPECT_EQ(e, expected[i++]);
+			}
+			EXPECT_EQ(i, 8);
+			EXPECT_EQ(a.back(), 0);
+
+			AxList<int> c = std::move(a);
+			EXPECT_TRUE(a.empty());
+			EXPECT_EQ(c.size(), 8);
+			EXPECT_EQ(c.front(), 11);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxListTest, TestLongListDestruction)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			// Recursive node ownership used to overflow the stack here. Sized to fit in the 32 byte pool
+			AxList<u64> list;
+			for (u64 i = 0; i < 60'000; i++)
+			{
+				list.append(i);
+			}
+			EXPECT_EQ(list.size(), 60'000);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	struct LruEntry : public AxListHook<>
+	{
+		int key;
+	};
+
+	TEST(AxListTest, TestIntrusiveList)
+	{
+		LruEntry entries[8];
+		AxIntrusiveList<LruEntry> lru;
+
+		for (int i = 0; i < 8; i++)
+		{
+			entries[i].key = i;
+			lru.push_front(entries[i]); // most recently used at the front
+		}
+		EXPECT_EQ(lru.size(), 8);
+		EXPECT_EQ(lru.front().key, 7);
+		EXPECT_EQ(lru.back().key, 0);
+
+		// touch 3: move it to the front
+		lru.splice(lru.begin(), lru, entries[3]);
+		EXPECT_EQ(lru.front().key, 3);
+		EXPECT_EQ(lru.size(), 8);
+
+		// evict the least recently used
+		LruEntry* evicted = lru.pop_back();
+		EXPECT_EQ(evicted->key, 0);
+		EXPECT_FALSE(evicted->isLinked());
+
+		lru.remove(entries[5]);
+		EXPECT_FALSE(entries[5].isLinked());
+
+		const int expected[] = { 3, 7, 6, 4, 2, 1 };
+		int i = 0;
+		for (auto& e : lru)
+		{
+			EXPECT_EQ(e.key, expected[i++]);
+		}
+		EXPECT_EQ(i, 6);
+
+		i = 6;
+		for (auto& e : ranges::reversed(lru))
+		{
+			EXPECT_EQ(e.key, expected[--i]);
+		}
+		EXPECT_EQ(i, 0);
+
+		AxIntrusiveList<LruEntry> pending;
+		pending.splice(pending.end(), lru);
+		EXPECT_TRUE(lru.empty());
+		EXPECT_EQ(pending.size(), 6);
+
+		pending.clear();
+		for (auto& e : entries)
+		{
+			EXPECT_FALSE(e.isLinked());
+		}
+	}
+
 	struct MyData
 	{
 		AxString name;
@@ -582,7 +1294,7 @@ namespace apex {
 		mem::MemoryManager::initialize({ 0, 0 });
 
 		{
-			AxDenseHashMap<int, MyData> map(24);
+			AxHashMap<int, MyData> map(24);
 			{
 				map.try_emplace(7750, "Tomato Sauce", math::Vector3{ 2.1, 0.8, 1.9 }, 999);
 			}
@@ -603,6 +1315,183 @@ namespace apex {
 		mem::MemoryManager::shutdown();
 	}
 
+	TEST(AxHashMapTest, TestChurn)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxHashMap<u32, u32> map;
+			std::unordered_map<u32, u32> reference;
+
+			// Interleave inserts and erases so the table fills up with tombstones and has to rehash in place
+			u32 state = 12345;
+			for (u32 i = 0; i < 20'000; i++)
+			{
+				state = state * 1664525u + 1013904223u;
+				const u32 key = (state >> 8) % 4096;
+				if (state & 1)
+				{
+					auto [it, inserted] = map.try_emplace(key, i);
+					EXPECT_EQ(inserted, reference.try_emplace(key, i).second);
+					EXPECT_EQ(it->first, key);
+				}
+				else
+				{
+					EXPECT_EQ(map.erase(key), reference.erase(key));
+				}
+			}
+
+			ASSERT_EQ(map.size(), reference.size());
+			for (auto const& [key, value] : reference)
+			{
+				auto it = map.find(key);
+				ASSERT_NE(it, map.end());
+				EXPECT_EQ(it->second, value);
+			}
+
+			size_t visited = 0;
+			for (auto const& [key, value] : map)
+			{
+				EXPECT_EQ(reference.at(key), value);
+				visited++;
+			}
+			EXPECT_EQ(visited, reference.size());
+
+			for (u32 key = 0; key < 4096; key++)
+			{
+				EXPECT_EQ(map.contains(key), reference.contains(key));
+			}
+
+			// Copies keep every element in place, shrinking keeps every element
+			AxHashMap<u32, u32> copy = map;
+			EXPECT_EQ(copy.size(), map.size());
+			copy.shrink_to_fit();
+			EXPECT_LE(copy.capacity(), map.capacity());
+			for (auto const& [key, value] : reference)
+			{
+				EXPECT_EQ(copy.at(key), value);
+			}
+
+			map.clear();
+			EXPECT_TRUE(map.empty());
+			EXPECT_EQ(map.find(reference.begin()->first), map.end());
+			map.shrink_to_fit();
+			EXPECT_EQ(map.capacity(), 0);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxHashMapTest, TestHeterogeneousLookup)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxHashMap<AxHashString, UniquePtr<int>> map;
+			map.try_emplace(AxHashString("assets"), apex::make_unique<int>(1));
+			map.try_emplace(AxHashString("shaders"), apex::make_unique<int>(2));
+			map.try_emplace(AxHashString("config"), apex::make_unique<int>(3));
+
+			// Lookup by view, without constructing an AxHashString
+			AxStringView view = "shaders";
+			auto it = map.find(view);
+			ASSERT_NE(it, map.end());
+			EXPECT_EQ(*it->second, 2);
+			EXPECT_FALSE(map.contains(AxStringView("textures")));
+
+			// A precomputed hash is reused for every lookup
+			const u64 hash = map.hash_function()(AxStringView("config"));
+			EXPECT_EQ(hash, AxHashString("config").GetHash());
+			ASSERT_TRUE(map.contains(AxStringView("config"), hash));
+			EXPECT_EQ(*map.find(AxStringView("config"), hash)->second, 3);
+
+			auto [newIt, inserted] = map.try_emplace_hashed(map.hash_function()(AxStringView("audio")), AxHashString("audio"), apex::make_unique<int>(4));
+			EXPECT_TRUE(inserted);
+			EXPECT_EQ(*map.try_get(AxStringView("audio"))->get(), 4);
+			EXPECT_EQ(map.try_get(AxStringView("video")), nullptr);
+
+			EXPECT_EQ(map.erase(AxStringView("assets")), 1);
+			EXPECT_EQ(map.size(), 3);
+
+			// Erase by non-const iterator with a transparent hasher
+			auto shaders = map.find(AxStringView("shaders"));
+			ASSERT_NE(shaders, map.end());
+			map.erase(shaders);
+			EXPECT_EQ(map.size(), 2);
+			EXPECT_FALSE(map.contains(AxStringView("shaders")));
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxHashMapTest, TestHashSet)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxHashSet<u64> set;
+			set.reserve(1000);
+			const size_t capacity = set.capacity();
+			for (u64 i = 0; i < 1000; i++)
+			{
+				EXPECT_TRUE(set.insert(i * 4096).second);
+			}
+			EXPECT_EQ(set.capacity(), capacity);
+			EXPECT_FALSE(set.insert(4096).second);
+			EXPECT_TRUE(set.contains(4096 * 999));
+			EXPECT_FALSE(set.contains(4095));
+
+			u64 sum = 0;
+			for (u64 value : set)
+			{
+				sum += value;
+			}
+			EXPECT_EQ(sum, 4096ull * (999 * 1000 / 2));
+
+			for (u64 i = 0; i < 1000; i += 2)
+			{
+				set.erase(i * 4096);
+			}
+			EXPECT_EQ(set.size(), 500);
+			EXPECT_FALSE(set.contains(0));
+			EXPECT_TRUE(set.contains(4096));
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxHashMapTest, TestArenaAllocator)
+	{
+		alignas(16) static u8 buffer[64 * 1024];
+		mem::ArenaAllocator arena;
+		arena.initialize(buffer, sizeof(buffer));
+
+		{
+			using arena_map = AxHashMap<u32, u64, AxHasher<u32>, AxKeyEqual<u32>, mem::ArenaStdAllocator<std::pair<u32, u64>>>;
+			arena_map map(64, {}, {}, mem::ArenaStdAllocator<std::pair<u32, u64>>(&arena));
+			for (u32 i = 0; i < 50; i++)
+			{
+				map.try_emplace(i, u64(i) * i);
+			}
+			for (u32 i = 0; i < 50; i++)
+			{
+				EXPECT_EQ(map.at(i), u64(i) * i);
+			}
+
+			for (auto const& [key, value] : map)
+			{
+				const u8* p = reinterpret_cast<const u8*>(&value);
+				EXPECT_TRUE(p >= buffer && p < buffer + sizeof(buffer));
+				EXPECT_EQ(reinterpret_cast<uintptr_t>(p) % alignof(u64), 0);
+			}
+		}
+
+		arena.reset();
+	}
+
 	TEST(AxDenseHashMapTest, TestDenseHashMap)
 	{
 		mem::MemoryManager::initialize({ 0, 0 });
@@ -615,4 +1504,393 @@ namespace apex {
 		mem::MemoryManager::shutdown();
 	}
 
+	TEST(AxSoATest, TestPushAndSwapRemove)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxSoA<math::Vector3, float, u32> soa;
+			for (u32 i = 0; i < 100; i++)
+			{
+				soa.emplace_back(math::Vector3{ (float)i, 0.f, 0.f }, i * 0.5f, i);
+			}
+			EXPECT_EQ(soa.size(), 100);
+			EXPECT_GE(soa.capacity(), 100);
+
+			// Every column is aligned for SIMD loads
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(soa.data<0>()) % decltype(soa)::kColumnAlignment, 0);
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(soa.data<1>()) % decltype(soa)::kColumnAlignment, 0);
+			EXPECT_EQ(reinterpret_cast<uintptr_t>(soa.data<2>()) % decltype(soa)::kColumnAlignment, 0);
+
+			// Columns move in lock-step
+			soa.swap_remove(10);
+			EXPECT_EQ(soa.size(), 99);
+			EXPECT_EQ(soa.get<0>(10).x, 99.f);
+			EXPECT_EQ(soa.get<1>(10), 99 * 0.5f);
+			EXPECT_EQ(soa.get<2>(10), 99);
+
+			soa.pop_back();
+			EXPECT_EQ(soa.size(), 98);
+
+			for (auto [position, weight, id] : soa)
+			{
+				EXPECT_EQ(position.x, (float)id);
+				EXPECT_EQ(weight, id * 0.5f);
+				weight = 1.f;
+			}
+
+			float sum = 0.f;
+			for (float weight : soa.column<1>())
+			{
+				sum += weight;
+			}
+			EXPECT_EQ(sum, 98.f);
+
+			auto [position, weight, id] = soa[0];
+			position.y = 2.f;
+			EXPECT_EQ(soa.column<0>()[0].y, 2.f);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxSoATest, TestNonTrivialFields)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxSoA<AxString, u32> soa;
+			soa.resize(4);
+			EXPECT_EQ(soa.size(), 4);
+			EXPECT_EQ(soa.get<1>(3), 0);
+
+			for (u32 i = 0; i < 40; i++)
+			{
+				soa.emplace_back(AxString("name-a-long-string-that-is-heap-allocated"), i);
+			}
+			EXPECT_EQ(soa.size(), 44);
+
+			soa.swap_remove(0);
+			EXPECT_EQ(soa.get<1>(0), 39);
+			EXPECT_STREQ(soa.get<0>(0).c_str(), "name-a-long-string-that-is-heap-allocated");
+
+			AxSoA<AxString, u32> moved = std::move(soa);
+			EXPECT_EQ(moved.size(), 43);
+			EXPECT_TRUE(soa.empty());
+
+			moved.resize(2);
+			EXPECT_EQ(moved.size(), 2);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxSoATest, TestPushBackOwnElementAtCapacity)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxSoA<AxString, u32> soa(4);
+			for (u32 i = 0; i < 4; i++)
+			{
+				soa.emplace_back(AxString("name-a-long-string-that-is-heap-allocated"), i);
+			}
+			ASSERT_EQ(soa.size(), soa.capacity());
+
+			// Arguments refer into the columns that get reallocated
+			soa.emplace_back(soa.get<0>(1), soa.get<1>(1));
+			EXPECT_GT(soa.capacity(), 4);
+			EXPECT_EQ(soa.size(), 5);
+			EXPECT_STREQ(soa.get<0>(4).c_str(), "name-a-long-string-that-is-heap-allocated");
+			EXPECT_EQ(soa.get<1>(4), 1);
+
+			auto it = soa.begin();
+			it += 4;
+			EXPECT_EQ(std::get<1>(*it), 1);
+			EXPECT_EQ(std::get<1>(soa.begin()[2]), 2);
+			EXPECT_TRUE(soa.begin() < it && it <= soa.end() && soa.end() > it && it >= it);
+			EXPECT_EQ(std::distance(soa.begin(), soa.end()), 5);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxRingBufferTest, TestDeque)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxDeque<u32> deque;
+			EXPECT_TRUE(deque.empty());
+
+			for (u32 i = 0; i < 10; i++)
+			{
+				deque.push_back(i);
+				deque.push_front(100 + i);
+			}
+			EXPECT_EQ(deque.size(), 20);
+			EXPECT_EQ(deque.front(), 109);
+			EXPECT_EQ(deque.back(), 9);
+			EXPECT_EQ(deque[10], 0);
+
+			// Force the contents to wrap and grow while wrapped
+			for (u32 i = 0; i < 100; i++)
+			{
+				deque.pop_front();
+				deque.push_back(10 + i);
+			}
+			for (u32 i = 0; i < 100; i++)
+			{
+				deque.push_back(110 + i);
+			}
+			EXPECT_EQ(deque.size(), 120);
+			EXPECT_TRUE(std::has_single_bit(deque.capacity()));
+
+			u32 expected = 90;
+			for (u32 value : deque)
+			{
+				EXPECT_EQ(value, expected++);
+			}
+
+			auto [first, second] = deque.spans();
+			EXPECT_EQ(first.size() + second.size(), deque.size());
+			EXPECT_EQ(first[0], 90);
+
+			// Random access algorithms over the wrapped contents
+			static_assert(std::random_access_iterator<AxDeque<u32>::iterator>);
+			EXPECT_EQ(std::lower_bound(deque.begin(), deque.end(), 150u) - deque.begin(), 60);
+			std::sort(deque.begin(), deque.end(), std::greater<>());
+			EXPECT_EQ(deque.front(), 209);
+			EXPECT_EQ(deque.begin()[119], 90);
+			std::sort(deque.begin(), deque.end());
+			EXPECT_EQ(deque.front(), 90);
+
+			deque.pop_front_n(20);
+			EXPECT_EQ(deque.front(), 110);
+			deque.pop_back();
+			EXPECT_EQ(deque.back(), 208);
+
+			deque.clear();
+			EXPECT_TRUE(deque.empty());
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxRingBufferTest, TestOverwrite)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxRingBuffer<AxString> history(6, RingBufferMode::eOverwrite);
+			EXPECT_EQ(history.capacity(), 8);
+
+			for (u32 i = 0; i < 20; i++)
+			{
+				history.emplace_back((std::string("a string long enough to live on the heap ") + std::to_string(i)).c_str());
+			}
+			EXPECT_TRUE(history.full());
+			EXPECT_STREQ(history.front().c_str(), "a string long enough to live on the heap 12");
+			EXPECT_STREQ(history.back().c_str(), "a string long enough to live on the heap 19");
+
+			// Pushing at the front drops from the back
+			history.push_front(history.back());
+			EXPECT_STREQ(history.front().c_str(), "a string long enough to live on the heap 19");
+			EXPECT_STREQ(history.back().c_str(), "a string long enough to live on the heap 18");
+
+			AxRingBuffer<char> chars(16, RingBufferMode::eOverwrite);
+			chars.push_back_n("0123456789", 10);
+			chars.push_back_n("abcdefghij", 10);
+			EXPECT_EQ(chars.size(), 16);
+
+			auto [first, second] = chars.spans();
+			std::string text(first.begin(), first.end());
+			text.append(second.begin(), second.end());
+			EXPECT_EQ(text, "456789abcdefghij");
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxBTreeTest, TestChurn)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxBTreeMap<u32, u32> map;
+			std::map<u32, u32> reference;
+
+			// std::map elements have a const key, so compare members instead of pairs
+			auto equalPairs = [](auto const& a, auto const& b) { return a.first == b.first && a.second == b.second; };
+
+			// Enough keys for a three level tree, with interleaved erases to exercise borrowing and merging
+			std::mt19937 rng(7);
+			for (u32 i = 0; i < 60'000; i++)
+			{
+				const u32 key = rng() % 8192;
+				if (rng() % 3 != 0)
+				{
+					auto [it, inserted] = map.try_emplace(key, i);
+					EXPECT_EQ(inserted, reference.try_emplace(key, i).second);
+					EXPECT_EQ(it->first, key);
+				}
+				else
+				{
+					EXPECT_EQ(map.erase(key), reference.erase(key));
+				}
+			}
+
+			ASSERT_EQ(map.size(), reference.size());
+			EXPECT_TRUE(std::equal(map.begin(), map.end(), reference.begin(), reference.end(), equalPairs));
+			EXPECT_TRUE(std::equal(std::make_reverse_iterator(map.end()), std::make_reverse_iterator(map.begin()), reference.rbegin(), reference.rend(), equalPairs));
+
+			for (u32 key = 0; key < 8200; key += 7)
+			{
+				EXPECT_EQ(map.contains(key), reference.contains(key));
+				auto lower = map.lower_bound(key);
+				auto refLower = reference.lower_bound(key);
+				EXPECT_EQ(lower == map.end(), refLower == reference.end());
+				if (refLower != reference.end())
+					EXPECT_EQ(lower->first, refLower->first);
+
+				auto upper = map.upper_bound(key);
+				auto refUpper = reference.upper_bound(key);
+				EXPECT_EQ(upper == map.end(), refUpper == reference.end());
+				if (refUpper != reference.end())
+					EXPECT_EQ(upper->first, refUpper->first);
+			}
+
+			// Erasing through iterators while walking the map
+			for (auto it = map.begin(); it != map.end();)
+			{
+				it = it->first % 2 ? map.erase(it) : std::next(it);
+			}
+			std::erase_if(reference, [](auto const& pair) { return pair.first % 2; });
+			EXPECT_TRUE(std::equal(map.begin(), map.end(), reference.begin(), reference.end(), equalPairs));
+
+			AxBTreeMap<u32, u32> copy = map;
+			EXPECT_TRUE(std::equal(copy.begin(), copy.end(), reference.begin(), reference.end(), equalPairs));
+
+			for (auto const& [key, value] : reference)
+			{
+				EXPECT_EQ(map.erase(key), 1);
+			}
+			EXPECT_TRUE(map.empty());
+			EXPECT_EQ(map.begin(), map.end());
+			EXPECT_EQ(map.find(0), map.end());
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxBTreeTest, TestBulkLoadAndRange)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			std::vector<std::pair<u64, f32>> sorted;
+			for (u64 i = 0; i < 10'000; i++)
+			{
+				sorted.emplace_back(i * 10, static_cast<f32>(i));
+			}
+
+			AxBTreeMap<u64, f32> map;
+			map.bulk_load(sorted.begin(), sorted.end());
+			ASSERT_EQ(map.size(), sorted.size());
+			EXPECT_TRUE(std::equal(map.begin(), map.end(), sorted.begin(), sorted.end()));
+
+			// [995, 1205) holds the keys 1000, 1010, ..., 1200
+			u64 expected = 1000;
+			for (auto const& [key, value] : map.range(995, 1205))
+			{
+				EXPECT_EQ(key, expected);
+				EXPECT_EQ(value, static_cast<f32>(key / 10));
+				expected += 10;
+			}
+			EXPECT_EQ(expected, 1210);
+			EXPECT_EQ(std::ranges::distance(map.range(50'000, 50'000)), 0);
+			EXPECT_EQ(std::ranges::distance(map.range(99'000, 200'000)), 100);
+
+			// The bulk loaded tree accepts regular inserts and erases
+			map[5] = 0.5f;
+			map.insert_or_assign(10, 1.5f);
+			EXPECT_EQ(map.at(5), 0.5f);
+			EXPECT_EQ(*map.try_get(10), 1.5f);
+			EXPECT_EQ(map.try_get(15), nullptr);
+			for (u64 i = 0; i < 5'000; i++)
+			{
+				map.erase(i * 20);
+			}
+			EXPECT_EQ(map.size(), 5'001);
+			EXPECT_EQ(map.begin()->first, 5);
+			EXPECT_EQ(std::prev(map.end())->first, 99'990);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
+	TEST(AxBTreeTest, TestNonTrivialElements)
+	{
+		mem::MemoryManager::initialize({ 0, 0 });
+
+		{
+			AxBTreeMap<std::string, UniquePtr<int>, std::less<>> map;
+			for (int i = 0; i < 2000; i++)
+			{
+				map.try_emplace("a key long enough to live on the heap " + std::to_string(i), apex::make_unique<int>(i));
+			}
+			for (int i = 0; i < 2000; i += 3)
+			{
+				EXPECT_EQ(map.erase(std::string_view("a key long enough to live on the heap " + std::to_string(i))), 1);
+			}
+			EXPECT_EQ(map.size(), 1333);
+
+			// Heterogeneous lookup with a transparent comparator
+			auto it = map.find(std::string_view("a key long enough to live on the heap 1000"));
+			ASSERT_NE(it, map.end());
+			EXPECT_EQ(*it->second, 1000);
+			EXPECT_FALSE(map.contains(std::string_view("a key long enough to live on the heap 999")));
+			EXPECT_TRUE(std::is_sorted(map.begin(), map.end(), [](auto const& a, auto const& b) { return a.first < b.first; }));
+
+			// Erase by non-const iterator with a transparent comparator
+			auto next = map.erase(it);
+			EXPECT_EQ(map.size(), 1332);
+			EXPECT_FALSE(map.contains(std::string_view("a key long enough to live on the heap 1000")));
+			ASSERT_NE(next, map.end());
+			EXPECT_EQ(next->first, "a key long enough to live on the heap 1001");
+
+			// Arguments that refer to an element of the leaf being inserted into
+			AxBTreeMap<std::string, std::string, std::less<>> names;
+			names.try_emplace("b", "a value long enough to live on the heap");
+			names.try_emplace("c", "another value long enough to live on the heap");
+			names.try_emplace("a", names.at("b"));
+			EXPECT_EQ(names.at("a"), "a value long enough to live on the heap");
+			EXPECT_EQ(names.at("b"), "a value long enough to live on the heap");
+
+			AxBTreeSet<u32> set;
+			for (u32 i = 0; i < 1000; i++)
+			{
+				EXPECT_TRUE(set.insert((i * 7919) % 1000).second);
+			}
+			EXPECT_FALSE(set.insert(500).second);
+			u32 expected = 0;
+			for (u32 value : set)
+			{
+				EXPECT_EQ(value, expected++);
+			}
+			EXPECT_EQ(*set.lower_bound(250), 250);
+			EXPECT_EQ(*set.upper_bound(250), 251);
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+		mem::MemoryManager::shutdown();
+	}
+
 }
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "Core/CpuInfo.h"
+
+namespace apex {
+
+	TEST(CpuInfoTest, TestTopology)
+	{
+		CpuTopology const& topology = CpuInfo::GetTopology();
+
+		EXPECT_GE(topology.numLogicalCores, 1);
+		EXPECT_GE(topology.numPhysicalCores, 1);
+		EXPECT_LE(topology.numPhysicalCores, topology.numLogicalCores);
+		EXPECT_GE(topology.numL3Groups, 1);
+		EXPECT_GE(topology.numPackages, 1);
+
+		u32 numPrimaryThreads = 0;
+		for (u32 i = 0; i < topology.numLogicalCores; i++)
+		{
+			EXPECT_LT(topology.cores[i].physicalCore, topology.numPhysicalCores);
+			EXPECT_LT(topology.cores[i].l3Group, topology.numL3Groups);
+			if (topology.cores[i].smtIndex == 0)
+				++numPrimaryThreads;
+		}
+		EXPECT_EQ(numPrimaryThreads, topology.numPhysicalCores);
+	}
+
+	TEST(CpuInfoTest, TestFeatures)
+	{
+		const SimdLevel level = CpuInfo::GetSimdLevel();
+
+		if (level == SimdLevel::eAVX2 || level == SimdLevel::eAVX512)
+		{
+			EXPECT_TRUE(CpuInfo::HasFeature(CpuFeature::eAVX2));
+			EXPECT_TRUE(CpuInfo::HasFeature(CpuFeature::eFMA));
+		}
+		if (level == SimdLevel::eAVX512)
+		{
+			EXPECT_TRUE(CpuInfo::HasFeature(CpuFeature::eAVX512F));
+		}
+	#if defined(__x86_64__) || defined(_M_X64)
+		EXPECT_TRUE(CpuInfo::HasFeature(CpuFeature::eSSE2));
+	#endif
+	}
+
+	TEST(CpuInfoTest, TestThreadPlacement)
+	{
+		CpuTopology const& topology = CpuInfo::GetTopology();
+
+		ThreadPlacement placement = CpuInfo::PlanThreadPlacement(2, 0, false);
+		EXPECT_EQ(placement.numDedicated, 2);
+		EXPECT_GE(placement.numWorkers, 1);
+
+		if (topology.numPhysicalCores > 2)
+		{
+			EXPECT_EQ(placement.numWorkers, topology.numPhysicalCores - 2);
+
+			// Workers never share a physical core with a dedicated thread or with each other
+			auto physicalOf = [&topology](u16 os_index)
+			{
+				for (u32 i = 0; i < topology.numLogicalCores; i++)
+					if (topology.cores[i].osIndex == os_index)
+						return topology.cores[i].physicalCore;
+				return u16(-1);
+			};
+
+			for (u32 w = 0; w < placement.numWorkers; w++)
+			{
+				for (u32 d = 0; d < placement.numDedicated; d++)
+					EXPECT_NE(physicalOf(placement.workerCores[w]), physicalOf(placement.dedicatedCores[d]));
+				for (u32 o = 0; o < w; o++)
+					EXPECT_NE(physicalOf(placement.workerCores[w]), physicalOf(placement.workerCores[o]));
+			}
+		}
+
+		std::thread pinned([&placement]
+		{
+			EXPECT_TRUE(CpuInfo::SetCurrentThreadAffinity(placement.workerCores[0]));
+		});
+		pinned.join();
+	}
+
+}
@@ -1,7 +1,11 @@
-﻿#include <gtest/gtest.h>
+﻿#include <cstdio>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
 
 #include "Core/Files.h"
 #include "Memory/MemoryManager.h"
+#include "String/AxFileStream.h"
 
 TEST(TestFiles, TestReadFile)
 {
@@ -11,4 +15,118 @@ TEST(TestFiles, TestReadFile)
 	apex::AxArray<char> fileBuf;
 	fileBuf.resize(file.GetSize());
 	file.Read(fileBuf.dataMutable(), fileBuf.size());
-}
\ No newline at end of file
+}
+
+namespace apex {
+
+	class AxFileStreamTest : public testing::TestWithParam<bool>
+	{
+	public:
+		static constexpr const char* kFilename = "AxFileStreamTest.bin";
+
+		void SetUp() override
+		{
+			mem::MemoryManager::initialize({ 0, 0 });
+		}
+
+		void TearDown() override
+		{
+			std::remove(kFilename);
+			EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+			mem::MemoryManager::shutdown();
+		}
+	};
+
+	TEST_P(AxFileStreamTest, TestRoundTrip)
+	{
+		const bool async = GetParam();
+
+		std::vector<u32> payload(100000);
+		std::iota(payload.begin(), payload.end(), 0);
+
+		constexpr s64 kVarInts[] = { 0, 1, -1, 63, -64, 300, -300, Constants::s64_MAX, Constants::s64_MIN };
+
+		u64 sectionOffset;
+		{
+			File file = File::CreateNew(kFilename);
+			AxFileStreamWriter writer { file, 4096, async };
+
+			const u32 header = 0xdeadbeef;
+			writer.WriteObject(&header);
+			writer.WriteInt<u32>(0x01020304, std::endian::big);
+			for (s64 value : kVarInts)
+			{
+				writer.WriteVarS64(value);
+			}
+			writer.WriteVarU64(Constants::u64_MAX);
+
+			writer.AlignTo(256);
+			sectionOffset = writer.Tell();
+			EXPECT_EQ(sectionOffset % 256, 0);
+			writer.WriteArray(payload.data(), payload.size());
+
+			// Patch the header once the rest is written
+			const u64 end = writer.Tell();
+			writer.Seek(0);
+			const u32 patched = 0xfeedface;
+			writer.WriteObject(&patched);
+			writer.Seek(end);
+
+			// The header was written twice
+			writer.Flush();
+			EXPECT_FALSE(writer.HasFailed());
+			EXPECT_EQ(writer.GetBytesWritten(), end + sizeof(patched));
+		}
+
+		File file = File::OpenExisting(kFilename);
+		EXPECT_EQ(file.GetSize(), sectionOffset + payload.size() * sizeof(u32));
+
+		AxFileStreamReader reader { file, 4096, async };
+
+		u32 header, bigEndian;
+		EXPECT_TRUE(reader.ReadObject(header));
+		EXPECT_EQ(header, 0xfeedface);
+		EXPECT_TRUE(reader.ReadInt(bigEndian, std::endian::big));
+		EXPECT_EQ(bigEndian, 0x01020304);
+
+		for (s64 expected : kVarInts)
+		{
+			s64 value;
+			EXPECT_TRUE(reader.ReadVarS64(value));
+			EXPECT_EQ(value, expected);
+		}
+		u64 maxValue;
+		EXPECT_TRUE(reader.ReadVarU64(maxValue));
+		EXPECT_EQ(maxValue, Constants::u64_MAX);
+
+		reader.AlignTo(256);
+		EXPECT_EQ(reader.Tell(), sectionOffset);
+
+		// Odd-sized reads straddle the buffer boundaries, the last one is large enough to bypass the buffer
+		std::vector<u32> result(payload.size());
+		size_t index = 0;
+		for (size_t count : { 1, 7, 1023, 5000 })
+		{
+			EXPECT_TRUE(reader.ReadArray(result.data() + index, count));
+			index += count;
+		}
+		EXPECT_TRUE(reader.ReadArray(result.data() + index, result.size() - index));
+		EXPECT_EQ(result, payload);
+		EXPECT_TRUE(reader.IsEof());
+
+		u32 pastEnd;
+		EXPECT_FALSE(reader.ReadObject(pastEnd));
+
+		// Seek back into the payload, both outside and inside the buffered range
+		for (size_t element : { 10u, 50000u, 50001u, 99999u })
+		{
+			reader.Seek(sectionOffset + element * sizeof(u32));
+			u32 value;
+			EXPECT_TRUE(reader.ReadObject(value));
+			EXPECT_EQ(value, element);
+		}
+	}
+
+	INSTANTIATE_TEST_SUITE_P(SyncAndAsync, AxFileStreamTest, testing::Bool());
+
+}
@@ -1,6 +1,8 @@
 ﻿#include <gtest/gtest.h>
 #include "Core/Asserts.h"
 #include "Core/Logging.h"
+#include "Core/RingBufferSink.h"
+#include "Memory/MemoryManager.h"
 
 void testDebug()
 {
@@ -38,6 +40,34 @@ TEST(TestLogging, TestLogger)
 	//axErrorFmt("Hello {}", "World");
 }
 
+TEST(TestLogging, TestRingBufferSink)
+{
+	apex::mem::MemoryManager::initialize({ 0, 0 });
+
+	{
+		apex::logging::RingBufferSink_st sink(256);
+		apex::logging::Logger::get().addSink(&sink);
+		for (int i = 0; i < 20; i++)
+		{
+			testDebug();
+		}
+		apex::logging::Logger::get().removeSink(&sink);
+
+		auto [first, second] = sink.contents();
+		std::string text(first.begin(), first.end());
+		text.append(second.begin(), second.end());
+
+		// Only whole messages are kept
+		EXPECT_LE(text.size(), 256);
+		EXPECT_EQ(text.rfind("[", 0), 0);
+		EXPECT_EQ(text.back(), '\n');
+		EXPECT_NE(text.find("Debug message"), std::string::npos);
+	}
+	EXPECT_EQ(apex::mem::MemoryManager::getAllocatedSize(), 0);
+
+	apex::mem::MemoryManager::shutdown();
+}
+
 TEST(TestAsserts, TestAssert)
 {
 #ifdef APEX_CONFIG_DEBUG
@@ -1,8 +1,13 @@
-﻿#include <gtest/gtest.h>
+﻿#include <random>
+#include <vector>
+#include <gtest/gtest.h>
 
+#include "Benchmark.h"
+#include "Math/BatchTransform.h"
 #include "Math/Math.h"
 #include "Math/Matrix4x4.h"
 #include "Math/Quaternion.h"
+#include "Math/Transform.h"
 
 namespace apex::math {
 
@@ -211,4 +216,449 @@ namespace apex::math {
 		}
 	}
 
+	class MathSimdTest : public testing::Test
+	{
+	public:
+		static Matrix4x4 randomMatrix(std::mt19937& rng)
+		{
+			std::uniform_real_distribution<f32> dist(-2.f, 2.f);
+			Matrix4x4 m;
+			for (size_t c = 0; c < 4; c++)
+				for (size_t r = 0; r < 4; r++)
+					m[c][r] = dist(rng);
+			return m;
+		}
+
+		// Scalar reference implementations the SIMD versions are checked against
+		static Vector4 referenceTransform(Matrix4x4 const& m, Vector4 const& v)
+		{
+			Vector4 res;
+			for (size_t r = 0; r < 4; r++)
+				res[r] = m[0][r] * v[0] + m[1][r] * v[1] + m[2][r] * v[2] + m[3][r] * v[3];
+			return res;
+		}
+
+		static Matrix4x4 referenceMultiply(Matrix4x4 const& a, Matrix4x4 const& b)
+		{
+			Matrix4x4 res;
+			for (size_t c = 0; c < 4; c++)
+				res[c] = referenceTransform(a, b[c]);
+			return res;
+		}
+
+		// Gauss-Jordan elimination with partial pivoting, in double precision
+		static Matrix4x4 referenceInverse(Matrix4x4 const& m)
+		{
+			double a[4][8] {};
+			for (size_t r = 0; r < 4; r++)
+			{
+				for (size_t c = 0; c < 4; c++)
+					a[r][c] = m[c][r];
+				a[r][4 + r] = 1.0;
+			}
+
+			for (size_t col = 0; col < 4; col++)
+			{
+				size_t pivot = col;
+				for (size_t r = col + 1; r < 4; r++)
+					if (std::abs(a[r][col]) > std::abs(a[pivot][col]))
+						pivot = r;
+				std::swap(a[col], a[pivot]);
+
+				const double scale = 1.0 / a[col][col];
+				for (double& value : a[col])
+					value *= scale;
+
+				for (size_t r = 0; r < 4; r++)
+				{
+					if (r == col)
+						continue;
+					const double factor = a[r][col];
+					for (size_t c = 0; c < 8; c++)
+						a[r][c] -= factor * a[col][c];
+				}
+			}
+
+			Matrix4x4 res;
+			for (size_t r = 0; r < 4; r++)
+				for (size_t c = 0; c < 4; c++)
+					res[c][r] = static_cast<f32>(a[r][4 + c]);
+			return res;
+		}
+
+		static void expectNear(Matrix4x4 const& a, Matrix4x4 const& b, f32 tolerance)
+		{
+			for (size_t c = 0; c < 4; c++)
+				for (size_t r = 0; r < 4; r++)
+					EXPECT_NEAR(a[c][r], b[c][r], tolerance) << "column " << c << " row " << r;
+		}
+	};
+
+	TEST_F(MathSimdTest, TestVector4)
+	{
+		const Vector4 u { 1.f, -2.f, 3.f, -4.f };
+		const Vector4 v { 0.5f, 4.f, -1.f, 2.f };
+
+		EXPECT_EQ(u + v, Vector4(1.5f, 2.f, 2.f, -2.f));
+		EXPECT_EQ(u - v, Vector4(0.5f, -6.f, 4.f, -6.f));
+		EXPECT_EQ(u * v, Vector4(0.5f, -8.f, -3.f, -8.f));
+		EXPECT_EQ(2.f * u, Vector4(2.f, -4.f, 6.f, -8.f));
+		EXPECT_EQ(u / 2.f, Vector4(0.5f, -1.f, 1.5f, -2.f));
+		EXPECT_EQ(min(u, v), Vector4(0.5f, -2.f, -1.f, -4.f));
+		EXPECT_EQ(max(u, v), Vector4(1.f, 4.f, 3.f, 2.f));
+		EXPECT_FLOAT_EQ(dot(u, v), -18.5f);
+
+		Vector4 w = u;
+		w *= v;
+		EXPECT_EQ(w, u * v);
+		w += v;
+		EXPECT_EQ(w, u * v + v);
+		w -= u;
+		EXPECT_EQ(w, u * v + v - u);
+	}
+
+	TEST_F(MathSimdTest, TestMatrixAgainstReference)
+	{
+		std::mt19937 rng(42);
+		for (int i = 0; i < 1000; i++)
+		{
+			const Matrix4x4 a = randomMatrix(rng);
+			const Matrix4x4 b = randomMatrix(rng);
+			const Vector4 v = b[0];
+
+			const Vector4 av = a * v;
+			const Vector4 expected = referenceTransform(a, v);
+			for (size_t r = 0; r < 4; r++)
+				EXPECT_NEAR(av[r], expected[r], 1e-5f);
+
+			expectNear(a * b, referenceMultiply(a, b), 1e-5f);
+
+			const Matrix4x4 at = a.transpose();
+			for (size_t c = 0; c < 4; c++)
+				for (size_t r = 0; r < 4; r++)
+					EXPECT_EQ(at[c][r], a[r][c]);
+
+			// Random matrices can be close to singular, so compare relative to the size of the inverse
+			const Matrix4x4 expectedInverse = referenceInverse(a);
+			f32 magnitude = 1.f;
+			for (size_t c = 0; c < 4; c++)
+				for (size_t r = 0; r < 4; r++)
+					magnitude = std::max(magnitude, std::abs(expectedInverse[c][r]));
+			expectNear(inverse(a), expectedInverse, 1e-4f * magnitude * magnitude);
+		}
+
+		const Matrix4x4 view = lookAt({ 1.f, 2.f, 3.f }, { 0.f, 0.f, 0.f }, Vector3::unitY());
+		expectNear(inverse(view) * view, Matrix4x4::identity(), 1e-5f);
+
+		const Matrix4x4 proj = perspective(radians(60.f), 16.f / 9.f, 0.1f, 100.f);
+		expectNear(proj * inverse(proj), Matrix4x4::identity(), 1e-4f);
+	}
+
+	TEST_F(MathSimdTest, TestQuatProduct)
+	{
+		const Quat a = Quat::fromAxisAngle(Vector3(1.f, 2.f, 3.f), 0.7f);
+		const Quat b = Quat::fromAxisAngle(Vector3(-2.f, 0.5f, 1.f), -1.3f);
+
+		const Quat q = a * b;
+		EXPECT_FLOAT_EQ(q.w, a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+		EXPECT_FLOAT_EQ(q.x, a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y);
+		EXPECT_FLOAT_EQ(q.y, a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x);
+		EXPECT_FLOAT_EQ(q.z, a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w);
+		EXPECT_FLOAT_EQ(Quat::dot(a, b), a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z);
+
+		const Quat identity = q * q.conjugate();
+		EXPECT_NEAR(identity.w, 1.f, 1e-6f);
+		EXPECT_NEAR(identity.x, 0.f, 1e-6f);
+		EXPECT_NEAR(identity.y, 0.f, 1e-6f);
+		EXPECT_NEAR(identity.z, 0.f, 1e-6f);
+	}
+
+	TEST_F(MathSimdTest, DISABLED_BenchmarkMath)
+	{
+		constexpr size_t kCount = 1 << 16;
+		constexpr int kRepeats = 20;
+
+		std::mt19937 rng(7);
+		std::vector<Matrix4x4> matrices(kCount);
+		for (Matrix4x4& m : matrices)
+			m = randomMatrix(rng);
+
+		auto measure = [](auto&& fn) { return bench::measurePerItem(kCount, kRepeats, fn); };
+
+		std::vector<Matrix4x4> out(kCount);
+		std::vector<Vector4> vectors(kCount);
+
+		const double mulSimd = measure([&] { for (size_t i = 1; i < kCount; i++) out[i] = matrices[i - 1] * matrices[i]; });
+		const double mulScalar = measure([&] { for (size_t i = 1; i < kCount; i++) out[i] = referenceMultiply(matrices[i - 1], matrices[i]); });
+		const double vecSimd = measure([&] { for (size_t i = 0; i < kCount; i++) vectors[i] = matrices[i] * matrices[i][3]; });
+		const double vecScalar = measure([&] { for (size_t i = 0; i < kCount; i++) vectors[i] = referenceTransform(matrices[i], matrices[i][3]); });
+		const double invSimd = measure([&] { for (size_t i = 0; i < kCount; i++) out[i] = inverse(matrices[i]); });
+		const double transposeSimd = measure([&] { for (size_t i = 0; i < kCount; i++) out[i] = matrices[i].transpose(); });
+		const double rotate = measure([&] { for (size_t i = 0; i < kCount; i++) out[i] = rotateAxisAngle(matrices[i], Vector3::unitY(), 0.5f, 0.866f); });
+
+		Quat q;
+		const Quat step = Quat::fromAxisAngle(Vector3(1.f, 1.f, 0.f), 0.01f);
+		const double quatMul = measure([&] { for (size_t i = 0; i < kCount; i++) q = q * step; });
+
+		printf("mat4 * mat4     : %6.2f ns | scalar %6.2f ns\n", mulSimd, mulScalar);
+		printf("mat4 * vec4     : %6.2f ns | scalar %6.2f ns\n", vecSimd, vecScalar);
+		printf("inverse         : %6.2f ns\n", invSimd);
+		printf("transpose       : %6.2f ns\n", transposeSimd);
+		printf("rotateAxisAngle : %6.2f ns\n", rotate);
+		printf("quat * quat     : %6.2f ns (%0.3f)\n", quatMul, q.w);
+	}
+
+	TEST_F(MathSimdTest, TestBatchTransform)
+	{
+		std::mt19937 rng(11);
+		std::uniform_real_distribution<f32> dist(-10.f, 10.f);
+
+		// Counts around the 4, 8 and 16 wide iterations, to cover the tails of every kernel
+		for (size_t count : { 0, 1, 3, 4, 7, 8, 9, 15, 16, 17, 31, 33, 1000 })
+		{
+			const Matrix4x4 m = randomMatrix(rng);
+
+			std::vector<Vector3> points(count);
+			std::vector<Vector4> vectors(count);
+			std::vector<f32> xs(count), ys(count), zs(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				points[i] = Vector3(dist(rng), dist(rng), dist(rng));
+				vectors[i] = Vector4(dist(rng), dist(rng), dist(rng), dist(rng));
+				xs[i] = points[i].x;
+				ys[i] = points[i].y;
+				zs[i] = points[i].z;
+			}
+
+			std::vector<Vector3> outPoints(count), outDirections(count);
+			std::vector<Vector4> outVectors(count);
+			std::vector<f32> outX(count), outY(count), outZ(count);
+			transformPoints(m, { points.data(), count }, { outPoints.data(), count });
+			transformDirections(m, { points.data(), count }, { outDirections.data(), count });
+			transformVectors(m, { vectors.data(), count }, { outVectors.data(), count });
+			transformPoints(m, xs.data(), ys.data(), zs.data(), outX.data(), outY.data(), outZ.data(), count);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				const Vector4 point = referenceTransform(m, Vector4(points[i], 1.f));
+				const Vector4 direction = referenceTransform(m, Vector4(points[i], 0.f));
+				const Vector4 vector = referenceTransform(m, vectors[i]);
+				for (size_t r = 0; r < 3; r++)
+				{
+					EXPECT_NEAR(outPoints[i][r], point[r], 1e-4f) << "count " << count << " index " << i;
+					EXPECT_NEAR(outDirections[i][r], direction[r], 1e-4f) << "count " << count << " index " << i;
+				}
+				for (size_t r = 0; r < 4; r++)
+					EXPECT_NEAR(outVectors[i][r], vector[r], 1e-4f) << "count " << count << " index " << i;
+
+				EXPECT_NEAR(outX[i], outPoints[i].x, 1e-4f);
+				EXPECT_NEAR(outY[i], outPoints[i].y, 1e-4f);
+				EXPECT_NEAR(outZ[i], outPoints[i].z, 1e-4f);
+			}
+
+			// In place
+			transformPoints(m, { points.data(), count }, { points.data(), count });
+			for (size_t i = 0; i < count; i++)
+				EXPECT_EQ(points[i], outPoints[i]);
+		}
+	}
+
+	TEST_F(MathSimdTest, TestBatchMultiply)
+	{
+		std::mt19937 rng(12);
+		for (size_t count : { 0, 1, 2, 3, 5, 64 })
+		{
+			const Matrix4x4 lhs = randomMatrix(rng);
+			std::vector<Matrix4x4> lhsArray(count), rhsArray(count), out(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				lhsArray[i] = randomMatrix(rng);
+				rhsArray[i] = randomMatrix(rng);
+			}
+
+			multiplyMatrices(lhs, { rhsArray.data(), count }, { out.data(), count });
+			for (size_t i = 0; i < count; i++)
+				expectNear(out[i], referenceMultiply(lhs, rhsArray[i]), 1e-5f);
+
+			multiplyMatrices({ lhsArray.data(), count }, { rhsArray.data(), count }, { out.data(), count });
+			for (size_t i = 0; i < count; i++)
+				expectNear(out[i], referenceMultiply(lhsArray[i], rhsArray[i]), 1e-5f);
+		}
+	}
+
+	TEST_F(MathSimdTest, TestComputeWorldFromLocal)
+	{
+		// Two roots, a chain below the first one and siblings below the second
+		const u32 parents[] = { kRootParent, 0, 1, kRootParent, 3, 3, 2, 5 };
+		constexpr size_t kCount = std::size(parents);
+
+		std::mt19937 rng(13);
+		Matrix4x4 local[kCount], world[kCount];
+		for (Matrix4x4& m : local)
+			m = randomMatrix(rng);
+
+		computeWorldFromLocal({ local, kCount }, { parents, kCount }, { world, kCount });
+
+		for (size_t i = 0; i < kCount; i++)
+		{
+			Matrix4x4 expected = local[i];
+			for (u32 p = parents[i]; p != kRootParent; p = parents[p])
+				expected = referenceMultiply(local[p], expected);
+			expectNear(world[i], expected, 1e-3f);
+		}
+	}
+
+	TEST_F(MathSimdTest, DISABLED_BenchmarkBatchTransform)
+	{
+		constexpr size_t kCount = 1 << 16;
+		constexpr int kRepeats = 20;
+
+		std::mt19937 rng(8);
+		const Matrix4x4 m = randomMatrix(rng);
+		std::vector<Vector3> points(kCount), outPoints(kCount);
+		std::vector<Vector4> vectors(kCount), outVectors(kCount);
+		std::vector<Matrix4x4> matrices(kCount), outMatrices(kCount);
+		for (size_t i = 0; i < kCount; i++)
+		{
+			matrices[i] = randomMatrix(rng);
+			vectors[i] = matrices[i][0];
+			points[i] = Vector3(vectors[i].x, vectors[i].y, vectors[i].z);
+		}
+
+		auto measure = [](auto&& fn) { return bench::measurePerItem(kCount, kRepeats, fn); };
+
+		const double pointsBatch = measure([&] { transformPoints(m, { points.data(), kCount }, { outPoints.data(), kCount }); });
+		const double pointsLoop = measure([&] {
+			for (size_t i = 0; i < kCount; i++)
+			{
+				const Vector4 p = m * Vector4(points[i], 1.f);
+				outPoints[i] = Vector3(p.x, p.y, p.z);
+			}
+		});
+		const double vectorsBatch = measure([&] { transformVectors(m, { vectors.data(), kCount }, { outVectors.data(), kCount }); });
+		const double vectorsLoop = measure([&] { for (size_t i = 0; i < kCount; i++) outVectors[i] = m * vectors[i]; });
+		const double multiplyBatch = measure([&] { multiplyMatrices(m, { matrices.data(), kCount }, { outMatrices.data(), kCount }); });
+		const double multiplyLoop = measure([&] { for (size_t i = 0; i < kCount; i++) outMatrices[i] = m * matrices[i]; });
+
+		printf("transformPoints  : %6.2f ns | loop %6.2f ns\n", pointsBatch, pointsLoop);
+		printf("transformVectors : %6.2f ns | loop %6.2f ns\n", vectorsBatch, vectorsLoop);
+		printf("multiplyMatrices : %6.2f ns | loop %6.2f ns\n", multiplyBatch, multiplyLoop);
+	}
+
+	TEST_F(MathSimdTest, TestAffineTransform)
+	{
+		std::mt19937 rng(21);
+		std::uniform_real_distribution<f32> dist(-2.f, 2.f);
+
+		auto randomAffine = [&]
+		{
+			// Random rotation and translation with a non-uniform scale and some shear, well away from singular
+			Matrix4x4 m = rotateAxisAngle(Matrix4x4::identity(), Vector3(dist(rng), dist(rng), 1.f), dist(rng));
+			m = scale(m, Vector3(1.f + dist(rng) * 0.4f, 1.f - dist(rng) * 0.4f, 0.5f));
+			m[1][0] += dist(rng) * 0.2f;
+			m.setTranslation(Vector3(dist(rng), dist(rng), dist(rng)) * 5.f);
+			return m;
+		};
+
+		for (int i = 0; i < 100; i++)
+		{
+			const Matrix4x4 ma = randomAffine();
+			const Matrix4x4 mb = randomAffine();
+			const AffineTransform a = AffineTransform::fromMatrix(ma);
+			const AffineTransform b = AffineTransform::fromMatrix(mb);
+
+			expectNear(a.toMatrix(), ma, 0.f);
+			expectNear((a * b).toMatrix(), referenceMultiply(ma, mb), 1e-5f);
+			expectNear(a.inverse().toMatrix(), referenceInverse(ma), 1e-4f);
+			expectNear((a * inverse(a)).toMatrix(), Matrix4x4::identity(), 1e-5f);
+
+			const Vector3 p { dist(rng), dist(rng), dist(rng) };
+			const Vector4 point = referenceTransform(ma, Vector4(p, 1.f));
+			const Vector4 direction = referenceTransform(ma, Vector4(p, 0.f));
+			for (size_t r = 0; r < 3; r++)
+			{
+				EXPECT_NEAR(a.transformPoint(p)[r], point[r], 1e-5f);
+				EXPECT_NEAR(a.transformDirection(p)[r], direction[r], 1e-5f);
+			}
+		}
+
+		const Vector3 eye { 1.f, 2.f, 3.f };
+		expectNear(AffineTransform::lookAt(eye, {}, Vector3::unitY()).toMatrix(), lookAt(eye, {}, Vector3::unitY()), 1e-6f);
+		EXPECT_EQ(AffineTransform::fromTranslation(eye).getTranslation(), eye);
+		expectNear(AffineTransform::fromScale(eye).toMatrix(), Matrix4x4(1.f, 2.f, 3.f, 1.f), 0.f);
+	}
+
+	TEST_F(MathSimdTest, TestRigidTransform)
+	{
+		std::mt19937 rng(22);
+		std::uniform_real_distribution<f32> dist(-2.f, 2.f);
+
+		auto randomRigid = [&]
+		{
+			return RigidTransform {
+				Quat::fromAxisAngle(Vector3(dist(rng), dist(rng), dist(rng)), dist(rng)),
+				Vector3(dist(rng), dist(rng), dist(rng)) * 5.f,
+				1.f + dist(rng) * 0.25f
+			};
+		};
+
+		for (int i = 0; i < 100; i++)
+		{
+			const RigidTransform a = randomRigid();
+			const RigidTransform b = randomRigid();
+			const Matrix4x4 ma = a.toMatrix();
+			const Matrix4x4 mb = b.toMatrix();
+
+			const Vector3 p { dist(rng), dist(rng), dist(rng) };
+			const Vector3 expected = a.translation + a.scale * a.rotation.applyToVector(p);
+			const Vector4 point = referenceTransform(ma, Vector4(p, 1.f));
+			for (size_t r = 0; r < 3; r++)
+			{
+				EXPECT_NEAR(a.transformPoint(p)[r], expected[r], 1e-4f);
+				EXPECT_NEAR(point[r], expected[r], 1e-4f);
+				EXPECT_NEAR(a.transformDirection(p)[r], expected[r] - a.translation[r], 1e-4f);
+			}
+
+			expectNear((a * b).toMatrix(), referenceMultiply(ma, mb), 1e-4f);
+			expectNear(a.inverse().toMatrix(), referenceInverse(ma), 1e-4f);
+			expectNear(a.toAffine().toMatrix(), ma, 0.f);
+
+			const RigidTransform identity = a * inverse(a);
+			EXPECT_NEAR(identity.scale, 1.f, 1e-6f);
+			EXPECT_NEAR(std::abs(identity.rotation.w), 1.f, 1e-5f);
+			for (size_t r = 0; r < 3; r++)
+				EXPECT_NEAR(identity.translation[r], 0.f, 1e-4f);
+		}
+	}
+
+	TEST_F(MathSimdTest, DISABLED_BenchmarkTransform)
+	{
+		constexpr size_t kCount = 1 << 14;
+		constexpr int kRepeats = 20;
+
+		std::mt19937 rng(9);
+		std::uniform_real_distribution<f32> dist(-2.f, 2.f);
+		std::vector<Matrix4x4> matrices(kCount), outMatrices(kCount);
+		std::vector<AffineTransform> affine(kCount), outAffine(kCount);
+		std::vector<RigidTransform> rigid(kCount), outRigid(kCount);
+		for (size_t i = 0; i < kCount; i++)
+		{
+			rigid[i] = { Quat::fromAxisAngle(Vector3(dist(rng), dist(rng), dist(rng)), dist(rng)), Vector3(dist(rng), dist(rng), dist(rng)) };
+			matrices[i] = rigid[i].toMatrix();
+			affine[i] = rigid[i].toAffine();
+		}
+
+		auto measure = [](auto&& fn) { return bench::measurePerItem(kCount, kRepeats, fn); };
+
+		const double composeMatrix = measure([&] { for (size_t i = 1; i < kCount; i++) outMatrices[i] = matrices[i - 1] * matrices[i]; });
+		const double composeAffine = measure([&] { for (size_t i = 1; i < kCount; i++) outAffine[i] = affine[i - 1] * affine[i]; });
+		const double composeRigid = measure([&] { for (size_t i = 1; i < kCount; i++) outRigid[i] = rigid[i - 1] * rigid[i]; });
+		const double inverseMatrix = measure([&] { for (size_t i = 0; i < kCount; i++) outMatrices[i] = inverse(matrices[i]); });
+		const double inverseAffine = measure([&] { for (size_t i = 0; i < kCount; i++) outAffine[i] = inverse(affine[i]); });
+		const double inverseRigid = measure([&] { for (size_t i = 0; i < kCount; i++) outRigid[i] = inverse(rigid[i]); });
+
+		printf("compose : mat4 %6.2f ns | affine %6.2f ns | rigid %6.2f ns\n", composeMatrix, composeAffine, composeRigid);
+		printf("inverse : mat4 %6.2f ns | affine %6.2f ns | rigid %6.2f ns\n", inverseMatrix, inverseAffine, inverseRigid);
+	}
+
 }
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "Math/Math.h"
+#include "Math/Random.h"
+#include "Math/Vector3.h"
+#include "Math/Vector4.h"
+
+namespace apex::math {
+
+	TEST(TestFastRandom, TestVectorComponentsDiffer)
+	{
+		for (u32 seed = 0; seed < 1000; seed++)
+		{
+			const Vector3 v = FastRandom::randomVector3(seed);
+			EXPECT_NE(v.x, v.y);
+			EXPECT_NE(v.y, v.z);
+			EXPECT_EQ(v, FastRandom::randomVector3(seed));
+
+			for (size_t i = 0; i < 3; i++)
+			{
+				EXPECT_GE(v[i], 0.f);
+				EXPECT_LT(v[i], 1.f);
+			}
+
+			const f32 f = FastRandom::randomFloat32(seed, -2.f, 3.f);
+			EXPECT_GE(f, -2.f);
+			EXPECT_LT(f, 3.f);
+
+			const s32 n = FastRandom::randomInt32(seed, -5, 5);
+			EXPECT_GE(n, -5);
+			EXPECT_LT(n, 5);
+
+			EXPECT_LT(FastRandom::randomUnitSphereVector3(seed).lengthSquared(), 1.f);
+		}
+	}
+
+	TEST(TestRandomStream, TestDeterministic)
+	{
+		RandomStream a { 1234 }, b { 1234 }, c { 1234, 1 };
+
+		u32 differences = 0;
+		for (int i = 0; i < 1000; i++)
+		{
+			const u32 va = a.nextU32();
+			EXPECT_EQ(va, b.nextU32());
+			differences += va != c.nextU32();
+		}
+		EXPECT_GT(differences, 990);
+	}
+
+	TEST(TestRandomStream, TestFillMatchesSingleDraws)
+	{
+		// Start the fills partway into a block, with counts around the block size, to cover the buffered values and the tails
+		for (size_t count : { 0, 1, 5, 15, 16, 17, 100, 1000 })
+		{
+			RandomStream single { 42 }, bulk { 42 };
+			for (int i = 0; i < 3; i++)
+				EXPECT_EQ(single.nextU32(), bulk.nextU32());
+
+			std::vector<u32> ints(count);
+			bulk.fillU32({ ints.data(), count });
+			for (size_t i = 0; i < count; i++)
+				EXPECT_EQ(ints[i], single.nextU32()) << "count " << count << " index " << i;
+
+			std::vector<f32> floats(count);
+			bulk.fillFloat32({ floats.data(), count }, -3.f, 5.f);
+			for (size_t i = 0; i < count; i++)
+			{
+				EXPECT_FLOAT_EQ(floats[i], single.nextFloat32(-3.f, 5.f)) << "count " << count << " index " << i;
+				EXPECT_GE(floats[i], -3.f);
+				EXPECT_LT(floats[i], 5.f);
+			}
+
+			std::vector<Vector3> vectors(count);
+			bulk.fillVector3({ vectors.data(), count }, 0.f, 1.f);
+			for (size_t i = 0; i < count; i++)
+			{
+				const Vector3 expected = single.nextVector3(0.f, 1.f);
+				for (size_t c = 0; c < 3; c++)
+					EXPECT_FLOAT_EQ(vectors[i][c], expected[c]);
+			}
+
+			EXPECT_EQ(single.nextU32(), bulk.nextU32());
+		}
+	}
+
+	TEST(TestRandomStream, TestSplitAndJump)
+	{
+		RandomStream parent { 7 };
+		RandomStream copy = parent;
+
+		RandomStream child = parent.split();
+		for (int i = 0; i < 100; i++)
+			EXPECT_EQ(child.nextU32(), copy.nextU32());
+
+		// Splitting again in the same order gives the same children
+		RandomStream replay { 7 };
+		(void)replay.split();
+		RandomStream second = parent.split();
+		RandomStream replaySecond = replay.split();
+		u32 differences = 0;
+		for (int i = 0; i < 100; i++)
+		{
+			const u32 value = second.nextU32();
+			EXPECT_EQ(value, replaySecond.nextU32());
+			differences += value != child.nextU32();
+		}
+		EXPECT_GT(differences, 95);
+
+		RandomStream a { 9 }, b { 9 };
+		a.jump();
+		b.jump();
+		for (int i = 0; i < 100; i++)
+			EXPECT_EQ(a.nextU32(), b.nextU32());
+	}
+
+	TEST(TestRandomStream, TestJumpMatchesReference)
+	{
+		constexpr size_t kLanes = RandomStream::kLanes;
+
+		// Lane 0 of RandomStream { 9 } starts from the state { 0x1dac4dfe, 0x9091b154, 0xc72141cd, 0xfdae5120 }. The expected
+		// values come from the reference xoshiro128** next() and jump() by Blackman and Vigna, run on that state
+		constexpr u32 kExpected[4] = { 0xce15e5b1, 0x86a58f81, 0xffe586a8, 0xa1f3f611 };
+		constexpr u32 kExpectedJumped[4] = { 0x99e57326, 0x5203d8ed, 0x6a3d0dbd, 0x42f3aeb1 };
+
+		// Draws are interleaved across the lanes, so lane 0 produces every kLanes-th value
+		auto drawLane0 = [](RandomStream& stream, u32 (&out)[4])
+		{
+			for (u32& value : out)
+			{
+				value = stream.nextU32();
+				for (size_t lane = 1; lane < kLanes; lane++)
+					(void)stream.nextU32();
+			}
+		};
+
+		RandomStream stream { 9 };
+		u32 values[4];
+		drawLane0(stream, values);
+		for (size_t i = 0; i < 4; i++)
+			EXPECT_EQ(values[i], kExpected[i]);
+
+		RandomStream jumped { 9 };
+		jumped.jump();
+		drawLane0(jumped, values);
+		for (size_t i = 0; i < 4; i++)
+			EXPECT_EQ(values[i], kExpectedJumped[i]);
+
+		// The jumped stream must not replay any part of the window the original stream covers. A shifted copy would
+		// match on every draw, unrelated streams only by chance (about 1 in 65536 per draw here)
+		constexpr size_t kWindow = 1 << 16;
+		RandomStream original { 9 };
+		std::vector<u32> window(kWindow);
+		original.fillU32({ window.data(), kWindow });
+		std::sort(window.begin(), window.end());
+
+		u32 matches = 0;
+		for (int i = 0; i < 1024; i++)
+			matches += std::binary_search(window.begin(), window.end(), jumped.nextU32());
+		EXPECT_LE(matches, 4);
+	}
+
+	TEST(TestRandomStream, TestDistribution)
+	{
+		constexpr size_t kCount = 1 << 16;
+		RandomStream stream { 99 };
+
+		std::vector<f32> values(kCount);
+		stream.fillFloat32({ values.data(), kCount });
+
+		double sum = 0.0;
+		u32 buckets[16] {};
+		for (f32 v : values)
+		{
+			ASSERT_GE(v, 0.f);
+			ASSERT_LT(v, 1.f);
+			sum += v;
+			buckets[static_cast<size_t>(v * 16.f)]++;
+		}
+
+		EXPECT_NEAR(sum / kCount, 0.5, 0.01);
+		for (u32 bucket : buckets)
+			EXPECT_NEAR(bucket, kCount / 16, kCount / 16 / 10);
+
+		for (int i = 0; i < 1000; i++)
+		{
+			const s32 n = stream.nextInt32(-3, 4);
+			EXPECT_GE(n, -3);
+			EXPECT_LT(n, 4);
+			EXPECT_NEAR(stream.nextUnitVector3().length(), 1.f, 1e-5f);
+		}
+
+		// The full s32 range must not overflow, both halves should come up
+		u32 negatives = 0;
+		for (int i = 0; i < 1000; i++)
+		{
+			const s32 n = stream.nextInt32(Constants::s32_MIN, Constants::s32_MAX);
+			EXPECT_LT(n, Constants::s32_MAX);
+			negatives += n < 0;
+		}
+		EXPECT_GT(negatives, 400);
+		EXPECT_LT(negatives, 600);
+	}
+
+	TEST(TestRandomStream, TestThreadLocalStreams)
+	{
+		u32 values[2][64];
+		auto draw = [&values](size_t thread)
+		{
+			for (u32& value : values[thread])
+				value = static_cast<u32>(Random::randomInt32());
+		};
+
+		std::thread t0(draw, 0);
+		std::thread t1(draw, 1);
+		t0.join();
+		t1.join();
+
+		u32 differences = 0;
+		for (size_t i = 0; i < 64; i++)
+			differences += values[0][i] != values[1][i];
+		EXPECT_GT(differences, 60);
+	}
+
+	TEST(TestRandomStream, DISABLED_BenchmarkFill)
+	{
+		constexpr size_t kCount = 1 << 16;
+		constexpr int kRepeats = 20;
+
+		auto measure = [](auto&& fn) { return bench::measurePerItem(kCount, kRepeats, fn); };
+
+		std::vector<f32> values(kCount);
+		RandomStream stream { 5 };
+		std::mt19937 engine { 5 };
+		std::uniform_real_distribution<f32> distribution { -1.f, 1.f };
+
+		const double fill = measure([&] { stream.fillFloat32({ values.data(), kCount }, -1.f, 1.f); });
+		const double single = measure([&] { for (f32& v : values) v = stream.nextFloat32(-1.f, 1.f); });
+		const double stdlib = measure([&] { for (f32& v : values) v = distribution(engine); });
+
+		printf("fillFloat32 : %6.2f ns | nextFloat32 %6.2f ns | std::mt19937 %6.2f ns\n", fill, single, stdlib);
+	}
+
+}
@@ -1,4 +1,7 @@
-﻿#include <vector>
+﻿#include <atomic>
+#include <list>
+#include <numeric>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "Containers/AxRange.h"
@@ -152,4 +155,146 @@ namespace apex {
 		}
 	}
 
+	TEST_F(AxRangeTest, TestTransform)
+	{
+		auto squares = ranges::transform(vec, [](int i) { return i * i; });
+		EXPECT_EQ(squares.size(), vec.size());
+
+		size_t i = 0;
+		for (int value : squares)
+		{
+			EXPECT_EQ(value, vec[i] * vec[i]);
+			i++;
+		}
+		EXPECT_EQ(i, vec.size());
+		EXPECT_EQ(*(squares.begin() + 3), 36);
+
+		// Adaptors chain after a filter view too
+		auto isEven = [](int const& i) { return i % 2 == 0; };
+		std::vector<int> halves;
+		for (int value : ranges::AxView(vec, isEven).transform([](int i) { return i / 2; }))
+		{
+			halves.push_back(value);
+		}
+		EXPECT_EQ(halves, (std::vector<int>{ 1, 2, 3, 2, 4 }));
+
+		// Transforms can write through references
+		for (int& value : ranges::transform(vec, [](int& i) -> int& { return i; }))
+		{
+			value += 100;
+		}
+		EXPECT_EQ(vec[0], 101);
+	}
+
+	TEST_F(AxRangeTest, TestZipAndEnumerate)
+	{
+		std::vector<float> weights = { 0.5f, 1.f, 2.f };
+
+		// Zip stops at the shortest range
+		auto zipped = ranges::zip(vec, weights);
+		EXPECT_EQ(zipped.size(), 3);
+
+		float sum = 0.f;
+		for (auto [value, weight] : zipped)
+		{
+			sum += value * weight;
+		}
+		EXPECT_FLOAT_EQ(sum, 1 * 0.5f + 2 * 1.f + 4 * 2.f);
+
+		for (auto [value, weight] : zipped)
+		{
+			weight = static_cast<float>(value);
+		}
+		EXPECT_EQ(weights, (std::vector<float>{ 1.f, 2.f, 4.f }));
+
+		size_t expected = 0;
+		for (auto [index, value] : ranges::enumerate(vec))
+		{
+			EXPECT_EQ(index, expected);
+			EXPECT_EQ(value, vec[expected]);
+			expected++;
+		}
+		EXPECT_EQ(expected, vec.size());
+
+		auto enumerated = ranges::enumerate(vec);
+		EXPECT_EQ((*(enumerated.begin() + 4)).first, 4);
+		EXPECT_EQ((*(enumerated.begin() + 4)).second, 3);
+	}
+
+	TEST_F(AxRangeTest, TestChunkAndStride)
+	{
+		auto chunks = ranges::chunk(vec, 4);
+		EXPECT_EQ(chunks.size(), 3);
+
+		std::vector<size_t> sizes;
+		std::vector<int> flattened;
+		for (auto chunk : chunks)
+		{
+			sizes.push_back(chunk.size());
+			for (int value : chunk)
+				flattened.push_back(value);
+		}
+		EXPECT_EQ(sizes, (std::vector<size_t>{ 4, 4, 2 }));
+		EXPECT_EQ(flattened, vec);
+		EXPECT_EQ(*(*(chunks.begin() + 2)).begin(), 8);
+
+		auto strided = ranges::stride(vec, 3);
+		EXPECT_EQ(strided.size(), 4);
+		std::vector<int> values(strided.begin(), strided.end());
+		EXPECT_EQ(values, (std::vector<int>{ 1, 6, 5, 9 }));
+		EXPECT_EQ(*(strided.begin() + 2), 5);
+		EXPECT_EQ(strided.begin() + 10, strided.end());
+
+		// Forward only ranges are supported, just without random access
+		std::list<int> list(vec.begin(), vec.end());
+		std::vector<int> fromList;
+		for (int value : ranges::stride(list, 4))
+		{
+			fromList.push_back(value);
+		}
+		EXPECT_EQ(fromList, (std::vector<int>{ 1, 3, 8 }));
+
+		// Adaptors compose: the sum of every chunk of every other element
+		std::vector<int> sums;
+		for (auto chunk : ranges::stride(vec, 2).chunk(2))
+		{
+			sums.push_back(std::accumulate(chunk.begin(), chunk.end(), 0));
+		}
+		EXPECT_EQ(sums, (std::vector<int>{ 1 + 4, 3 + 5, 8 }));
+	}
+
+	TEST_F(AxRangeTest, TestParallel)
+	{
+		constexpr size_t kCount = 100'000;
+		std::vector<float> positions(kCount, 1.f);
+		std::vector<float> velocities(kCount);
+		std::iota(velocities.begin(), velocities.end(), 0.f);
+
+		ranges::zip(positions, velocities).par(4, 1000).forEach([](auto const& elem)
+		{
+			auto& [position, velocity] = elem;
+			position += velocity * 0.5f;
+		});
+
+		for (size_t i = 0; i < kCount; i++)
+		{
+			ASSERT_FLOAT_EQ(positions[i], 1.f + static_cast<float>(i) * 0.5f);
+		}
+
+		std::atomic<size_t> numVisited { 0 };
+		std::atomic<u32> numBatches { 0 };
+		ranges::all(positions).stride(2).par(4, 1000).forEachBatch([&](auto batch)
+		{
+			numVisited += batch.size();
+			++numBatches;
+		});
+		EXPECT_EQ(numVisited, kCount / 2);
+		EXPECT_LE(numBatches, 4);
+
+		// Too small to be worth splitting, runs inline
+		numBatches = 0;
+		ranges::all(vec).par(4, 1000).forEachBatch([&](auto batch) { ++numBatches; });
+		EXPECT_EQ(numBatches, 1);
+	}
+
 }
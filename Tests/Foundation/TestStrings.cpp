@@ -1,8 +1,17 @@
-﻿#include <gtest/gtest.h>
+﻿#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
 
 #include "String/AxString.h"
+#include "Memory/ArenaAllocator.h"
 #include "Memory/MemoryManager.h"
 #include "String/AxHashString.h"
+#include "String/AxStringBuilder.h"
+#include "String/AxStringTable.h"
 
 namespace apex {
 
@@ -72,12 +81,231 @@ namespace apex {
 	{
 		ASSERT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
 		{
-			constexpr u64 hash = FnvHasher64::Hash("CMeshRendererComponent");
+			constexpr u64 hash = AxHashString::HasherType::Hash("CMeshRendererComponent");
 			AxHashString h;
 			constexpr AxHashString hs("CMeshRendererComponent");
 			static_assert(hs.GetHash() == hash);
+
+			static_assert(FnvHasher64::Hash("") == FnvHasher64::kValue);
+			static_assert(FnvHasher64::Hash("a") == 0xaf63dc4c8601ec8c);
+		}
+		ASSERT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+	}
+
+	TEST_F(AxStringTest, TestFastHasher)
+	{
+		// Compile-time and runtime hashes agree for both the short and the long (SIMD) path
+		constexpr AxStringView longPath = "assets://environments/forest/props/vegetation/trees/oak/lod0/"
+			"oak_trunk_bark_albedo_roughness_metallic_packed_4096x4096_bc7_srgb_mip_chain_streamed.axtexture";
+		static_assert(longPath.length() > FastHasher64::kLongThreshold);
+		constexpr u64 longHash = FastHasher64::Hash(longPath);
+		EXPECT_EQ(AxHashString(std::string(longPath)).GetHash(), longHash);
+		EXPECT_EQ(AxHashString(std::string("shaders/pbr.frag")).GetHash(), "shaders/pbr.frag"_hs.GetHash());
+
+		// Every length and alignment, including several scramble blocks, against the scalar path
+		std::mt19937 rng(1234);
+		std::string buffer(4096 + 8, '\0');
+		for (char& c : buffer)
+		{
+			c = static_cast<char>(rng());
+		}
+		for (size_t length = 0; length <= 2200; length += (length < 300 ? 1 : 37))
+		{
+			for (size_t offset = 0; offset < 8; offset += 3)
+			{
+				const AxStringView str(buffer.data() + offset, length);
+				ASSERT_EQ(FastHasher64::Hash(str), FastHasher64::HashScalar(str)) << "length " << length << " offset " << offset;
+				ASSERT_EQ(FastHasher64::Hash(str, 77), FastHasher64::HashScalar(str, 77)) << "length " << length << " offset " << offset;
+			}
+		}
+
+		// No collisions between similar paths of every length class
+		std::unordered_set<u64> hashes;
+		for (u32 i = 0; i < 20000; i++)
+		{
+			const std::string name = std::string(i % 300, 'a') + std::to_string(i);
+			EXPECT_TRUE(hashes.insert(FastHasher64::Hash(name)).second) << name;
+		}
+	}
+
+	TEST_F(AxStringTest, DISABLED_BenchmarkStringHash)
+	{
+		auto measure = [](std::vector<std::string> const& strings, auto&& hash)
+		{
+			size_t bytes = 0;
+			u64 sink = 0;
+			const auto start = std::chrono::high_resolution_clock::now();
+			for (u32 repeat = 0; repeat < 20; repeat++)
+			{
+				for (std::string const& str : strings)
+				{
+					sink += hash(AxStringView(str));
+					bytes += str.size();
+				}
+			}
+			const auto end = std::chrono::high_resolution_clock::now();
+			EXPECT_NE(sink, 0);
+			return static_cast<double>(bytes) / std::chrono::duration<double>(end - start).count() / (1024.0 * 1024.0 * 1024.0);
+		};
+
+		std::mt19937 rng(99);
+		for (size_t length : { 8, 16, 32, 96, 200, 1024, 16384 })
+		{
+			std::vector<std::string> strings(std::max<size_t>(1, 2'000'000 / length));
+			for (std::string& str : strings)
+			{
+				str.resize(length);
+				for (char& c : str)
+				{
+					c = static_cast<char>('a' + rng() % 26);
+				}
+			}
+
+			const double fnv = measure(strings, [](AxStringView str) { return FnvHasher64::Hash(str); });
+			const double fast = measure(strings, [](AxStringView str) { return FastHasher64::Hash(str); });
+			printf("hash %6zu B : FnvHasher64 %7.2f GiB/s | FastHasher64 %7.2f GiB/s\n", length, fnv, fast);
+		}
+	}
+
+	TEST_F(AxStringTest, TestStringInterning)
+	{
+		const size_t allocated = mem::MemoryManager::getAllocatedSize();
+
+		AxHashString first, second;
+		{
+			std::string name = "textures/";
+			name += "stone_albedo.png";
+			first = AxHashString(name);
+			name.assign(name.size(), '#');
+		}
+		{
+			std::string name = "textures/stone_albedo.png";
+			second = AxHashString(name);
+		}
+
+		// Both point at the same interned copy, which outlives the temporaries
+		EXPECT_EQ(first.GetStr(), "textures/stone_albedo.png");
+		EXPECT_EQ(first.GetStr().data(), second.GetStr().data());
+		EXPECT_EQ(first.GetStr().data()[first.GetStr().length()], '\0');
+		EXPECT_EQ(first, "textures/stone_albedo.png"_hs);
+
+		EXPECT_EQ(AxStringTable::Find(first.GetHash()), "textures/stone_albedo.png");
+		EXPECT_TRUE(AxStringTable::Find(AxHash("never interned").GetHash()).empty());
+		EXPECT_TRUE(AxHashString(AxStringView()).GetStr().empty());
+
+		// The table does not allocate from the MemoryManager
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), allocated);
+	}
+
+	TEST_F(AxStringTest, TestConcurrentInterning)
+	{
+		constexpr u32 kNumThreads = 4;
+		constexpr u32 kNumNames = 2000;
+
+		std::vector<std::string> names;
+		for (u32 i = 0; i < kNumNames; i++)
+		{
+			names.push_back("entities/level_" + std::to_string(i % 7) + "/prop_" + std::to_string(i));
+		}
+
+		// Every thread interns all names, in a different order
+		std::vector<std::vector<const char*>> results(kNumThreads, std::vector<const char*>(kNumNames));
+		std::vector<std::thread> threads;
+		for (u32 t = 0; t < kNumThreads; t++)
+		{
+			threads.emplace_back([&names, &results, t]
+			{
+				constexpr u32 kStrides[kNumThreads] = { 1, 3, 7, 11 };
+				for (u32 n = 0; n < kNumNames; n++)
+				{
+					const u32 i = (n * kStrides[t] + t * 500) % kNumNames;
+					results[t][i] = AxStringTable::Intern(names[i]).data();
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
 		}
+
+		for (u32 i = 0; i < kNumNames; i++)
+		{
+			for (u32 t = 1; t < kNumThreads; t++)
+			{
+				EXPECT_EQ(results[t][i], results[0][i]);
+			}
+			EXPECT_EQ(AxStringView(results[0][i]), names[i]);
+			EXPECT_EQ(AxHashString(names[i]).GetStr().data(), results[0][i]);
+		}
+		EXPECT_GE(AxStringTable::GetCount(), kNumNames);
+	}
+
+	TEST_F(AxStringTest, TestStringBuilder)
+	{
 		ASSERT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+		{
+			AxStringBuilder<32> builder;
+			builder.append("assets").append('/').append(AxStringView("meshes"));
+			builder += "/cube";
+			builder.format("_lod{}.{}", 2, "axmesh");
+			EXPECT_EQ(builder.view(), "assets/meshes/cube_lod2.axmesh");
+			EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+			// Spills to the heap, doubling the capacity
+			builder.format(" {:>40}", 3.5f);
+			EXPECT_EQ(builder.size(), 30 + 41);
+			EXPECT_GT(mem::MemoryManager::getAllocatedSize(), 0);
+			EXPECT_EQ(builder.c_str()[builder.size()], '\0');
+			EXPECT_EQ(builder.view().substr(67), " 3.5");
+
+			fmt::format_to(std::back_inserter(builder), "|{:04}", 42);
+			EXPECT_TRUE(builder.view().ends_with("3.5|0042"));
+
+			// The heap buffer is moved into the AxString
+			const char* heapData = builder.data();
+			AxString str = builder.ToString();
+			EXPECT_EQ(str.c_str(), heapData);
+			EXPECT_EQ(str.size(), 76);
+			EXPECT_TRUE(builder.empty());
+
+			builder.append(3, 'x');
+			AxString small = builder.ToString();
+			EXPECT_STREQ(small.c_str(), "xxx");
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+		{
+			AxStringBuilder<16> truncating(StringBuilderMode::eTruncate);
+			truncating.format("{}-{}-{}", "first", "second", "third");
+			EXPECT_EQ(truncating.view(), "first-second-th");
+			EXPECT_TRUE(truncating.truncated());
+			truncating.append("more");
+			EXPECT_EQ(truncating.size(), 15);
+
+			truncating.clear();
+			EXPECT_FALSE(truncating.truncated());
+			truncating.append("short");
+			EXPECT_STREQ(truncating.c_str(), "short");
+			EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+		}
+		{
+			alignas(16) static u8 buffer[4096];
+			mem::ArenaAllocator arena;
+			arena.initialize(buffer, sizeof(buffer));
+
+			AxStringBuilder<8> scratch(&arena);
+			for (u32 i = 0; i < 100; i++)
+			{
+				scratch.format("{},", i);
+			}
+			EXPECT_TRUE(scratch.view().starts_with("0,1,2,"));
+			EXPECT_TRUE(scratch.data() >= reinterpret_cast<char*>(buffer) && scratch.data() < reinterpret_cast<char*>(buffer) + sizeof(buffer));
+			EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
+
+			AxString copy = scratch.ToString();
+			EXPECT_EQ(copy.size(), 290);
+			arena.reset();
+		}
+		EXPECT_EQ(mem::MemoryManager::getAllocatedSize(), 0);
 	}
 
 }
@@ -1,11 +1,10 @@
 ﻿#include "InverseKinematics.h"
 
-#include <deque>
-
 #include "Apex/Application.h"
 #include "Apex/Window.h"
 #include "Containers/AxList.h"
 #include "Containers/AxRange.h"
+#include "Containers/AxRingBuffer.h"
 #include "Graphics/ForwardRenderer.h"
 #include "Graphics/Primitives/Cube.h"
 #include "Graphics/Primitives/Pyramid.h"
@@ -46,8 +45,7 @@ void IKChain::computeBfsOrder()
 	apex::AxArray<apex::u32> visited;
 	visited.resize(parents.size(), 0);
 
-	// TODO: make own deque class using AxArray
-	std::deque<apex::u32> queue;
+	apex::AxDeque<apex::u32> queue(parents.size());
 
 	queue.push_back(0);
 	visited[0] = 1;